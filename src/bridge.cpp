@@ -0,0 +1,817 @@
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include "platform.h"
+#include "config.h"
+#include "ring.h"
+#include "znp.h"
+#include "bridge.h"
+
+BridgeConfig cfg;
+
+int listenFd = -1;
+int clientFd[MAX_SOCKET_CLIENTS];
+
+// UART -> network and network -> UART
+ByteRing serialRing;
+ByteRing netRing;
+
+// optional reassembly of UART -> network data into whole ZNP frames
+ZnpFramer serialFramer;
+
+// UART data fanned out to all clients, each reads at its own cursor
+BroadcastRing broadcastRing;
+
+// SRSPs go back to the client that sent the SREQ
+ZnpSreqTracker sreqTracker;
+
+struct BridgeClient
+{
+  size_t cursor;
+  uint32_t skipped;
+  bool slow;
+  int role;
+  uint32_t connectedAt;
+  char ip[16];
+  uint32_t rxBytes;
+  uint32_t txBytes;
+  uint32_t droppedBytes;
+  uint32_t filteredBytes;
+  // AREQs this client subscribed to, everything if never set
+  ZnpFilter filter;
+  // network -> UART: bytes read from the socket waiting for the framer
+  ZnpFramer framer;
+  uint8_t in[ZNP_MAX_FRAME];
+  uint16_t inLen;
+  uint16_t inPos;
+  // when the last socket read happened
+  uint32_t rxAt;
+  // next UART -> network stamp this client has not passed
+  uint32_t stampNext;
+  LatencyHistogram latency[2];
+};
+BridgeClient clientState[MAX_SOCKET_CLIENTS];
+// first client served in the next writer round
+uint8_t writerNext = 0;
+// totals per role, kept across reconnects
+BridgeRoleStats roleStats[2];
+
+// A stamp marks where a unit ends in a ring and when its last byte came in
+// (UART or socket read); the unit is timed once the stream has left the
+// bridge up to that end (socket send, hand-off to the UART driver).
+struct LatencyStamp
+{
+  size_t end;
+  uint32_t at;
+  uint32_t clients;
+};
+// UART -> network, each client walks the stamps with its own index
+LatencyStamp toClientStamps[LATENCY_STAMPS];
+uint32_t toClientSeq = 0;
+// network -> UART, a FIFO since there is one reader
+LatencyStamp toUartStamps[LATENCY_STAMPS];
+uint32_t toUartHead = 0;
+uint32_t toUartTail = 0;
+uint32_t serialRxAt = 0;
+LatencyHistogram latency[2];
+volatile bool latencyResetPending = false;
+// copies for other tasks, taken by the bridge task between passes
+LatencyHistogram latencySnapshot[MAX_SOCKET_CLIENTS + 1][2];
+std::atomic<bool> latencySnapshotPending{false};
+
+void bridgeLog(const char *format, ...)
+{
+  char msg[128];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(msg, sizeof(msg), format, args);
+  va_end(args);
+  platformLog(msg);
+}
+
+bool bridgeBegin(const BridgeConfig &config)
+{
+  cfg = config;
+
+  for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+  {
+    clientFd[cln] = -1;
+  }
+
+  if (!serialRing.begin(cfg.serialRingSize) || !netRing.begin(cfg.netRingSize))
+  {
+    bridgeLog("Ring alloc failed, using minimal rings");
+    serialRing.begin(ByteRing::RING_MIN_SIZE);
+    netRing.begin(ByteRing::RING_MIN_SIZE);
+  }
+
+  serialFramer.setTimeout(cfg.framerTimeout * 1000);
+  for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+  {
+    clientState[cln].framer.setTimeout(cfg.framerTimeout * 1000);
+  }
+
+  // room for the allowed lag plus one full unit on top of it
+  if (!broadcastRing.begin(cfg.clientLag + ZNP_MAX_FRAME))
+  {
+    bridgeLog("Broadcast ring alloc failed, using minimal ring");
+    broadcastRing.begin(ByteRing::RING_MIN_SIZE);
+  }
+  if (cfg.clientLag > (int)(broadcastRing.capacity() - ZNP_MAX_FRAME))
+  {
+    cfg.clientLag = broadcastRing.capacity() - ZNP_MAX_FRAME;
+  }
+  sreqTracker.setTimeout(SREQ_TIMEOUT_MS);
+
+  listenFd = socket(AF_INET, SOCK_STREAM, 0);
+  if (listenFd < 0)
+  {
+    bridgeLog("Socket create failed %d", errno);
+    return false;
+  }
+  int on = 1;
+  setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(cfg.socketPort);
+  if (bind(listenFd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(listenFd, MAX_SOCKET_CLIENTS) < 0)
+  {
+    bridgeLog("Socket port %d bind failed %d", cfg.socketPort, errno);
+    close(listenFd);
+    listenFd = -1;
+    return false;
+  }
+  fcntl(listenFd, F_SETFL, fcntl(listenFd, F_GETFL, 0) | O_NONBLOCK);
+  return true;
+}
+
+void bridgeElectPrimary();
+bool bridgeBroadcast(const uint8_t *data, size_t len, uint32_t readers);
+
+void bridgeWait()
+{
+  fd_set readSet;
+  fd_set writeSet;
+  int maxFd = -1;
+  FD_ZERO(&readSet);
+  FD_ZERO(&writeSet);
+
+  int uartFd = platformUartFd();
+  if (uartFd >= 0)
+  {
+    FD_SET(uartFd, &readSet);
+    maxFd = uartFd;
+  }
+  if (listenFd >= 0)
+  {
+    FD_SET(listenFd, &readSet);
+    maxFd = std::max(maxFd, listenFd);
+  }
+  for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+  {
+    int fd = clientFd[cln];
+    if (fd < 0)
+      continue;
+    // a full netRing stops reading sockets, their data waits in the TCP window
+    if (netRing.space() >= ZNP_MAX_FRAME)
+      FD_SET(fd, &readSet);
+    // clients behind the broadcast head wait for send buffer space
+    if (broadcastRing.lag(clientState[cln].cursor) > 0)
+      FD_SET(fd, &writeSet);
+    maxFd = std::max(maxFd, fd);
+  }
+
+  // the idle timeout only bounds how long a lost wakeup can stall us,
+  // traffic in either direction and new connections wake the task
+  struct timeval timeout;
+  timeout.tv_sec = 0;
+  timeout.tv_usec = BRIDGE_IDLE_MS * 1000;
+
+  // no event tells us the TX FIFO drained, so poll while netRing has data
+  if (uartFd < 0 || !netRing.isEmpty())
+  {
+    timeout.tv_usec = 1000;
+  }
+  bool framerPending = cfg.znpFramer && serialFramer.pending();
+  for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+  {
+    framerPending = framerPending || clientState[cln].framer.pending();
+  }
+  if (framerPending && (uint32_t)timeout.tv_usec > serialFramer.timeout())
+  {
+    timeout.tv_usec = serialFramer.timeout();
+  }
+  if (platformUartAvailable() && serialRing.space() > 0)
+  {
+    timeout.tv_usec = 0;
+  }
+
+  if (maxFd < 0)
+  {
+    platformSleep(timeout.tv_usec / 1000);
+    return;
+  }
+
+  if (select(maxFd + 1, &readSet, &writeSet, NULL, &timeout) > 0 && uartFd >= 0 && FD_ISSET(uartFd, &readSet))
+  {
+    platformUartAck();
+  }
+}
+
+void bridgeClose(int cln)
+{
+  if (clientFd[cln] < 0)
+    return;
+  close(clientFd[cln]);
+  clientFd[cln] = -1;
+  // a half frame from a closed client must not reach the UART
+  clientState[cln].framer.release();
+  clientState[cln].inLen = 0;
+  clientState[cln].inPos = 0;
+  sreqTracker.forget(cln);
+  for (uint32_t i = toUartTail; i != toUartHead; i++)
+  {
+    toUartStamps[i % LATENCY_STAMPS].clients &= ~(1UL << cln);
+  }
+  platformClientEvent(cln, false);
+  bridgeElectPrimary();
+}
+
+void bridgeAccept()
+{
+  for (;;)
+  {
+    struct sockaddr_in addr;
+    socklen_t addrLen = sizeof(addr);
+    int fd = accept(listenFd, (struct sockaddr *)&addr, &addrLen);
+    if (fd < 0)
+      break;
+
+    int i;
+    for (i = 0; i < MAX_SOCKET_CLIENTS; i++)
+    {
+      //find free spot
+      if (clientFd[i] < 0)
+        break;
+    }
+    if (i == MAX_SOCKET_CLIENTS)
+    {
+      //no free spot so reject
+      close(fd);
+      continue;
+    }
+
+    int on = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    clientFd[i] = fd;
+
+    // new clients start at the live edge of the stream
+    clientState[i].cursor = broadcastRing.head();
+    clientState[i].skipped = 0;
+    clientState[i].slow = false;
+    clientState[i].framer.release();
+    clientState[i].inLen = 0;
+    clientState[i].inPos = 0;
+    clientState[i].role = ROLE_OBSERVER;
+    clientState[i].connectedAt = platformMillis();
+    clientState[i].rxBytes = 0;
+    clientState[i].txBytes = 0;
+    clientState[i].droppedBytes = 0;
+    clientState[i].filteredBytes = 0;
+    clientState[i].filter.clear();
+    clientState[i].stampNext = toClientSeq;
+    clientState[i].latency[LATENCY_UART_TO_TCP].reset();
+    clientState[i].latency[LATENCY_TCP_TO_UART].reset();
+    inet_ntop(AF_INET, &addr.sin_addr, clientState[i].ip, sizeof(clientState[i].ip));
+    platformClientEvent(i, true);
+    bridgeElectPrimary();
+  }
+}
+
+// with roles disabled every client writes to the UART. Otherwise one primary
+// writes and the rest observe: the oldest client, or the first one from
+// primaryIp when that is set.
+void bridgeElectPrimary()
+{
+  int primary = -1;
+  int candidate = -1;
+  for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+  {
+    if (clientFd[cln] < 0)
+    {
+      clientState[cln].role = ROLE_OBSERVER;
+      continue;
+    }
+    if (!cfg.clientRoles)
+    {
+      clientState[cln].role = ROLE_PRIMARY;
+      continue;
+    }
+    if (clientState[cln].role == ROLE_PRIMARY)
+    {
+      primary = cln;
+      continue;
+    }
+    if (strlen(cfg.primaryIp) != 0 && strcmp(cfg.primaryIp, clientState[cln].ip) != 0)
+      continue;
+    if (candidate < 0 || (int32_t)(clientState[cln].connectedAt - clientState[candidate].connectedAt) < 0)
+      candidate = cln;
+  }
+  if (cfg.clientRoles && primary < 0 && candidate >= 0)
+  {
+    clientState[candidate].role = ROLE_PRIMARY;
+    bridgeLog("Client %d (%s) is primary", candidate, clientState[candidate].ip);
+  }
+}
+
+bool bridgeClientInfo(int cln, BridgeClientInfo &info)
+{
+  if (cln < 0 || cln >= MAX_SOCKET_CLIENTS)
+    return false;
+  info.connected = clientFd[cln] >= 0;
+  info.role = clientState[cln].role;
+  memcpy(info.ip, clientState[cln].ip, sizeof(info.ip));
+  info.rxBytes = clientState[cln].rxBytes;
+  info.txBytes = clientState[cln].txBytes;
+  info.droppedBytes = clientState[cln].droppedBytes;
+  info.filteredBytes = clientState[cln].filteredBytes;
+  return true;
+}
+
+void bridgeRoleStats(int role, BridgeRoleStats &stats)
+{
+  stats = roleStats[role == ROLE_PRIMARY ? ROLE_PRIMARY : ROLE_OBSERVER];
+}
+
+bool bridgeLatency(int cln, int dir, LatencyHistogram &hist)
+{
+  if (dir != LATENCY_UART_TO_TCP && dir != LATENCY_TCP_TO_UART)
+    return false;
+  if (cln >= MAX_SOCKET_CLIENTS)
+    return false;
+  hist = latencySnapshot[cln < 0 ? MAX_SOCKET_CLIENTS : cln][dir];
+  return true;
+}
+
+// the histograms are only written by the bridge task, so it copies them
+// itself; false if it did not get to it within timeoutMs
+bool bridgeLatencySnapshot(uint32_t timeoutMs)
+{
+  latencySnapshotPending = true;
+  uint32_t start = platformMillis();
+  while (latencySnapshotPending)
+  {
+    if (platformMillis() - start >= timeoutMs)
+      return false;
+    platformSleep(1);
+  }
+  return true;
+}
+
+void bridgeLatencyCopy()
+{
+  for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+  {
+    latencySnapshot[cln][LATENCY_UART_TO_TCP] = clientState[cln].latency[LATENCY_UART_TO_TCP];
+    latencySnapshot[cln][LATENCY_TCP_TO_UART] = clientState[cln].latency[LATENCY_TCP_TO_UART];
+  }
+  latencySnapshot[MAX_SOCKET_CLIENTS][LATENCY_UART_TO_TCP] = latency[LATENCY_UART_TO_TCP];
+  latencySnapshot[MAX_SOCKET_CLIENTS][LATENCY_TCP_TO_UART] = latency[LATENCY_TCP_TO_UART];
+  latencySnapshotPending = false;
+}
+
+// other tasks only ask, the bridge task clears at the start of its next pass
+void bridgeLatencyReset()
+{
+  latencyResetPending = true;
+}
+
+void bridgeLatencyClear()
+{
+  latencyResetPending = false;
+  for (int dir = 0; dir < 2; dir++)
+  {
+    latency[dir].reset();
+    for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+    {
+      clientState[cln].latency[dir].reset();
+    }
+  }
+}
+
+void bridgeStampToClients(uint32_t readers)
+{
+  LatencyStamp &stamp = toClientStamps[toClientSeq % LATENCY_STAMPS];
+  stamp.end = broadcastRing.head();
+  stamp.at = serialRxAt;
+  stamp.clients = readers;
+  toClientSeq++;
+}
+
+void bridgeTimeToClient(int cln)
+{
+  BridgeClient &state = clientState[cln];
+  // stamps overwritten before the client got there are not timed
+  if (toClientSeq - state.stampNext > LATENCY_STAMPS)
+  {
+    state.stampNext = toClientSeq - LATENCY_STAMPS;
+  }
+  uint32_t now = platformMicros();
+  while (state.stampNext != toClientSeq)
+  {
+    const LatencyStamp &stamp = toClientStamps[state.stampNext % LATENCY_STAMPS];
+    if ((ptrdiff_t)(state.cursor - stamp.end) < 0)
+      break;
+    if (stamp.clients & (1UL << cln))
+    {
+      state.latency[LATENCY_UART_TO_TCP].record(now - stamp.at);
+      latency[LATENCY_UART_TO_TCP].record(now - stamp.at);
+    }
+    state.stampNext++;
+  }
+}
+
+void bridgeStampToUart(int cln)
+{
+  if (toUartHead - toUartTail >= LATENCY_STAMPS)
+    return;
+  LatencyStamp &stamp = toUartStamps[toUartHead % LATENCY_STAMPS];
+  stamp.end = netRing.writePos();
+  stamp.at = clientState[cln].rxAt;
+  stamp.clients = 1UL << cln;
+  toUartHead++;
+}
+
+void bridgeTimeToUart()
+{
+  size_t written = netRing.readPos();
+  uint32_t now = platformMicros();
+  while (toUartTail != toUartHead)
+  {
+    const LatencyStamp &stamp = toUartStamps[toUartTail % LATENCY_STAMPS];
+    if ((ptrdiff_t)(written - stamp.end) < 0)
+      break;
+    latency[LATENCY_TCP_TO_UART].record(now - stamp.at);
+    for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+    {
+      if (stamp.clients & (1UL << cln))
+      {
+        clientState[cln].latency[LATENCY_TCP_TO_UART].record(now - stamp.at);
+      }
+    }
+    toUartTail++;
+  }
+}
+
+// answers the bridge control SREQ, only the asking client sees the SRSP
+void bridgeControl(int cln, const uint8_t *frame, size_t len)
+{
+  // the declared data must be there in full, a short frame gets no answer
+  if (len < ZNP_HEADER_LEN + 1 || len < (size_t)frame[1] + ZNP_HEADER_LEN + 1)
+    return;
+  uint8_t status = 1;
+  if (frame[3] == ZNP_BRIDGE_SET_FILTER && clientState[cln].filter.set(frame + ZNP_HEADER_LEN, frame[1]))
+  {
+    status = 0;
+    bridgeLog("Client %d (%s) AREQ filter %d entries", cln, clientState[cln].ip, clientState[cln].filter.count());
+  }
+  uint8_t rsp[ZNP_HEADER_LEN + 2] = {ZNP_SOF, 1, ZNP_SRSP | ZNP_BRIDGE_SUBSYSTEM, frame[3], status, 0};
+  rsp[ZNP_HEADER_LEN + 1] = znpFcs(rsp + 1, ZNP_HEADER_LEN);
+  bridgeBroadcast(rsp, sizeof(rsp), 1UL << cln);
+}
+
+// returns false if the client was disconnected
+bool bridgeForward(int cln, ZnpFramer &framer)
+{
+  BridgeClient &state = clientState[cln];
+  if (framer.type() == ZnpFramer::UNIT_FRAME && framer.data()[2] == (ZNP_SREQ | ZNP_BRIDGE_SUBSYSTEM))
+  {
+    bridgeControl(cln, framer.data(), framer.length());
+    framer.release();
+    return true;
+  }
+
+  if (state.role == ROLE_OBSERVER)
+  { // observers only get the mirrored stream, their writes never reach the UART
+    state.droppedBytes += framer.length();
+    roleStats[ROLE_OBSERVER].droppedBytes += framer.length();
+    framer.release();
+    if (cfg.observerRefuse)
+    {
+      roleStats[ROLE_OBSERVER].refused++;
+      bridgeLog("Observer %d (%s) wrote, disconnected", cln, state.ip);
+      bridgeClose(cln);
+      return false;
+    }
+    return true;
+  }
+
+  netRing.write(framer.data(), framer.length());
+  bridgeStampToUart(cln);
+  // print to web console
+  platformTrace(true, cln, framer.data(), framer.length());
+  state.rxBytes += framer.length();
+  roleStats[ROLE_PRIMARY].rxBytes += framer.length();
+  if (framer.type() == ZnpFramer::UNIT_FRAME)
+  {
+    sreqTracker.request(cln, framer.data(), framer.length(), platformMillis());
+  }
+  framer.release();
+  return true;
+}
+
+// forwards whole units (ZNP frames, or raw runs split on idle gaps) from one
+// client into netRing, so writes from different clients never interleave
+// on the UART. Returns false once netRing is too full for the next unit.
+bool bridgeWriterRound(int cln)
+{
+  BridgeClient &state = clientState[cln];
+  int budget = cfg.writerBudget;
+
+  while (budget > 0)
+  {
+    ZnpFramer &framer = state.framer;
+    if (framer.ready())
+    {
+      if (netRing.space() < framer.length())
+        return false;
+      budget -= framer.length();
+      if (!bridgeForward(cln, framer))
+        return true;
+      continue;
+    }
+    if (state.inPos < state.inLen)
+    {
+      state.inPos += framer.push(state.in + state.inPos, state.inLen - state.inPos, platformMicros());
+      continue;
+    }
+    // read from LAN
+    int n = recv(clientFd[cln], state.in, sizeof(state.in), MSG_DONTWAIT);
+    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK))
+    {
+      bridgeClose(cln);
+      return true;
+    }
+    if (n < 0)
+      break;
+    state.inLen = n;
+    state.inPos = 0;
+    state.rxAt = platformMicros();
+  }
+
+  if (state.framer.poll(platformMicros()) && netRing.space() >= state.framer.length())
+  {
+    bridgeForward(cln, state.framer);
+  }
+  return true;
+}
+
+void bridgeNetToSerial()
+{
+  // round-robin over the clients, each gets writerBudget bytes per round
+  int first = writerNext;
+  writerNext = (writerNext + 1) % MAX_SOCKET_CLIENTS;
+  for (int n = 0; n < MAX_SOCKET_CLIENTS; n++)
+  {
+    int cln = (first + n) % MAX_SOCKET_CLIENTS;
+    if (clientFd[cln] >= 0 && !bridgeWriterRound(cln))
+      break;
+  }
+
+  while (!netRing.isEmpty())
+  { // send to Zigbee, only as much as the TX FIFO takes without blocking
+    size_t span;
+    const uint8_t *ptr = netRing.readPtr(span);
+    size_t n = platformUartWrite(ptr, span);
+    if (n == 0)
+      break;
+    netRing.consume(n);
+  }
+  bridgeTimeToUart();
+}
+
+void bridgeSlowClient(int cln, size_t lag)
+{
+  platformSlowClient(cln, clientState[cln].ip, lag, cfg.slowClientDrop);
+
+  if (cfg.slowClientDrop)
+  {
+    bridgeLog("Client %d (%s) %u bytes behind, dropped", cln, clientState[cln].ip, (unsigned)lag);
+    bridgeClose(cln);
+  }
+  else
+  {
+    // keep the observer but resync it to the live edge
+    bridgeLog("Client %d (%s) %u bytes behind, skipped", cln, clientState[cln].ip, (unsigned)lag);
+    clientState[cln].skipped += lag;
+    clientState[cln].slow = true;
+    clientState[cln].cursor = broadcastRing.head();
+    clientState[cln].stampNext = toClientSeq;
+  }
+}
+
+// returns false if nobody took the data
+bool bridgeBroadcast(const uint8_t *data, size_t len, uint32_t readers)
+{
+  uint32_t connected = 0;
+  for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+  {
+    if (clientFd[cln] < 0)
+      continue;
+    connected |= 1UL << cln;
+    if (!(readers & (1UL << cln)))
+    {
+      clientState[cln].filteredBytes += len;
+    }
+  }
+  // routed SRSPs and control answers show up under their client
+  int client = -1;
+  if (readers != BroadcastRing::ALL_READERS && readers != 0 && (readers & (readers - 1)) == 0)
+  {
+    client = __builtin_ctz(readers);
+  }
+  if (connected && !(readers & connected))
+  { // nobody wants it, keep it out of the ring
+    platformTrace(false, client, data, len);
+    return false;
+  }
+
+  for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+  {
+    if (clientFd[cln] < 0)
+    {
+      clientState[cln].cursor = broadcastRing.head() + len;
+      continue;
+    }
+    size_t lag = broadcastRing.lag(clientState[cln].cursor);
+    if (lag + len > (size_t)cfg.clientLag)
+    {
+      bridgeSlowClient(cln, lag);
+    }
+  }
+  broadcastRing.write(data, len, readers);
+  // print to web console
+  platformTrace(false, client, data, len);
+  return true;
+}
+
+void bridgeSendToClients()
+{ // send to LAN without blocking, whatever doesn't fit waits at the cursor
+  for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+  {
+    int fd = clientFd[cln];
+    if (fd < 0)
+      continue;
+
+    // step over frames routed or filtered away from this client
+    clientState[cln].cursor = broadcastRing.skip(clientState[cln].cursor, cln);
+    const uint8_t *ptr[2];
+    size_t span[2];
+    int count = broadcastRing.spans(clientState[cln].cursor, cln, ptr, span);
+    if (count == 0)
+      continue;
+
+    struct iovec iov[2];
+    for (int i = 0; i < count; i++)
+    {
+      iov[i].iov_base = (void *)ptr[i];
+      iov[i].iov_len = span[i];
+    }
+    struct msghdr msg = {};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = count;
+
+    ssize_t sent = sendmsg(fd, &msg, MSG_DONTWAIT);
+    if (sent > 0)
+    {
+      clientState[cln].cursor = broadcastRing.skip(clientState[cln].cursor + sent, cln);
+      clientState[cln].txBytes += sent;
+      roleStats[clientState[cln].role].txBytes += sent;
+      bridgeTimeToClient(cln);
+    }
+    else if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+      bridgeLog("Client %d send error %d", cln, errno);
+      bridgeClose(cln);
+    }
+  }
+
+  // ranges every client has passed no longer need their reader masks
+  size_t oldest = broadcastRing.head();
+  for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+  {
+    if (clientFd[cln] >= 0 && broadcastRing.lag(clientState[cln].cursor) > broadcastRing.lag(oldest))
+      oldest = clientState[cln].cursor;
+  }
+  broadcastRing.release(oldest);
+}
+
+void bridgeFlushFrame()
+{
+  if (serialFramer.type() == ZnpFramer::UNIT_BAD_FCS)
+  {
+    bridgeLog("ZNP frame with bad FCS forwarded");
+  }
+  uint32_t readers = BroadcastRing::ALL_READERS;
+  const uint8_t *frame = serialFramer.data();
+  if (cfg.srspRouting && serialFramer.type() == ZnpFramer::UNIT_FRAME)
+  {
+    int target = sreqTracker.response(frame, serialFramer.length(), platformMillis());
+    if (target >= 0)
+    {
+      readers = 1UL << target;
+    }
+  }
+  if (serialFramer.type() == ZnpFramer::UNIT_FRAME && ZNP_TYPE(frame[2]) == ZNP_AREQ)
+  {
+    readers = 0;
+    for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+    {
+      if (clientState[cln].filter.accepts(frame[2], frame[3]))
+      {
+        readers |= 1UL << cln;
+      }
+    }
+    if (readers == (1UL << MAX_SOCKET_CLIENTS) - 1)
+    {
+      readers = BroadcastRing::ALL_READERS;
+    }
+  }
+  if (bridgeBroadcast(serialFramer.data(), serialFramer.length(), readers))
+  {
+    bridgeStampToClients(readers);
+  }
+  serialFramer.release();
+}
+
+void bridgeSerialToNet()
+{
+  if (platformUartOverflow())
+  {
+    bridgeLog("UART RX overflow, bytes lost in driver");
+  }
+
+  size_t avail;
+  while ((avail = platformUartAvailable()) > 0)
+  { // read from Zigbee straight into the ring
+    size_t span;
+    uint8_t *ptr = serialRing.writePtr(span);
+    if (span == 0)
+      break;
+    size_t n = platformUartRead(ptr, std::min(span, avail));
+    if (n == 0)
+      break;
+    serialRing.commit(n);
+    serialRxAt = platformMicros();
+  }
+
+  while (!serialRing.isEmpty())
+  {
+    size_t span;
+    const uint8_t *ptr = serialRing.readPtr(span);
+    if (!cfg.znpFramer)
+    {
+      span = std::min(span, (size_t)ZNP_MAX_FRAME);
+      if (bridgeBroadcast(ptr, span, BroadcastRing::ALL_READERS))
+      {
+        bridgeStampToClients(BroadcastRing::ALL_READERS);
+      }
+      serialRing.consume(span);
+      continue;
+    }
+    serialRing.consume(serialFramer.push(ptr, span, platformMicros()));
+    if (serialFramer.ready())
+    {
+      bridgeFlushFrame();
+    }
+  }
+
+  if (cfg.znpFramer && serialFramer.poll(platformMicros()))
+  {
+    bridgeFlushFrame();
+  }
+
+  bridgeSendToClients();
+}
+
+// one pass of the bridge: wait for traffic, then move it both ways
+void bridgeRun()
+{
+  if (latencyResetPending)
+  {
+    bridgeLatencyClear();
+  }
+  if (latencySnapshotPending)
+  {
+    bridgeLatencyCopy();
+  }
+  bridgeWait();
+  bridgeAccept();
+  bridgeNetToSerial();
+  bridgeSerialToNet();
+}
@@ -0,0 +1,69 @@
+#ifndef BRIDGE_H_
+#define BRIDGE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "histogram.h"
+
+#define ROLE_PRIMARY 0
+#define ROLE_OBSERVER 1
+
+// latency directions: UART RX to TCP TX and TCP RX to UART TX
+#define LATENCY_UART_TO_TCP 0
+#define LATENCY_TCP_TO_UART 1
+
+// settings the bridge core runs with, copied at bridgeBegin()
+struct BridgeConfig
+{
+  int socketPort;
+  int serialRingSize;
+  int netRingSize;
+  bool znpFramer;
+  int framerTimeout;
+  int clientLag;
+  bool slowClientDrop;
+  int writerBudget;
+  bool clientRoles;
+  char primaryIp[16];
+  bool observerRefuse;
+  bool srspRouting;
+};
+
+struct BridgeClientInfo
+{
+  bool connected;
+  int role;
+  char ip[16];
+  uint32_t rxBytes;
+  uint32_t txBytes;
+  uint32_t droppedBytes;
+  uint32_t filteredBytes;
+};
+
+struct BridgeRoleStats
+{
+  uint32_t rxBytes;
+  uint32_t txBytes;
+  uint32_t droppedBytes;
+  uint32_t refused;
+};
+
+// bridge core (bridge.cpp), portable, talks to the target through platform.h
+bool bridgeBegin(const BridgeConfig &config);
+void bridgeRun();
+bool bridgeClientInfo(int cln, BridgeClientInfo &info);
+void bridgeRoleStats(int role, BridgeRoleStats &stats);
+// one client since it connected, or all clients (cln -1) since boot or
+// reset, as of the last bridgeLatencySnapshot()
+bool bridgeLatencySnapshot(uint32_t timeoutMs);
+bool bridgeLatency(int cln, int dir, LatencyHistogram &hist);
+void bridgeLatencyReset();
+
+// firmware side (platform_esp32.cpp)
+void bridgeStart();
+void bridgeLoop();
+#ifdef ARDUINO
+String bridgeMetricsJson(bool withBuckets);
+#endif
+
+#endif
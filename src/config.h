@@ -1,10 +1,16 @@
 #ifndef CONFIG_H_
 #define CONFIG_H_
 
+// the bridge core also builds natively (env:native), where only the
+// defines below are available
+#ifdef ARDUINO
 #include <Arduino.h>
-#include <CircularBuffer.h>
 
 #include "version.h"
+#endif
+
+//ZRTS/ZCTS - UART flow control pins, -1 when not wired on the board;
+//configSerial.json's rtsPin/ctsPin override them
 
 //---DEFAULT---
 //LAN
@@ -19,6 +25,8 @@
 #define FLASH_ZIGBEE_0 22
 #define ZRXD_0 23
 #define ZTXD_0 19
+#define ZRTS_0 -1
+#define ZCTS_0 -1
 
 //---WT32-ETH01---
 //LAN
@@ -33,6 +41,8 @@
 #define FLASH_ZIGBEE_1 32
 #define ZRXD_1 5
 #define ZTXD_1 17
+#define ZRTS_1 -1
+#define ZCTS_1 -1
 
 //---TTGO T-Internet-POE---
 //LAN
@@ -47,6 +57,8 @@
 #define FLASH_ZIGBEE_2 32
 #define ZRXD_2 36
 #define ZTXD_2 4
+#define ZRTS_2 -1
+#define ZCTS_2 -1
 
 //---China-GW---
 //LAN
@@ -61,6 +73,8 @@
 #define FLASH_ZIGBEE_3 14
 #define ZRXD_3 32
 #define ZTXD_3 33
+#define ZRTS_3 -1
+#define ZCTS_3 -1
 
 //---Omilex EPS32-POE---
 //LAN
@@ -75,6 +89,8 @@
 #define FLASH_ZIGBEE_4 32
 #define ZRXD_4 36
 #define ZTXD_4 4
+#define ZRTS_4 -1
+#define ZCTS_4 -1
 
 #define PRODUCTION 1
 #define FLASH 0
@@ -83,12 +99,121 @@
 #define BAUD_RATE 38400
 #define TCP_LISTEN_PORT 9999
 
+//bridge task, runs above loop() (priority 1) so web and MQTT can't delay it
+#define BRIDGE_TASK_CORE 1
+#define BRIDGE_TASK_PRIORITY 5
+#define BRIDGE_TASK_STACK 4096
+#define BRIDGE_IDLE_MS 50
+
+//default ring sizes, rounded up to a power of two (256..32768)
+#define SERIAL_RING_SIZE 4096
+#define NET_RING_SIZE 4096
+
+//ZNP frame reassembly, non-frame bytes are flushed after this idle time
+#define FRAMER_TIMEOUT_MS 2
+
+//how far a socket client may fall behind the UART stream before it is dropped or resynced
+#define CLIENT_LAG 8192
+
+//bytes each socket client may forward to the UART per round-robin round
+#define WRITER_BUDGET 512
+
+//an SREQ without SRSP after this long no longer routes its response
+#define SREQ_TIMEOUT_MS 6000
+
+//units in flight per direction whose latency is measured, more are not timed
+#define LATENCY_STAMPS 32
+
+//Zigbee UART driver: RX buffer (bytes), FIFO-full interrupt threshold and
+//RX idle timeout (symbols), RX FIFO level that deasserts RTS
+#define UART_RX_BUFFER 1024
+#define UART_RX_FIFO_FULL 120
+#define UART_RX_TIMEOUT 2
+#define UART_RTS_THRESHOLD 64
+
+//web console, binary records of traffic and messages (bytes, power of two);
+//kept in RTC slow memory over resets (8 KB, shared), /lastlog shows what
+//the previous boot left and at most LASTLOG_MQTT_MAX bytes of it go to MQTT
+#define LOG_RING_SIZE 2048
+#define LASTLOG_MQTT_MAX 1024
+
+//levelled messages: arguments kept per message, longest text of a
+//formatted line, USB serial and syslog thresholds
+#define LOG_ARGS 6
+#define LOG_EVENT_TEXT 88
+#define LOG_LINE_MAX 192
+#ifdef DEBUG
+#define LOG_SERIAL_LEVEL LOG_LEVEL_DEBUG
+#else
+#define LOG_SERIAL_LEVEL LOG_LEVEL_NONE
+#endif
+#define LOG_SYSLOG_LEVEL LOG_LEVEL_INFO
+
+//per module ceiling, anything above compiles to nothing; override with -D
+#ifdef DEBUG
+#define LOG_LEVEL_DEFAULT LOG_LEVEL_DEBUG
+#else
+#define LOG_LEVEL_DEFAULT LOG_LEVEL_INFO
+#endif
+#ifndef LOG_LEVEL_MAIN
+#define LOG_LEVEL_MAIN LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_LEVEL_NET
+#define LOG_LEVEL_NET LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_LEVEL_WEB
+#define LOG_LEVEL_WEB LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_LEVEL_MQTT
+#define LOG_LEVEL_MQTT LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_LEVEL_BRIDGE
+#define LOG_LEVEL_BRIDGE LOG_LEVEL_DEFAULT
+#endif
+#ifndef LOG_LEVEL_ZIGBEE
+#define LOG_LEVEL_ZIGBEE LOG_LEVEL_DEFAULT
+#endif
+
+//console push over Server-Sent Events (/events): browsers served at once,
+//batch interval and idle keepalive
+#define EVENT_CLIENTS 2
+#define EVENT_TICK_MS 100
+#define EVENT_KEEPALIVE_MS 15000
+
+//web server task, on the network stack's core below lwIP and WiFi; how long
+//it sleeps between polls of the listening socket
+#define WEB_TASK_CORE 0
+#define WEB_TASK_PRIORITY 1
+#define WEB_TASK_STACK 8192
+#define WEB_TASK_IDLE_MS 5
+
+//pages are sent as HTTP chunks of up to this size
+#define PAGE_BUFFER 512
+
+//traffic capture streams (/capture.pcap) served at once, longest part of a
+//record sent as a packet (bytes, at least 256: the HTTP header shares its
+//buffer)
+#define CAPTURE_CLIENTS 1
+#define CAPTURE_SNAPLEN 512
+
+//remote syslog: queued records, longest message, how long a burst is
+//collected before sending, facility (local0) and sender task
+#define SYSLOG_QUEUE 32
+#define SYSLOG_MSG_MAX 128
+#define SYSLOG_BATCH_MS 200
+#define SYSLOG_FACILITY 16
+#define SYSLOG_PORT 514
+#define SYSLOG_TASK_CORE 0
+#define SYSLOG_TASK_PRIORITY 1
+#define SYSLOG_TASK_STACK 3072
+
 #define ETH_ERROR_TIME 30
 
 #define FORMAT_LITTLEFS_IF_FAILED true
 
 #define ONE_WIRE_BUS 33
 
+#ifdef ARDUINO
 struct ConfigSettingsStruct
 {
   bool enableWiFi;
@@ -105,9 +230,29 @@ struct ConfigSettingsStruct
   char ipGW[18];
   int serialSpeed;
   int socketPort;
-  bool disableWeb;
+  int serialRingSize;
+  int netRingSize;
+  bool znpFramer;
+  int framerTimeout;
+  int clientLag;
+  bool slowClientDrop;
+  int writerBudget;
+  bool clientRoles;
+  char primaryIp[16];
+  bool observerRefuse;
+  bool srspRouting;
+  bool flowControl;
+  bool flowControlActive;
+  int rtsPin;
+  int ctsPin;
+  int uartRxBuffer;
+  int uartRxFifoFull;
+  int uartRxTimeout;
   int refreshLogs;
   char hostname[50];
+  bool syslogEnable;
+  char syslogServer[50];
+  int syslogPort;
   bool connectedSocket[10];
   int connectedClients;
   bool wifiModeAP;
@@ -118,6 +263,8 @@ struct ConfigSettingsStruct
   bool emergencyWifi;
   int rstZigbeePin;
   int flashZigbeePin;
+  int rtsZigbeePin;
+  int ctsZigbeePin;
   bool mqttEnable;
   char mqttServer[50];
   IPAddress mqttServerIP;
@@ -128,6 +275,7 @@ struct ConfigSettingsStruct
   //bool mqttRetain;
   int mqttInterval;
   bool mqttDiscovery;
+  bool mqttMetrics;
   unsigned long mqttReconnectTime;
   unsigned long mqttHeartbeatTime;
   int tempOffset;
@@ -148,15 +296,8 @@ struct InfosStruct
   char flash[8];
 };
 
-typedef CircularBuffer<char, 1024> LogConsoleType;
-
 #define WL_MAC_ADDR_LENGTH 6
 
-#ifdef DEBUG
-#define DEBUG_PRINT(x) Serial.print(x)
-#define DEBUG_PRINTLN(x) Serial.println(x)
-#else
-#define DEBUG_PRINT(x)
-#define DEBUG_PRINTLN(x)
 #endif
+
 #endif
@@ -23,7 +23,7 @@ extern struct ConfigSettingsStruct ConfigSettings;
 void oneWireBegin()
 {
   sensor.begin();
-  DEBUG_PRINTLN(F("oneWire begin OK"));
+  LOGD(MAIN, "oneWire begin OK");
 }
 
 float oneWireRead()
@@ -31,20 +31,19 @@ float oneWireRead()
   if (ConfigSettings.board == 2 || ConfigSettings.board == 4) { //ttgo or omilex
     sensor.requestTemperatures();
     float tempC = sensor.getTempC();
-    DEBUG_PRINTLN(tempC);
+    LOGD(MAIN, "oneWire %.2f", tempC);
     if(tempC != -127 && tempC != 0.0)
     {
-      DEBUG_PRINTLN(F("oneWire OK"));
       return tempC;
     } 
     else
     {
-      DEBUG_PRINTLN(F("oneWire not found"));
+      LOGD(MAIN, "oneWire not found");
       return false;
     }
   }
   else {
-      DEBUG_PRINTLN(F("oneWire not supported"));
+      LOGD(MAIN, "oneWire not supported");
       return false;
   }
 }
@@ -141,92 +140,91 @@ void parse_ip_address(IPAddress &ip, const char *str)
 
 void zigbeeEnableBSL()
 {
-  printLogMsg("Zigbee BSL pin ON");
-  DEBUG_PRINTLN(F("Zigbee BSL pin ON"));
+  LOGI(ZIGBEE, "Zigbee BSL pin ON");
   digitalWrite(ConfigSettings.flashZigbeePin, 0);
   mqttPublishIo("enbl_bsl", "ON");
   delay(100);
 
-  printLogMsg("Zigbee RST pin ON");
-  DEBUG_PRINTLN(F("Zigbee RST pin ON"));
+  LOGI(ZIGBEE, "Zigbee RST pin ON");
   digitalWrite(ConfigSettings.rstZigbeePin, 0);
   mqttPublishIo("rst_zig", "ON");
   delay(250);
 
-  printLogMsg("Zigbee RST pin OFF");
-  DEBUG_PRINTLN(F("Zigbee RST pin OFF"));
+  LOGI(ZIGBEE, "Zigbee RST pin OFF");
   digitalWrite(ConfigSettings.rstZigbeePin, 1);
   mqttPublishIo("rst_zig", "OFF");
   delay(2000);
 
-  printLogMsg("Zigbee BSL pin OFF");
-  DEBUG_PRINTLN(F("Zigbee BSL pin OFF"));
+  LOGI(ZIGBEE, "Zigbee BSL pin OFF");
   digitalWrite(ConfigSettings.flashZigbeePin, 1);
   mqttPublishIo("enbl_bsl", "OFF");
-  printLogMsg("Now you can flash CC2652!");
+  LOGI(ZIGBEE, "Now you can flash CC2652!");
 }
 
 void zigbeeRestart()
 {
-  printLogMsg("Zigbee RST pin ON");
-  DEBUG_PRINTLN(F("Zigbee RST pin ON"));
+  LOGI(ZIGBEE, "Zigbee RST pin ON");
   digitalWrite(ConfigSettings.rstZigbeePin, 0);
   mqttPublishIo("rst_zig", "ON");
   delay(250);
-  printLogMsg("Zigbee RST pin OFF");
-  DEBUG_PRINTLN(F("Zigbee RST pin OFF"));
+  LOGI(ZIGBEE, "Zigbee RST pin OFF");
   digitalWrite(ConfigSettings.rstZigbeePin, 1);
   mqttPublishIo("rst_zig", "OFF");
 }
 
+// pins RTS/CTS flow control would use: rtsPin/ctsPin, or the board's
+// where they are -1; false unless both are wired
+bool zigbeeFlowControlPins(int rtsPin, int ctsPin, int &rts, int &cts)
+{
+  rts = rtsPin >= 0 ? rtsPin : ConfigSettings.rtsZigbeePin;
+  cts = ctsPin >= 0 ? ctsPin : ConfigSettings.ctsZigbeePin;
+  return rts >= 0 && cts >= 0;
+}
+
 void getDeviceID(String &devID)
 {
   String mac;
   mac = ETH.macAddress();
   if (strcmp(mac.c_str(), "00:00:00:00:00:00") != 0)
   {
-    DEBUG_PRINTLN(F("Using ETH mac to ID"));
-    DEBUG_PRINTLN(mac);
+    LOGD(MAIN, "Using ETH mac to ID %s", mac);
   }
   else
   {
     mac = WiFi.softAPmacAddress();
     if (strcmp(mac.c_str(), "") != 0)
     {
-      DEBUG_PRINTLN(F("Using WIFI mac to ID"));
-      DEBUG_PRINTLN(mac);
+      LOGD(MAIN, "Using WIFI mac to ID %s", mac);
     }
     else
     {
       mac = "00:00:00:12:34:56";
-      DEBUG_PRINTLN(F("Using zero mac to ID"));
-      DEBUG_PRINTLN(mac);
+      LOGD(MAIN, "Using zero mac to ID %s", mac);
     }
   }
   mac = mac.substring(9);
   mac = mac.substring(0, 2) + mac.substring(3, 5);
   devID = "ZigStarGW-" + String(mac);
-  DEBUG_PRINTLN(devID);
+  LOGD(MAIN, "%s", devID);
 }
 
 void writeDefultConfig(const char *path, String StringConfig)
 {
-  DEBUG_PRINTLN(path);
-  DEBUG_PRINTLN(F("failed open. try to write defaults"));
-  DEBUG_PRINTLN(StringConfig);
+  LOGW(MAIN, "%s failed open. try to write defaults", path);
 
-  DynamicJsonDocument doc(1024);
+  DynamicJsonDocument doc(2048);
   deserializeJson(doc, StringConfig);
 
   File configFile = LittleFS.open(path, FILE_WRITE);
   if (!configFile)
   {
-    DEBUG_PRINTLN(F("failed write"));
+    LOGE(MAIN, "%s failed write", path);
     //return false;
   }
   else
   {
-    serializeJson(doc, configFile);
+    size_t size = serializeJson(doc, configFile);
+    LOGD(MAIN, "%s written, %u bytes", path, (unsigned)size);
   }
   configFile.close();
 }
@@ -257,8 +255,7 @@ String hexToDec(String hexString)
 
 void saveEmergencyWifi(bool state)
 { 
-  DEBUG_PRINT(F("saveEmergencyWifi "));
-  DEBUG_PRINTLN(state);
+  LOGD(NET, "saveEmergencyWifi %d", state);
 
   const char *path = "/config/system.json";
   DynamicJsonDocument doc(1024);
@@ -299,7 +296,7 @@ void resetSettings()
 
   String deviceID = "ZigStarGW";
   //getDeviceID(deviceID);
-  String StringConfig = "{\"hostname\":\"" + deviceID + "\",\"disableWeb\":0,\"refreshLogs\":1000,\"webAuth\":0,\"webUser\":"",\"webPass\":""}";
+  String StringConfig = "{\"hostname\":\"" + deviceID + "\",\"refreshLogs\":1000,\"webAuth\":0,\"webUser\":\"\",\"webPass\":\"\",\"syslogEnable\":0,\"syslogServer\":\"\",\"syslogPort\":" + String(SYSLOG_PORT) + "}";
 
   writeDefultConfig(path, StringConfig);
   ESP.restart();
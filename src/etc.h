@@ -17,6 +17,7 @@ float getCPUtemp(bool clear = false);
 //void parse_ip_address(IPAddress &ip, const char *str)
 void zigbeeEnableBSL();
 void zigbeeRestart();
+bool zigbeeFlowControlPins(int rtsPin, int ctsPin, int &rts, int &cts);
 
 void getDeviceID(String &devID);
 void writeDefultConfig(const char *path, String StringConfig);
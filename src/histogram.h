@@ -0,0 +1,71 @@
+#ifndef HISTOGRAM_H_
+#define HISTOGRAM_H_
+
+#include <stdint.h>
+#include <string.h>
+
+// Fixed log2 buckets of microseconds: bucket 0 counts 0-1 us, bucket n
+// counts up to 2^n us, the last one everything above. Recording is a few
+// instructions, so it can run per frame on the bridge task; other tasks
+// read copies the bridge task made.
+class LatencyHistogram
+{
+public:
+  static const int BUCKETS = 24;
+
+  void record(uint32_t us)
+  {
+    int bucket = 0;
+    while (bucket < BUCKETS - 1 && us > (1UL << bucket))
+      bucket++;
+    buckets[bucket]++;
+    count++;
+    sum += us;
+    if (us > max)
+      max = us;
+  }
+
+  void reset()
+  {
+    memset(this, 0, sizeof(*this));
+  }
+
+  void add(const LatencyHistogram &other)
+  {
+    for (int i = 0; i < BUCKETS; i++)
+    {
+      buckets[i] += other.buckets[i];
+    }
+    count += other.count;
+    sum += other.sum;
+    if (other.max > max)
+      max = other.max;
+  }
+
+  // upper bound of the bucket holding the given percentile, capped at max
+  uint32_t percentile(uint32_t pct) const
+  {
+    if (count == 0)
+      return 0;
+    uint64_t rank = ((uint64_t)count * pct + 99) / 100;
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; i++)
+    {
+      seen += buckets[i];
+      if (seen >= rank)
+        return (i < BUCKETS - 1 && (1UL << i) < max) ? (1UL << i) : max;
+    }
+    return max;
+  }
+
+  uint32_t mean() const { return count ? sum / count : 0; }
+
+  static uint32_t bucketLimit(int bucket) { return 1UL << bucket; }
+
+  uint32_t buckets[BUCKETS];
+  uint32_t count;
+  uint32_t max;
+  uint64_t sum;
+};
+
+#endif
@@ -1,32 +1,565 @@
 #include <Arduino.h>
-#include "log.h"
+#include <esp_attr.h>
+#include <esp_ota_ops.h>
+#include <esp_rom_crc.h>
+#include <soc/soc_memory_types.h>
 #include "config.h"
+#include "log.h"
+#include "ring.h"
+#include "syslog.h"
+#include "znp.h"
+
+// traffic is kept as it went over the wire, hex only costs anything when
+// somebody looks at the console
+RecordRing logRing;
+
+// the console is written from the bridge task and read from the web task
+SemaphoreHandle_t logMutex = NULL;
+
+// The ring's bytes live in RTC slow memory, which keeps them over every
+// reset but power-on. logKeep tells the next boot where the records were;
+// a panic or watchdog reset runs no code of ours, so it is kept current
+// with every record, and never points at bytes being overwritten. Its CRC
+// only covers itself, the records are checked by walking their lengths.
+#define LOG_KEEP_MAGIC 0x4B474F4C
+
+struct LogKeep
+{
+  uint32_t magic;
+  // messages point at format strings, only valid for the same image
+  uint8_t build[8];
+  uint32_t first;
+  uint32_t end;
+  uint32_t crc;
+};
+
+static_assert((LOG_RING_SIZE & (LOG_RING_SIZE - 1)) == 0, "LOG_RING_SIZE must be a power of two");
+RTC_NOINIT_ATTR LogKeep logKeep;
+RTC_NOINIT_ATTR uint8_t logKeepData[LOG_RING_SIZE];
 
-LogConsoleType logConsole;
+// what the previous boot left, copied out before the ring is reused
+RecordRing lastRing;
+bool lastSameBuild = false;
+esp_reset_reason_t resetReason = ESP_RST_UNKNOWN;
 
-void logPush(char c)
+#if LOG_SERIAL_LEVEL > LOG_LEVEL_NONE
+// USB serial is one more reader of the ring, fed by the task that called
+// logBegin(), the one running setup() and loop()
+TaskHandle_t serialTask = NULL;
+size_t serialSeq = 0;
+char serialLine[LOG_LINE_MAX];
+size_t serialLen = 0;
+size_t serialSent = 0;
+#endif
+
+uint32_t logKeepCrc()
 {
-  logConsole.push(c);
+  return esp_rom_crc32_le(0, (const uint8_t *)&logKeep, offsetof(LogKeep, crc));
 }
 
-String logPrint()
+// after every change to the ring, under logLock()
+void logKeepSync()
 {
+  logKeep.first = logRing.first();
+  logKeep.end = logRing.end();
+  logKeep.crc = logKeepCrc();
+}
 
-  String buff = "";
+void logKeepRestore()
+{
+  resetReason = esp_reset_reason();
+  if (logKeep.magic != LOG_KEEP_MAGIC || logKeep.crc != logKeepCrc())
+    return;
+  uint8_t *copy = (uint8_t *)malloc(sizeof(logKeepData));
+  if (!copy)
+    return;
+  memcpy(copy, logKeepData, sizeof(logKeepData));
+  lastRing.begin(copy, sizeof(logKeepData));
+  if (!lastRing.restore(logKeep.first, logKeep.end, sizeof(LogHeader)))
+  {
+    lastRing.restart(0);
+    return;
+  }
+  lastSameBuild = memcmp(logKeep.build, esp_ota_get_app_description()->app_elf_sha256, sizeof(logKeep.build)) == 0;
+}
 
-  if (logConsole.isEmpty()) {
-    return "";
-  } else {
-    for (decltype(logConsole)::index_t i = 0; i < logConsole.size() - 1; i++) {
-      buff += logConsole[i];
+void logBegin()
+{
+  logMutex = xSemaphoreCreateRecursiveMutex();
+  logKeepRestore();
+  logRing.begin(logKeepData, sizeof(logKeepData));
+  // a console still holding a seq from before a reboot sees an overrun
+  logRing.restart(esp_random());
+  logKeep.magic = LOG_KEEP_MAGIC;
+  memcpy(logKeep.build, esp_ota_get_app_description()->app_elf_sha256, sizeof(logKeep.build));
+  logKeepSync();
+#if LOG_SERIAL_LEVEL > LOG_LEVEL_NONE
+  serialTask = xTaskGetCurrentTaskHandle();
+  serialSeq = logRing.first();
+#endif
+}
+
+void logLock()
+{
+  if (logMutex)
+  {
+    xSemaphoreTakeRecursive(logMutex, portMAX_DELAY);
+  }
+}
+
+void logUnlock()
+{
+  if (logMutex)
+  {
+    xSemaphoreGiveRecursive(logMutex);
+  }
+}
+
+void logRecord(uint8_t type, uint8_t client, const uint8_t *data, size_t len)
+{
+  LogHeader header;
+  header.time = millis();
+  header.type = type;
+  header.client = client;
+  logLock();
+  if (logRing.makeRoom(sizeof(header) + len))
+  {
+    // the records dropped for this one go out of logKeep before their
+    // bytes are overwritten, the new one comes in once it is complete
+    logKeep.first = logRing.first();
+    logKeep.crc = logKeepCrc();
+    logRing.push(&header, sizeof(header), data, len);
+    logKeepSync();
+  }
+  logUnlock();
+}
+
+const char *logLevelName(uint8_t level)
+{
+  static const char *const names[] = {"none", "error", "warn", "info", "debug"};
+  return level <= LOG_LEVEL_DEBUG ? names[level] : "?";
+}
+
+const char *logModuleName(uint8_t module)
+{
+  static const char *const names[LOG_MODULES] = {"main", "net", "web", "mqtt", "bridge", "zigbee"};
+  return module < LOG_MODULES ? names[module] : "?";
+}
+
+void logArgWord(LogEvent &event, uint8_t type, uint32_t value)
+{
+  if (event.argc >= LOG_ARGS)
+    return;
+  event.types[event.argc] = type;
+  event.args[event.argc] = value;
+  event.argc++;
+}
+
+// strings are the one thing copied, they may not outlive the call
+void logArg(LogEvent &event, const char *value)
+{
+  if (!value)
+  {
+    value = "(null)";
+  }
+  size_t room = sizeof(event.text) - event.textLen;
+  if (room == 0)
+  {
+    // the last string's terminator, prints as empty
+    logArgWord(event, LOG_ARG_STR, event.textLen - 1);
+    return;
+  }
+  size_t n = strnlen(value, room - 1);
+  memcpy(event.text + event.textLen, value, n);
+  event.text[event.textLen + n] = 0;
+  logArgWord(event, LOG_ARG_STR, event.textLen);
+  event.textLen += n + 1;
+}
+
+void logArg(LogEvent &event, const __FlashStringHelper *value)
+{
+  logArg(event, (const char *)value);
+}
+
+void logArg(LogEvent &event, const String &value)
+{
+  logArg(event, value.c_str());
+}
+
+void logArg(LogEvent &event, const IPAddress &value)
+{
+  logArgWord(event, LOG_ARG_IP, (uint32_t)value);
+}
+
+void logArg(LogEvent &event, double value)
+{
+  float f = value;
+  uint32_t word;
+  memcpy(&word, &f, sizeof(word));
+  logArgWord(event, LOG_ARG_FLOAT, word);
+}
+
+void logCommit(LogEvent &event)
+{
+  size_t len = offsetof(LogEvent, text) + event.textLen;
+  logRecord(LOG_MSG, LOG_NO_CLIENT, (const uint8_t *)&event, len);
+  if (event.level <= LOG_SYSLOG_LEVEL)
+  {
+    syslogPush(event, len);
+  }
+#if LOG_SERIAL_LEVEL > LOG_LEVEL_NONE
+  if (xTaskGetCurrentTaskHandle() == serialTask)
+  {
+    logSerialLoop();
+  }
+#endif
+}
+
+void logEventRead(LogEvent &event, const uint8_t *data, size_t len)
+{
+  memcpy(&event, data, len < sizeof(event) ? len : sizeof(event));
+  if (len < offsetof(LogEvent, text))
+  {
+    event.argc = 0;
+  }
+  if (event.argc > LOG_ARGS)
+  {
+    event.argc = LOG_ARGS;
+  }
+  event.text[sizeof(event.text) - 1] = 0;
+}
+
+// Walks the format like printf would, but takes the C type of every
+// argument from what was recorded, so a wrong conversion can't misread
+// the stored words.
+size_t logFormat(const LogEvent &event, char *out, size_t max)
+{
+  if (max == 0)
+    return 0;
+  size_t len = 0;
+  uint8_t arg = 0;
+  const char *p = event.format;
+  while (*p && len + 1 < max)
+  {
+    if (*p != '%')
+    {
+      out[len++] = *p++;
+      continue;
+    }
+    // flags, width and precision are kept, length modifiers don't matter
+    char spec[16];
+    size_t n = 0;
+    spec[n++] = *p++;
+    while (*p && strchr("-+ #0123456789.", *p) && n < sizeof(spec) - 2)
+    {
+      spec[n++] = *p++;
+    }
+    while (*p && strchr("hlLqjzt", *p))
+    {
+      p++;
+    }
+    char conv = *p;
+    if (conv)
+    {
+      p++;
+    }
+    if (conv == '%')
+    {
+      out[len++] = '%';
+      continue;
+    }
+    if (arg >= event.argc)
+      continue;
+
+    uint32_t value = event.args[arg];
+    int written = 0;
+    switch (event.types[arg++])
+    {
+    case LOG_ARG_STR:
+      spec[n++] = 's';
+      spec[n] = 0;
+      written = snprintf(out + len, max - len, spec, value < sizeof(event.text) ? event.text + value : "");
+      break;
+    case LOG_ARG_FLOAT:
+    {
+      float f;
+      memcpy(&f, &value, sizeof(f));
+      spec[n++] = conv && strchr("fFeEgG", conv) ? conv : 'g';
+      spec[n] = 0;
+      written = snprintf(out + len, max - len, spec, (double)f);
+      break;
+    }
+    case LOG_ARG_IP:
+      written = snprintf(out + len, max - len, "%u.%u.%u.%u", value & 0xFF, (value >> 8) & 0xFF, (value >> 16) & 0xFF, value >> 24);
+      break;
+    case LOG_ARG_INT:
+      spec[n++] = conv && strchr("dicxXo", conv) ? conv : 'd';
+      spec[n] = 0;
+      written = snprintf(out + len, max - len, spec, (int)value);
+      break;
+    default:
+      spec[n++] = conv && strchr("uxXocd", conv) ? conv : 'u';
+      spec[n] = 0;
+      written = snprintf(out + len, max - len, spec, (unsigned)value);
+      break;
+    }
+    if (written > 0)
+    {
+      len += (size_t)written < max - len ? written : max - len - 1;
+    }
+  }
+  out[len] = 0;
+  return len;
+}
+
+// "W mqtt: text", how the console and USB serial show a message
+size_t logMessage(const LogEvent &event, char *out, size_t max)
+{
+  int n = snprintf(out, max, "%c %s: ", toupper(logLevelName(event.level)[0]), logModuleName(event.module));
+  if (n < 0 || (size_t)n >= max)
+    return 0;
+  return n + logFormat(event, out + n, max - n);
+}
+
+// ring positions serve as sequence numbers: they only grow and a reader
+// can seek to one directly
+size_t logFirst()
+{
+  logLock();
+  size_t seq = logRing.first();
+  logUnlock();
+  return seq;
+}
+
+// one line per record of ring from pos on; messages is false for records
+// of another firmware image, their format strings are gone
+void logPrintRecords(const RecordRing &ring, size_t pos, bool decode, bool messages, String &buff)
+{
+  static const char hex[] = "0123456789abcdef";
+
+  buff.reserve(buff.length() + (ring.end() - pos) * 3);
+  for (; pos != ring.end(); pos = ring.next(pos))
+  {
+    LogHeader header;
+    size_t len = ring.read(pos, &header, sizeof(header)) - sizeof(header);
+    buff += '[';
+    buff += header.time;
+    buff += ']';
+    if (header.client != LOG_NO_CLIENT)
+    {
+      buff += " #";
+      buff += header.client;
+    }
+    if (header.type == LOG_MSG)
+    {
+      uint8_t data[sizeof(header) + sizeof(LogEvent)];
+      LogEvent event;
+      char text[LOG_LINE_MAX];
+      ring.read(pos, data, sizeof(data));
+      logEventRead(event, data + sizeof(header), len);
+      if (!messages)
+      {
+        static const char other[] = "(message of another firmware)";
+        event.format = other;
+        event.argc = 0;
+      }
+      // restored bytes only have to chain by length: the format pointer
+      // is followed only into this image's constant data
+      else if (len < offsetof(LogEvent, text) || !esp_ptr_in_drom(event.format))
+      {
+        static const char unreadable[] = "(unreadable message)";
+        event.format = unreadable;
+        event.argc = 0;
+      }
+      logMessage(event, text, sizeof(text));
+      buff += " | ";
+      buff += text;
+    }
+    else if (header.type != LOG_TO_UART && header.type != LOG_FROM_UART)
+    {
+      buff += " | (unreadable message)";
     }
+    else
+    {
+      buff += header.type == LOG_TO_UART ? " ->" : " <-";
+      for (size_t i = 0; i < len; i++)
+      {
+        uint8_t c = ring.at(pos, sizeof(header) + i);
+        char digits[4] = {' ', hex[c >> 4], hex[c & 0x0F], 0};
+        buff += digits;
+      }
+      if (decode && len <= ZNP_MAX_FRAME)
+      {
+        uint8_t frame[sizeof(header) + ZNP_MAX_FRAME];
+        char text[160];
+        ring.read(pos, frame, sizeof(frame));
+        if (znpDissect(frame + sizeof(header), len, text, sizeof(text)) > 0)
+        {
+          buff += " : ";
+          buff += text;
+        }
+      }
+    }
+    buff += '\n';
+  }
+}
+
+String logPrint(size_t &seq, bool &overrun, bool decode)
+{
+  String buff = "";
+
+  logLock();
+  // before the oldest record, or ahead of the ring after a reboot
+  overrun = (ptrdiff_t)(seq - logRing.first()) < 0 || (ptrdiff_t)(logRing.end() - seq) < 0;
+  if (overrun)
+  {
+    seq = logRing.first();
+  }
+  bool fresh = seq != logRing.end();
+  logUnlock();
+  if (!fresh)
+    return buff;
+
+  // the bridge task records every frame under the lock, so it only covers
+  // copying the records; formatting and decoding work on the copy
+  uint8_t *copy = (uint8_t *)malloc(LOG_RING_SIZE);
+  if (!copy)
     return buff;
+  RecordRing snapshot;
+  snapshot.begin(copy, LOG_RING_SIZE);
+  logLock();
+  if ((ptrdiff_t)(seq - logRing.first()) < 0)
+  {
+    overrun = true;
+    seq = logRing.first();
+  }
+  snapshot.copy(logRing, seq);
+  seq = logRing.end();
+  logUnlock();
+  logPrintRecords(snapshot, snapshot.first(), decode, true, buff);
+  free(copy);
+  return buff;
+}
+
+// lastRing is only written at boot, no lock needed
+String logPrintLast(bool decode)
+{
+  String buff = "";
+  logPrintRecords(lastRing, lastRing.first(), decode, lastSameBuild, buff);
+  return buff;
+}
+
+const char *logResetReason()
+{
+  switch (resetReason)
+  {
+  case ESP_RST_POWERON:
+    return "power on";
+  case ESP_RST_EXT:
+    return "external reset";
+  case ESP_RST_SW:
+    return "software restart";
+  case ESP_RST_PANIC:
+    return "panic";
+  case ESP_RST_INT_WDT:
+    return "interrupt watchdog";
+  case ESP_RST_TASK_WDT:
+    return "task watchdog";
+  case ESP_RST_WDT:
+    return "watchdog";
+  case ESP_RST_DEEPSLEEP:
+    return "deep sleep";
+  case ESP_RST_BROWNOUT:
+    return "brownout";
+  case ESP_RST_SDIO:
+    return "SDIO";
+  default:
+    return "unknown";
   }
 }
 
+const RecordRing &logRecords()
+{
+  return logRing;
+}
+
 void logClear()
 {
-  if (!logConsole.isEmpty()) {
-    logConsole.clear();
+  logLock();
+  logRing.clear();
+  logKeepSync();
+  logUnlock();
+}
+
+#if LOG_SERIAL_LEVEL > LOG_LEVEL_NONE
+// puts the next message for USB serial into serialLine, false if none
+bool logSerialNext()
+{
+  for (;;)
+  {
+    // one record is copied under the lock, formatted after it
+    uint8_t data[sizeof(LogHeader) + sizeof(LogEvent)];
+    size_t len = 0;
+    logLock();
+    bool lost = (ptrdiff_t)(serialSeq - logRing.first()) < 0;
+    if (lost)
+    {
+      serialSeq = logRing.first();
+    }
+    else if (serialSeq != logRing.end())
+    {
+      len = logRing.read(serialSeq, data, sizeof(data));
+      serialSeq = logRing.next(serialSeq);
+    }
+    logUnlock();
+
+    if (lost)
+    {
+      serialLen = strlcpy(serialLine, "... messages lost\r\n", sizeof(serialLine));
+      serialSent = 0;
+      return true;
+    }
+    if (len == 0)
+      return false;
+    LogHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (header.type != LOG_MSG)
+      continue;
+    LogEvent event;
+    logEventRead(event, data + sizeof(header), len - sizeof(header));
+    if (event.level > LOG_SERIAL_LEVEL)
+      continue;
+    serialLen = snprintf(serialLine, sizeof(serialLine), "[%u] ", (unsigned)header.time);
+    serialLen += logMessage(event, serialLine + serialLen, sizeof(serialLine) - serialLen - 2);
+    serialLine[serialLen++] = '\r';
+    serialLine[serialLen++] = '\n';
+    serialSent = 0;
+    return true;
+  }
+}
+#endif
+
+void logSerialLoop()
+{
+#if LOG_SERIAL_LEVEL > LOG_LEVEL_NONE
+  for (;;)
+  {
+    if (serialSent < serialLen)
+    {
+      int room = Serial.availableForWrite();
+      if (room <= 0)
+        return;
+      size_t n = serialLen - serialSent;
+      if (n > (size_t)room)
+      {
+        n = room;
+      }
+      serialSent += Serial.write((const uint8_t *)serialLine + serialSent, n);
+      if (serialSent < serialLen)
+        return;
+    }
+    if (!logSerialNext())
+      return;
   }
+#endif
 }
@@ -1,3 +1,148 @@
-void logPush(char c);
+#ifndef LOG_H_
+#define LOG_H_
+
+#include <type_traits>
+
+// console records, formatted only when the console is read
+#define LOG_MSG 0
+#define LOG_TO_UART 1
+#define LOG_FROM_UART 2
+// client id of records not tied to one socket client
+#define LOG_NO_CLIENT 0xFF
+
+// message levels, a module logs everything up to its LOG_LEVEL_<module>
+// from config.h, anything above compiles to nothing
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+enum LogModule
+{
+  LOG_MODULE_MAIN,
+  LOG_MODULE_NET,
+  LOG_MODULE_WEB,
+  LOG_MODULE_MQTT,
+  LOG_MODULE_BRIDGE,
+  LOG_MODULE_ZIGBEE,
+  LOG_MODULES
+};
+
+class RecordRing;
+class IPAddress;
+class __FlashStringHelper;
+
+// every record starts with this, the logged bytes follow
+struct LogHeader
+{
+  uint32_t time;
+  uint8_t type;
+  uint8_t client;
+};
+
+#define LOG_ARG_INT 0
+#define LOG_ARG_UINT 1
+#define LOG_ARG_FLOAT 2
+#define LOG_ARG_STR 3
+#define LOG_ARG_IP 4
+
+// A LOG_MSG record: the format and the raw arguments, strings copied into
+// text. Only offsetof(LogEvent, text) + textLen bytes are stored.
+struct LogEvent
+{
+  const char *format;
+  uint8_t level;
+  uint8_t module;
+  uint8_t argc;
+  uint8_t textLen;
+  uint8_t types[LOG_ARGS];
+  uint32_t args[LOG_ARGS];
+  char text[LOG_EVENT_TEXT];
+};
+
+// LOGW(MQTT, "failed, rc=%d", state): printf style, but the text is only
+// put together when a sink reads the record. The format must be a string
+// literal, a conversion that doesn't fit the argument prints it plainly.
+#define LOG_AT(level, module, ...)                                \
+  do                                                              \
+  {                                                               \
+    if ((level) <= LOG_LEVEL_##module)                            \
+      logEvent((level), LOG_MODULE_##module, __VA_ARGS__);        \
+  } while (0)
+#define LOGE(module, ...) LOG_AT(LOG_LEVEL_ERROR, module, __VA_ARGS__)
+#define LOGW(module, ...) LOG_AT(LOG_LEVEL_WARN, module, __VA_ARGS__)
+#define LOGI(module, ...) LOG_AT(LOG_LEVEL_INFO, module, __VA_ARGS__)
+#define LOGD(module, ...) LOG_AT(LOG_LEVEL_DEBUG, module, __VA_ARGS__)
+
+void logBegin();
+void logLock();
+void logUnlock();
+void logRecord(uint8_t type, uint8_t client, const uint8_t *data, size_t len);
 void logClear();
-String logPrint();
+// sequence of the oldest record kept, sequences grow with every record
+size_t logFirst();
+// records from seq on; a seq already overwritten sets overrun and starts
+// at the oldest record. seq is moved past the last record returned.
+// decode appends the ZNP dissection to traffic lines.
+String logPrint(size_t &seq, bool &overrun, bool decode);
+// the ring itself, for readers that copy records out of it; hold logLock()
+// only while copying, the bridge task waits for it
+const RecordRing &logRecords();
+// records the previous boot left in RTC memory (empty after power-on or if
+// they didn't check out), and why that boot ended
+String logPrintLast(bool decode);
+const char *logResetReason();
+// feeds new messages to USB serial, never waits for the UART; from loop()
+void logSerialLoop();
+
+const char *logLevelName(uint8_t level);
+const char *logModuleName(uint8_t module);
+// message text of an event, as much as fits into max, returns its length
+size_t logFormat(const LogEvent &event, char *out, size_t max);
+// copies a stored event, len as read from the record
+void logEventRead(LogEvent &event, const uint8_t *data, size_t len);
+
+// argument capture for logEvent()
+void logArgWord(LogEvent &event, uint8_t type, uint32_t value);
+void logArg(LogEvent &event, const char *value);
+void logArg(LogEvent &event, const __FlashStringHelper *value);
+void logArg(LogEvent &event, const String &value);
+void logArg(LogEvent &event, const IPAddress &value);
+void logArg(LogEvent &event, double value);
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type logArg(LogEvent &event, const T &value)
+{
+  logArgWord(event, std::is_signed<T>::value ? LOG_ARG_INT : LOG_ARG_UINT, (uint32_t)value);
+}
+
+inline void logArgs(LogEvent &)
+{
+}
+
+template <typename T, typename... Rest>
+inline void logArgs(LogEvent &event, const T &value, const Rest &...rest)
+{
+  logArg(event, value);
+  logArgs(event, rest...);
+}
+
+// hands a filled event to the sinks
+void logCommit(LogEvent &event);
+
+template <typename... Args>
+void logEvent(uint8_t level, uint8_t module, const char *format, const Args &...args)
+{
+  static_assert(sizeof...(args) <= LOG_ARGS, "too many log arguments");
+  LogEvent event;
+  event.format = format;
+  event.level = level;
+  event.module = module;
+  event.argc = 0;
+  event.textLen = 0;
+  logArgs(event, args...);
+  logCommit(event);
+}
+
+#endif
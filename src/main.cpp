@@ -9,6 +9,7 @@
 #include "config.h"
 #include "web.h"
 #include "log.h"
+#include "syslog.h"
 #include "etc.h"
 #include <Update.h>
 #include "version.h"
@@ -24,6 +25,8 @@
 #include <ESPmDNS.h>
 
 #include "mqtt.h"
+#include "bridge.h"
+#include "znp.h"
 #include <ESP32Ping.h>
 
 #include <DNSServer.h>
@@ -34,15 +37,11 @@ DNSServer dnsServer;
 
 
 // application config
-unsigned long timeLog;
 ConfigSettingsStruct ConfigSettings;
 InfosStruct Infos;
 bool configOK = false;
 //String modeWiFi = "STA";
 
-// serial end ethernet buffer size
-#define BUFFER_SIZE 256
-
 // multicast DNS responder
 MDNSResponder mdns;
 
@@ -72,21 +71,19 @@ bool checkPing()
 { 
   if (ConfigSettings.disablePingCtrl == 1)
   {
-    DEBUG_PRINTLN(F("Ping control disabled"));
+    LOGD(NET, "Ping control disabled");
     return true;
   }
-  DEBUG_PRINT(F("Try to ping "));
-  DEBUG_PRINTLN(ETH.gatewayIP());
+  LOGD(NET, "Try to ping %s", ETH.gatewayIP());
   if (Ping.ping(ETH.gatewayIP()))
   {
-    DEBUG_PRINTLN(F("okey ping"));
+    LOGD(NET, "okey ping");
     //ConfigSettings.connectedEther = true;
     //ConfigSettings.disconnectEthTime = 0;
     if (ConfigSettings.emergencyWifi)
     {
-      DEBUG_PRINTLN(F("saveEmergencyWifi(0)"));
+      LOGI(NET, "Gateway reachable, leaving emergency WiFi, restart");
       saveEmergencyWifi(0);
-      DEBUG_PRINTLN(F("ESP.restart"));
       ESP.restart();
       //WiFi.disconnect();
       //WiFi.mode(WIFI_OFF);
@@ -96,7 +93,7 @@ bool checkPing()
   }
   else
   {
-    DEBUG_PRINTLN(F("error ping"));
+    LOGW(NET, "Gateway %s does not answer ping", ETH.gatewayIP());
     return false;
     /*
     ConfigSettings.connectedEther = false;
@@ -116,29 +113,18 @@ bool checkPing()
 }
 void WiFiEvent(WiFiEvent_t event)
 { 
-  DEBUG_PRINT(F("WiFiEvent "));
-  DEBUG_PRINTLN(event);
+  LOGD(NET, "WiFiEvent %d", event);
   switch (event)
   {
   case 18://SYSTEM_EVENT_ETH_START:
-    DEBUG_PRINTLN(F("ETH Started"));
+    LOGD(NET, "ETH Started");
     //ConfigSettings.disconnectEthTime = millis();
     break;
   case 20://SYSTEM_EVENT_ETH_CONNECTED:
-    DEBUG_PRINTLN(F("ETH Connected"));
+    LOGI(NET, "ETH Connected");
     break;
   case 22://SYSTEM_EVENT_ETH_GOT_IP:
-    DEBUG_PRINTLN(F("ETH MAC: "));
-    DEBUG_PRINT(ETH.macAddress());
-    DEBUG_PRINT(F(", IPv4: "));
-    DEBUG_PRINT(ETH.localIP());
-    if (ETH.fullDuplex())
-    {
-      DEBUG_PRINT(F(", FULL_DUPLEX"));
-    }
-    DEBUG_PRINT(F(", "));
-    DEBUG_PRINT(ETH.linkSpeed());
-    DEBUG_PRINTLN(F("Mbps"));
+    LOGI(NET, "ETH MAC: %s, IPv4: %s, %s, %dMbps", ETH.macAddress(), ETH.localIP(), ETH.fullDuplex() ? "FULL_DUPLEX" : "HALF_DUPLEX", ETH.linkSpeed());
     if (checkPing())
     {
       ConfigSettings.connectedEther = true;
@@ -147,23 +133,21 @@ void WiFiEvent(WiFiEvent_t event)
     }
     break;
   case SYSTEM_EVENT_STA_GOT_IP:
-    DEBUG_PRINTLN(F("SYSTEM_EVENT_STA_GOT_IP"));
+    LOGI(NET, "WiFi STA got IP %s", WiFi.localIP());
     ConfigSettings.wifiRetries = 0;
   case 21://SYSTEM_EVENT_ETH_DISCONNECTED:
-    DEBUG_PRINTLN(F("ETH Disconnected"));
+    LOGW(NET, "ETH Disconnected");
     ConfigSettings.connectedEther = false;
     ConfigSettings.disconnectEthTime = millis();
     break;
   case SYSTEM_EVENT_ETH_STOP:
-    DEBUG_PRINTLN(F("ETH Stopped"));
+    LOGW(NET, "ETH Stopped");
     ConfigSettings.connectedEther = false;
     ConfigSettings.disconnectEthTime = millis();
     break;
   case SYSTEM_EVENT_STA_DISCONNECTED:
-    DEBUG_PRINTLN(F("WIFI STA DISCONNECTED")); 
     ConfigSettings.wifiRetries++;
-    DEBUG_PRINT(ConfigSettings.wifiRetries); 
-    DEBUG_PRINTLN(F(" times")); 
+    LOGW(NET, "WIFI STA DISCONNECTED %d times", ConfigSettings.wifiRetries);
     if (ConfigSettings.wifiRetries < 7) {
       setupSTAWifi();
     }
@@ -177,8 +161,6 @@ void WiFiEvent(WiFiEvent_t event)
   }
 }
 
-WiFiServer server(TCP_LISTEN_PORT, MAX_SOCKET_CLIENTS);
-
 IPAddress parse_ip_address(const char *str)
 {
   IPAddress result;
@@ -213,26 +195,26 @@ bool loadSystemVar()
   File configFile = LittleFS.open(path, FILE_READ);
   if (!configFile)
   {
-    DEBUG_PRINTLN(F("failed open. try to write defaults"));
+    LOGW(MAIN, "%s failed open. try to write defaults", path);
 
     float CPUtemp = getCPUtemp(true);
     int correct = CPUtemp - 30;
     String tempOffset = String(correct);
 
     String StringConfig = "{\"board\":1,\"emergencyWifi\":0,\"tempOffset\":" + tempOffset + "}";
-    DEBUG_PRINTLN(StringConfig);
     DynamicJsonDocument doc(1024);
     deserializeJson(doc, StringConfig);
 
     File configFile = LittleFS.open(path, FILE_WRITE);
     if (!configFile)
     {
-      DEBUG_PRINTLN(F("failed write"));
+      LOGE(MAIN, "%s failed write", path);
       return false;
     }
     else
     {
-      serializeJson(doc, configFile);
+      size_t size = serializeJson(doc, configFile);
+      LOGD(MAIN, "%s written, %u bytes", path, (unsigned)size);
     }
     return false;
   }
@@ -245,7 +227,7 @@ bool loadSystemVar()
   ConfigSettings.tempOffset = (int)doc["tempOffset"];
   if (!ConfigSettings.tempOffset)
   {
-    DEBUG_PRINTLN(F("no tempOffset in system.json"));
+    LOGD(MAIN, "no tempOffset in system.json");
     configFile.close();
 
     float CPUtemp = getCPUtemp(true);
@@ -256,7 +238,7 @@ bool loadSystemVar()
     configFile = LittleFS.open(path, FILE_WRITE);
     serializeJson(doc, configFile);
     configFile.close();
-    DEBUG_PRINTLN(F("saved tempOffset in system.json"));
+    LOGD(MAIN, "saved tempOffset in system.json");
     ConfigSettings.tempOffset = int(tempOffset.toInt());
   }
   ConfigSettings.restarts = (int)doc["restarts"];
@@ -282,8 +264,7 @@ bool loadConfigWifi()
 
   if (error)
   {
-    DEBUG_PRINTLN(F("deserializeJson() failed: "));
-    DEBUG_PRINTLN(error.f_str());
+    LOGE(MAIN, "%s deserializeJson() failed: %s", path, error.f_str());
 
     configFile.close();
     LittleFS.remove(path);
@@ -320,8 +301,7 @@ bool loadConfigEther()
 
   if (error)
   {
-    DEBUG_PRINTLN(F("deserializeJson() failed: "));
-    DEBUG_PRINTLN(error.f_str());
+    LOGE(MAIN, "%s deserializeJson() failed: %s", path, error.f_str());
 
     configFile.close();
     LittleFS.remove(path);
@@ -347,9 +327,7 @@ bool loadConfigGeneral()
   {
     String deviceID = "ZigStarGW";
     //getDeviceID(deviceID);
-    String StringConfig = "{\"hostname\":\"" + deviceID + "\",\"disableWeb\":0,\"refreshLogs\":1000,\"webAuth\":0,\"webUser\":"
-                                                          ",\"webPass\":"
-                                                          "}";
+    String StringConfig = "{\"hostname\":\"" + deviceID + "\",\"refreshLogs\":1000,\"webAuth\":0,\"webUser\":\"\",\"webPass\":\"\",\"syslogEnable\":0,\"syslogServer\":\"\",\"syslogPort\":" + String(SYSLOG_PORT) + "}";
 
     writeDefultConfig(path, StringConfig);
   }
@@ -360,15 +338,13 @@ bool loadConfigGeneral()
 
   if (error)
   {
-    DEBUG_PRINTLN(F("deserializeJson() failed: "));
-    DEBUG_PRINTLN(error.f_str());
+    LOGE(MAIN, "%s deserializeJson() failed: %s", path, error.f_str());
 
     configFile.close();
     LittleFS.remove(path);
     return false;
   }
 
-  ConfigSettings.disableWeb = (int)doc["disableWeb"];
   if ((double)doc["refreshLogs"] < 1000)
   {
     ConfigSettings.refreshLogs = 1000;
@@ -382,6 +358,9 @@ bool loadConfigGeneral()
   ConfigSettings.webAuth = (int)doc["webAuth"];
   strlcpy(ConfigSettings.webUser, doc["webUser"] | "", sizeof(ConfigSettings.webUser));
   strlcpy(ConfigSettings.webPass, doc["webPass"] | "", sizeof(ConfigSettings.webPass));
+  ConfigSettings.syslogEnable = (int)doc["syslogEnable"];
+  strlcpy(ConfigSettings.syslogServer, doc["syslogServer"] | "", sizeof(ConfigSettings.syslogServer));
+  ConfigSettings.syslogPort = doc["syslogPort"] | SYSLOG_PORT;
 
   configFile.close();
   return true;
@@ -394,19 +373,18 @@ bool loadConfigSerial()
   File configFile = LittleFS.open(path, FILE_READ);
   if (!configFile)
   {
-    String StringConfig = "{\"baud\":115200,\"port\":6638}";
+    String StringConfig = "{\"baud\":115200,\"port\":6638,\"serialRing\":" + String(SERIAL_RING_SIZE) + ",\"netRing\":" + String(NET_RING_SIZE) + ",\"znpFramer\":0,\"framerTimeout\":" + String(FRAMER_TIMEOUT_MS) + ",\"clientLag\":" + String(CLIENT_LAG) + ",\"slowClientDrop\":1,\"writerBudget\":" + String(WRITER_BUDGET) + ",\"clientRoles\":0,\"primaryIp\":\"\",\"observerRefuse\":0,\"srspRouting\":1,\"flowControl\":0,\"rtsPin\":-1,\"ctsPin\":-1,\"uartRxBuffer\":" + String(UART_RX_BUFFER) + ",\"uartRxFifoFull\":" + String(UART_RX_FIFO_FULL) + ",\"uartRxTimeout\":" + String(UART_RX_TIMEOUT) + "}";
 
     writeDefultConfig(path, StringConfig);
   }
 
   configFile = LittleFS.open(path, FILE_READ);
-  DynamicJsonDocument doc(1024);
+  DynamicJsonDocument doc(2048);
   DeserializationError error = deserializeJson(doc, configFile);
 
   if (error)
   {
-    DEBUG_PRINTLN(F("deserializeJson() failed: "));
-    DEBUG_PRINTLN(error.f_str());
+    LOGE(MAIN, "%s deserializeJson() failed: %s", path, error.f_str());
 
     configFile.close();
     LittleFS.remove(path);
@@ -419,6 +397,35 @@ bool loadConfigSerial()
   {
     ConfigSettings.socketPort = TCP_LISTEN_PORT;
   }
+  ConfigSettings.serialRingSize = doc["serialRing"] | SERIAL_RING_SIZE;
+  ConfigSettings.netRingSize = doc["netRing"] | NET_RING_SIZE;
+  ConfigSettings.znpFramer = (int)doc["znpFramer"];
+  ConfigSettings.framerTimeout = doc["framerTimeout"] | FRAMER_TIMEOUT_MS;
+  if (ConfigSettings.framerTimeout < 1)
+  {
+    ConfigSettings.framerTimeout = 1;
+  }
+  ConfigSettings.clientLag = doc["clientLag"] | CLIENT_LAG;
+  ConfigSettings.slowClientDrop = doc["slowClientDrop"] | 1;
+  ConfigSettings.writerBudget = doc["writerBudget"] | WRITER_BUDGET;
+  if (ConfigSettings.writerBudget < ZNP_MAX_FRAME)
+  {
+    ConfigSettings.writerBudget = ZNP_MAX_FRAME;
+  }
+  ConfigSettings.clientRoles = (int)doc["clientRoles"];
+  strlcpy(ConfigSettings.primaryIp, doc["primaryIp"] | "", sizeof(ConfigSettings.primaryIp));
+  ConfigSettings.observerRefuse = (int)doc["observerRefuse"];
+  ConfigSettings.srspRouting = doc["srspRouting"] | 1;
+  ConfigSettings.flowControl = (int)doc["flowControl"];
+  ConfigSettings.rtsPin = doc["rtsPin"] | -1;
+  ConfigSettings.ctsPin = doc["ctsPin"] | -1;
+  ConfigSettings.uartRxBuffer = doc["uartRxBuffer"] | UART_RX_BUFFER;
+  if (ConfigSettings.uartRxBuffer < 256)
+  {
+    ConfigSettings.uartRxBuffer = 256;
+  }
+  ConfigSettings.uartRxFifoFull = constrain((int)(doc["uartRxFifoFull"] | UART_RX_FIFO_FULL), 1, 127);
+  ConfigSettings.uartRxTimeout = constrain((int)(doc["uartRxTimeout"] | UART_RX_TIMEOUT), 1, 126);
   configFile.close();
   return true;
 }
@@ -432,7 +439,7 @@ bool loadConfigMqtt()
   {
     String deviceID;
     getDeviceID(deviceID);
-    String StringConfig = "{\"enable\":0,\"server\":\"\",\"port\":1883,\"user\":\"mqttuser\",\"pass\":\"\",\"topic\":\"" + deviceID + "\",\"interval\":60,\"discovery\":0}";
+    String StringConfig = "{\"enable\":0,\"server\":\"\",\"port\":1883,\"user\":\"mqttuser\",\"pass\":\"\",\"topic\":\"" + deviceID + "\",\"interval\":60,\"discovery\":0,\"metrics\":0}";
 
     writeDefultConfig(path, StringConfig);
   }
@@ -443,8 +450,7 @@ bool loadConfigMqtt()
 
   if (error)
   {
-    DEBUG_PRINTLN(F("deserializeJson() failed: "));
-    DEBUG_PRINTLN(error.f_str());
+    LOGE(MAIN, "%s deserializeJson() failed: %s", path, error.f_str());
 
     configFile.close();
     LittleFS.remove(path);
@@ -460,6 +466,7 @@ bool loadConfigMqtt()
   strlcpy(ConfigSettings.mqttTopic, doc["topic"] | "", sizeof(ConfigSettings.mqttTopic));
   ConfigSettings.mqttInterval = (int)doc["interval"];
   ConfigSettings.mqttDiscovery = (int)doc["discovery"];
+  ConfigSettings.mqttMetrics = (int)doc["metrics"];
 
   configFile.close();
   return true;
@@ -514,14 +521,12 @@ bool setupSTAWifi()
   //}
 
   WiFi.mode(WIFI_STA);
-  DEBUG_PRINTLN(F("WiFi.mode(WIFI_STA)"));
   WiFi.disconnect();
-  DEBUG_PRINTLN(F("disconnect"));
   delay(100);
 
   WiFi.begin(ConfigSettings.ssid, ConfigSettings.password);
   WiFi.setSleep(false);
-  DEBUG_PRINTLN(F("WiFi.begin"));
+  LOGD(NET, "WiFi.begin %s", ConfigSettings.ssid);
 
   IPAddress ip_address = parse_ip_address(ConfigSettings.ipAddressWiFi);
   IPAddress gateway_address = parse_ip_address(ConfigSettings.ipGWWiFi);
@@ -530,29 +535,25 @@ bool setupSTAWifi()
   if (!ConfigSettings.dhcpWiFi)
   {
     WiFi.config(ip_address, gateway_address, netmask);
-    DEBUG_PRINTLN(F("WiFi.config"));
+    LOGD(NET, "WiFi static %s", ip_address);
   }
   else
   {
-    DEBUG_PRINTLN(F("Try DHCP"));
+    LOGD(NET, "WiFi DHCP");
   }
 
   int countDelay = 50;
   while (WiFi.status() != WL_CONNECTED)
   {
-    //DEBUG_PRINT(F("."));
-    DEBUG_PRINT(WiFi.status());
     countDelay--;
     if (countDelay == 0)
     {
+      LOGW(NET, "WiFi not connected, status %d", WiFi.status());
       return false;
     }
     delay(250);
   }
-  DEBUG_PRINTLN(F(" "));
-  DEBUG_PRINTLN(WiFi.localIP());
-  DEBUG_PRINTLN(WiFi.subnetMask());
-  DEBUG_PRINTLN(WiFi.gatewayIP());
+  LOGI(NET, "WiFi connected %s mask %s gw %s", WiFi.localIP(), WiFi.subnetMask(), WiFi.gatewayIP());
   return true;
 }
 
@@ -561,9 +562,8 @@ void enableWifi()
   WiFi.setHostname(ConfigSettings.hostname);
   if ((strlen(ConfigSettings.ssid) != 0) && (strlen(ConfigSettings.password) != 0))
   {
-    DEBUG_PRINTLN(F("Ok SSID & PASS"));
+    LOGD(NET, "Ok SSID & PASS, setupSTAWifi");
     setupSTAWifi();
-    DEBUG_PRINTLN(F("setupSTAWifi"));
       //ConfigSettings.wifiModeAP = false;
       //setupWifiAP();
       //modeWiFi = "AP";
@@ -578,18 +578,40 @@ void enableWifi()
   }
   else
   {
-    DEBUG_PRINTLN(F("NO SSID & PASS"));
+    LOGI(NET, "NO SSID & PASS, setupWifiAP");
     setupWifiAP();
-    DEBUG_PRINTLN(F("setupWifiAP"));
     //ConfigSettings.wifiModeAP = true;
   }
   mDNS_start();
 }
 
+void zigbeeSerialBegin(int rx, int tx)
+{
+  // the driver buffer can only be sized before begin()
+  Serial2.setRxBufferSize(ConfigSettings.uartRxBuffer);
+  Serial2.begin(ConfigSettings.serialSpeed, SERIAL_8N1, rx, tx);
+  Serial2.setRxFIFOFull(ConfigSettings.uartRxFifoFull);
+  Serial2.setRxTimeout(ConfigSettings.uartRxTimeout);
+
+  ConfigSettings.flowControlActive = false;
+  if (ConfigSettings.flowControl)
+  {
+    int rts, cts;
+    if (!zigbeeFlowControlPins(ConfigSettings.rtsPin, ConfigSettings.ctsPin, rts, cts))
+    {
+      LOGW(ZIGBEE, "No RTS/CTS pins set, flow control off");
+    }
+    else if (Serial2.setPins(rx, tx, cts, rts) && Serial2.setHwFlowCtrlMode(HW_FLOWCTRL_CTS_RTS, UART_RTS_THRESHOLD))
+    {
+      ConfigSettings.flowControlActive = true;
+      LOGD(ZIGBEE, "Zigbee serial RTS/CTS flow control on");
+    }
+  }
+}
+
 void setupEthernetAndZigbeeSerial()
 {
-  DEBUG_PRINT(F("Board - "));
-  DEBUG_PRINTLN(ConfigSettings.board);
+  LOGD(ZIGBEE, "Board - %d", ConfigSettings.board);
   switch (ConfigSettings.board)
   {
 
@@ -598,14 +620,14 @@ void setupEthernetAndZigbeeSerial()
     {
       String boardName = "WT32-ETH01";
       boardName.toCharArray(ConfigSettings.boardName, sizeof(ConfigSettings.boardName));
-      DEBUG_PRINT(F("Board - "));
-      DEBUG_PRINTLN(boardName);
+      LOGI(ZIGBEE, "Board - %s", boardName);
       ConfigSettings.rstZigbeePin = RESTART_ZIGBEE_1;
       ConfigSettings.flashZigbeePin = FLASH_ZIGBEE_1;
+      ConfigSettings.rtsZigbeePin = ZRTS_1;
+      ConfigSettings.ctsZigbeePin = ZCTS_1;
 
-      DEBUG_PRINT(F("Zigbee serial setup @ "));
-      DEBUG_PRINTLN(ConfigSettings.serialSpeed);
-      Serial2.begin(ConfigSettings.serialSpeed, SERIAL_8N1, ZRXD_1, ZTXD_1);
+      LOGD(ZIGBEE, "Zigbee serial setup @ %d", ConfigSettings.serialSpeed);
+      zigbeeSerialBegin(ZRXD_1, ZTXD_1);
     }
     else
     {
@@ -619,14 +641,14 @@ void setupEthernetAndZigbeeSerial()
     {
       String boardName = "TTGO T-Internet-POE";
       boardName.toCharArray(ConfigSettings.boardName, sizeof(ConfigSettings.boardName));
-      DEBUG_PRINT(F("Board - "));
-      DEBUG_PRINTLN(boardName);
+      LOGI(ZIGBEE, "Board - %s", boardName);
       ConfigSettings.rstZigbeePin = RESTART_ZIGBEE_2;
       ConfigSettings.flashZigbeePin = FLASH_ZIGBEE_2;
+      ConfigSettings.rtsZigbeePin = ZRTS_2;
+      ConfigSettings.ctsZigbeePin = ZCTS_2;
 
-      DEBUG_PRINT(F("Zigbee serial setup @ "));
-      DEBUG_PRINTLN(ConfigSettings.serialSpeed);
-      Serial2.begin(ConfigSettings.serialSpeed, SERIAL_8N1, ZRXD_2, ZTXD_2);
+      LOGD(ZIGBEE, "Zigbee serial setup @ %d", ConfigSettings.serialSpeed);
+      zigbeeSerialBegin(ZRXD_2, ZTXD_2);
 
       oneWireBegin();
     }
@@ -642,14 +664,14 @@ void setupEthernetAndZigbeeSerial()
     {
       String boardName = "unofficial China-GW";
       boardName.toCharArray(ConfigSettings.boardName, sizeof(ConfigSettings.boardName));
-      DEBUG_PRINT(F("Board - "));
-      DEBUG_PRINTLN(boardName);
+      LOGI(ZIGBEE, "Board - %s", boardName);
       ConfigSettings.rstZigbeePin = RESTART_ZIGBEE_3;
       ConfigSettings.flashZigbeePin = FLASH_ZIGBEE_3;
+      ConfigSettings.rtsZigbeePin = ZRTS_3;
+      ConfigSettings.ctsZigbeePin = ZCTS_3;
 
-      DEBUG_PRINT(F("Zigbee serial setup @ "));
-      DEBUG_PRINTLN(ConfigSettings.serialSpeed);
-      Serial2.begin(ConfigSettings.serialSpeed, SERIAL_8N1, ZRXD_3, ZTXD_3);
+      LOGD(ZIGBEE, "Zigbee serial setup @ %d", ConfigSettings.serialSpeed);
+      zigbeeSerialBegin(ZRXD_3, ZTXD_3);
     }
     else
     {
@@ -663,14 +685,14 @@ void setupEthernetAndZigbeeSerial()
     {
       String boardName = "Omilex EPS32-POE";
       boardName.toCharArray(ConfigSettings.boardName, sizeof(ConfigSettings.boardName));
-      DEBUG_PRINT(F("Board - "));
-      DEBUG_PRINTLN(boardName);
+      LOGI(ZIGBEE, "Board - %s", boardName);
       ConfigSettings.rstZigbeePin = RESTART_ZIGBEE_4;
       ConfigSettings.flashZigbeePin = FLASH_ZIGBEE_4;
+      ConfigSettings.rtsZigbeePin = ZRTS_4;
+      ConfigSettings.ctsZigbeePin = ZCTS_4;
 
-      DEBUG_PRINT(F("Zigbee serial setup @ "));
-      DEBUG_PRINTLN(ConfigSettings.serialSpeed);
-      Serial2.begin(ConfigSettings.serialSpeed, SERIAL_8N1, ZRXD_4, ZTXD_4);
+      LOGD(ZIGBEE, "Zigbee serial setup @ %d", ConfigSettings.serialSpeed);
+      zigbeeSerialBegin(ZRXD_4, ZTXD_4);
 
       oneWireBegin();
     }
@@ -688,7 +710,7 @@ void setupEthernetAndZigbeeSerial()
     //ConfigSettings.emergencyWifi = 1;
     //DEBUG_PRINTLN(F("Please set board type in system.json"));
     //saveBoard(0);
-    DEBUG_PRINTLN(F("NO BOARD TYPE! Start from beginning"));
+    LOGE(ZIGBEE, "NO BOARD TYPE! Start from beginning");
     saveBoard(1);
     delay(1000);
     ESP.restart();
@@ -715,7 +737,7 @@ void mDNS_start()
 {
   if (!MDNS.begin(ConfigSettings.hostname))
   {
-    DEBUG_PRINTLN(F("Error setting up MDNS responder!"));
+    LOGE(NET, "Error setting up MDNS responder!");
     while (1)
     {
       delay(1000);
@@ -723,13 +745,13 @@ void mDNS_start()
   }
   else
   {
-    DEBUG_PRINTLN(F("mDNS responder started"));
+    LOGD(NET, "mDNS responder started");
     MDNS.addService("http", "tcp", 80);
     MDNS.addService("zigstar_gw", "tcp", ConfigSettings.socketPort);
     MDNS.addServiceTxt("zigstar_gw", "tcp", "version", "1.0");
     MDNS.addServiceTxt("zigstar_gw", "tcp", "radio_type", "znp");
     MDNS.addServiceTxt("zigstar_gw", "tcp", "baud_rate", String(ConfigSettings.serialSpeed));
-    MDNS.addServiceTxt("zigstar_gw", "tcp", "data_flow_control", "software");
+    MDNS.addServiceTxt("zigstar_gw", "tcp", "data_flow_control", ConfigSettings.flowControlActive ? "hardware" : "software");
   }
 }
 
@@ -737,63 +759,62 @@ void setup(void)
 {
 
   Serial.begin(115200);
-  DEBUG_PRINTLN(F("Start"));
+  logBegin();
+  LOGI(MAIN, "Start");
 
   WiFi.onEvent(WiFiEvent);
 
   if (!LittleFS.begin(FORMAT_LITTLEFS_IF_FAILED, "/lfs2", 10))
   {
-    DEBUG_PRINTLN(F("Error with LITTLEFS"));
+    LOGE(MAIN, "Error with LITTLEFS");
     return;
   }
 
-  DEBUG_PRINTLN(F("LITTLEFS OK"));
+  LOGD(MAIN, "LITTLEFS OK");
   if (!loadSystemVar())
   {
-    DEBUG_PRINTLN(F("Error load system vars"));
+    LOGW(MAIN, "Error load system vars");
     const char *path = "/config";
 
     if (LittleFS.mkdir(path))
     {
-      DEBUG_PRINTLN(F("Config dir created"));
+      LOGI(MAIN, "Config dir created");
       delay(500);
       ESP.restart();
     }
     else
     {
-      DEBUG_PRINTLN(F("mkdir failed"));
+      LOGE(MAIN, "mkdir failed");
     }
   }
   else
   {
-    DEBUG_PRINTLN(F("System vars load OK"));
     ConfigSettings.restarts++;
-    DEBUG_PRINT(F("Restarts count "));
-    DEBUG_PRINTLN(ConfigSettings.restarts);
+    LOGD(MAIN, "System vars load OK, restarts count %d", ConfigSettings.restarts);
     saveRestartCount(ConfigSettings.restarts);
   }
 
   if (!loadConfigSerial())
   {
-    DEBUG_PRINTLN(F("Error load config serial"));
+    LOGE(MAIN, "Error load config serial");
     ESP.restart();
   }
   else
   {
-    DEBUG_PRINTLN(F("Config serial load OK"));
+    LOGD(MAIN, "Config serial load OK");
   }
 
   setupEthernetAndZigbeeSerial();
 
   if ((!loadConfigWifi()) || (!loadConfigEther()) || (!loadConfigGeneral()) || (!loadConfigMqtt()))
   {
-    DEBUG_PRINTLN(F("Error load config files"));
+    LOGE(MAIN, "Error load config files");
     ESP.restart();
   }
   else
   {
     configOK = true;
-    DEBUG_PRINTLN(F("Config files load OK"));
+    LOGD(MAIN, "Config files load OK");
   }
 
   /*
@@ -823,12 +844,12 @@ void setup(void)
 
   if (!ConfigSettings.dhcp)
   {
-    DEBUG_PRINTLN(F("ETH STATIC"));
+    LOGD(NET, "ETH STATIC %s", ConfigSettings.ipAddress);
     ETH.config(parse_ip_address(ConfigSettings.ipAddress), parse_ip_address(ConfigSettings.ipGW), parse_ip_address(ConfigSettings.ipMask));
   }
   else
   {
-    DEBUG_PRINTLN(F("ETH DHCP"));
+    LOGD(NET, "ETH DHCP");
   }
 
   initWebServer();
@@ -859,137 +880,30 @@ void setup(void)
   */
   if (ConfigSettings.enableWiFi || ConfigSettings.emergencyWifi)
   {
-    DEBUG_PRINT(F("ConfigSettings.enableWiFi "));
-    DEBUG_PRINTLN(ConfigSettings.enableWiFi);
-    DEBUG_PRINT(F("ConfigSettings.emergencyWifi "));
-    DEBUG_PRINTLN(ConfigSettings.emergencyWifi);
+    LOGD(NET, "enableWiFi %d emergencyWifi %d", ConfigSettings.enableWiFi, ConfigSettings.emergencyWifi);
     enableWifi();
   }
 
-  server.begin(ConfigSettings.socketPort);
-  server.setNoDelay(true);
-
-  ConfigSettings.connectedClients = 0;
+  syslogBegin();
+  bridgeStart();
 
   if (ConfigSettings.mqttEnable)
   {
     mqttConnectSetup();
   }
   
-  DEBUG_PRINTLN(millis());
+  LOGD(MAIN, "Setup done in %lu ms", millis());
 
   saveRestartCount(0);
 
   if (ConfigSettings.restarts > 5)
   { 
-    DEBUG_PRINTLN(F("RESET ALL SETTINGS!"));
+    LOGW(MAIN, "RESET ALL SETTINGS!");
     resetSettings();
   }
   
 }
 
-WiFiClient client[10];
-//double loopCount;
-
-void socketClientConnected(int client)
-{
-  if (ConfigSettings.connectedSocket[client] != true)
-  {
-    DEBUG_PRINT(F("Connected client "));
-    DEBUG_PRINTLN(client);
-    if (ConfigSettings.connectedClients == 0)
-    {
-      ConfigSettings.socketTime = millis();
-      DEBUG_PRINT(F("Socket time "));
-      DEBUG_PRINTLN(ConfigSettings.socketTime);
-      mqttPublishIo("socket", "ON");
-    }
-    ConfigSettings.connectedSocket[client] = true;
-    ConfigSettings.connectedClients++;
-  }
-}
-
-void socketClientDisconnected(int client)
-{
-  if (ConfigSettings.connectedSocket[client] != false)
-  {
-    DEBUG_PRINT(F("Disconnected client "));
-    DEBUG_PRINTLN(client);
-    ConfigSettings.connectedSocket[client] = false;
-    ConfigSettings.connectedClients--;
-    if (ConfigSettings.connectedClients == 0)
-    {
-      ConfigSettings.socketTime = millis();
-      DEBUG_PRINT(F("Socket time "));
-      DEBUG_PRINTLN(ConfigSettings.socketTime);
-      mqttPublishIo("socket", "OFF");
-    }
-  }
-}
-
-void printRecvSocket(size_t bytes_read, uint8_t net_buf[BUFFER_SIZE])
-{
-  char output_sprintf[2];
-  if (bytes_read > 0)
-  {
-    String tmpTime;
-    String buff = "";
-    timeLog = millis();
-    tmpTime = String(timeLog, DEC);
-    logPush('[');
-    for (int j = 0; j < tmpTime.length(); j++)
-    {
-      logPush(tmpTime[j]);
-    }
-    logPush(']');
-    logPush(' ');
-    logPush('-');
-    logPush('>');
-
-    for (int i = 0; i < bytes_read; i++)
-    {
-      sprintf(output_sprintf, "%02x", net_buf[i]);
-      logPush(' ');
-      logPush(output_sprintf[0]);
-      logPush(output_sprintf[1]);
-    }
-    logPush('\n');
-  }
-}
-
-void printSendSocket(size_t bytes_read, uint8_t serial_buf[BUFFER_SIZE])
-{
-  char output_sprintf[2];
-  String tmpTime;
-  String buff = "";
-  timeLog = millis();
-  tmpTime = String(timeLog, DEC);
-  logPush('[');
-  for (int j = 0; j < tmpTime.length(); j++)
-  {
-    logPush(tmpTime[j]);
-  }
-  logPush(']');
-  logPush(' ');
-  logPush('<');
-  logPush('-');
-  for (int i = 0; i < bytes_read; i++)
-  {
-    //if (serial_buf[i] == 0x01)
-    //{
-    //}
-    sprintf(output_sprintf, "%02x", serial_buf[i]);
-    logPush(' ');
-    logPush(output_sprintf[0]);
-    logPush(output_sprintf[1]);
-    //if (serial_buf[i] == 0x03)
-   // {
-      
-    //}
-  }
-  logPush('\n');
-}
-
 void system_loop()
 {
   if ((millis() > ConfigSettings.wifiAPenblTime + 7*60*1000) && ConfigSettings.wifiModeAP == true && (strlen(ConfigSettings.ssid) != 0) && (strlen(ConfigSettings.password) != 0))
@@ -1000,25 +914,10 @@ void system_loop()
 
 void loop(void)
 {
-  uint16_t net_bytes_read = 0;
-  uint8_t net_buf[BUFFER_SIZE];
-
-  uint16_t serial_bytes_read = 0;
-  uint8_t serial_buf[BUFFER_SIZE];
-
   system_loop();
 
-  if (!ConfigSettings.disableWeb)
-  {
-    webServerHandleClient();
-  }
-  else
-  {
-    if (ConfigSettings.connectedClients == 0)
-    {
-      webServerHandleClient();
-    }
-  }
+  // HTTP is served by webTask(), see web.cpp
+  webLoop();
 
   if (ConfigSettings.enableWiFi == 0)
   {
@@ -1026,9 +925,8 @@ void loop(void)
     {
       if ((millis() - ConfigSettings.disconnectEthTime) >= (ETH_ERROR_TIME * 1000))
       {
-        DEBUG_PRINTLN(F("NO ETH and not enabled WIFI. saveEmergencyWifi(1)"));
+        LOGW(NET, "NO ETH and not enabled WIFI. saveEmergencyWifi(1), restart");
         saveEmergencyWifi(1);
-        DEBUG_PRINTLN(F("ESP.restart"));
         ESP.restart();
       }
     }
@@ -1045,68 +943,9 @@ void loop(void)
   //  }
   //}
 
-  
-
-  if (server.hasClient())
-  {
-    for (byte i = 0; i < MAX_SOCKET_CLIENTS; i++)
-    {
-      //find free/disconnected spot
-      if (!client[i] || !client[i].connected())
-      {
-        if (client[i])
-        {
-          client[i].stop();
-        }
-        client[i] = server.available();
-        continue;
-      }
-    }
-    //no free/disconnected spot so reject
-    WiFiClient TempClient = server.available();
-    TempClient.stop();
-  }
-
-  for (byte cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
-  {
-    if (client[cln])
-    {
-      socketClientConnected(cln);
-      while (client[cln].available())
-      { // read from LAN
-        net_buf[net_bytes_read] = client[cln].read();
-        if (net_bytes_read < BUFFER_SIZE - 1)
-          net_bytes_read++;
-      } // send to Zigbee
-      Serial2.write(net_buf, net_bytes_read);
-      // print to web console
-      printRecvSocket(net_bytes_read, net_buf);
-      net_bytes_read = 0;
-    }
-    else
-    {
-      socketClientDisconnected(cln);
-    }
-  }
-
-  if (Serial2.available())
-  {
-    while (Serial2.available())
-    { // read from Zigbee
-      serial_buf[serial_bytes_read] = Serial2.read();
-      if (serial_bytes_read < BUFFER_SIZE - 1)
-        serial_bytes_read++;
-    }
-    // send to LAN
-    for (byte cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
-    {
-      if (client[cln])
-        client[cln].write(serial_buf, serial_bytes_read);
-    }
-    // print to web console
-    printSendSocket(serial_bytes_read, serial_buf);
-    serial_bytes_read = 0;
-  }
+  // socket traffic is handled by bridgeTask(), see bridge.cpp
+  bridgeLoop();
+  logSerialLoop();
 
   if (ConfigSettings.mqttEnable && (ConfigSettings.connectedEther || ConfigSettings.enableWiFi || ConfigSettings.emergencyWifi))
   {
@@ -12,6 +12,7 @@
 #include "etc.h"
 #include <PubSubClient.h>
 #include "mqtt.h"
+#include "bridge.h"
 
 extern struct ConfigSettingsStruct ConfigSettings;
 
@@ -27,7 +28,7 @@ void mqttConnectSetup()
 
 void mqttReconnect()
 {
-    DEBUG_PRINT(F("Attempting MQTT connection..."));
+    LOGD(MQTT, "Attempting MQTT connection...");
 
     byte willQoS = 0;
     String willTopic = String(ConfigSettings.mqttTopic) + "/avty";
@@ -43,11 +44,7 @@ void mqttReconnect()
     }
     else
     {
-        DEBUG_PRINT(F("failed, rc="));
-        DEBUG_PRINT(clientPubSub.state());
-        DEBUG_PRINT(F(" try again in "));
-        DEBUG_PRINT(ConfigSettings.mqttInterval);
-        DEBUG_PRINTLN(F(" seconds"));
+        LOGW(MQTT, "MQTT connect failed, rc=%d try again in %d seconds", clientPubSub.state(), ConfigSettings.mqttInterval);
 
         ConfigSettings.mqttReconnectTime = millis() + ConfigSettings.mqttInterval * 1000;
     }
@@ -55,34 +52,60 @@ void mqttReconnect()
 
 void mqttOnConnect()
 {
-    DEBUG_PRINTLN(F("connected"));
+    LOGI(MQTT, "MQTT connected");
     mqttSubscribe("cmd");
-    DEBUG_PRINTLN(F("mqtt Subscribed"));
+    LOGD(MQTT, "mqtt Subscribed");
     if (ConfigSettings.mqttDiscovery)
     {
         mqttPublishDiscovery();
-        DEBUG_PRINTLN(F("mqtt Published Discovery"));
+        LOGD(MQTT, "mqtt Published Discovery");
     }
 
     mqttPublishIo("rst_esp", "OFF");
     mqttPublishIo("rst_zig", "OFF");
     mqttPublishIo("enbl_bsl", "OFF");
     mqttPublishIo("socket", "OFF");
-    DEBUG_PRINTLN(F("mqtt Published IOs"));
+    LOGD(MQTT, "mqtt Published IOs");
     mqttPublishAvty();
-    DEBUG_PRINTLN(F("mqtt Published Avty"));
+    LOGD(MQTT, "mqtt Published Avty");
+    mqttPublishLastLog();
     if (ConfigSettings.mqttInterval > 0)
     {
         mqttPublishState();
-        DEBUG_PRINTLN(F("mqtt Published State"));
+        LOGD(MQTT, "mqtt Published State");
     }
 }
 
-void mqttPublishMsg(String topic, String msg, bool retain)
+// once per boot: why the previous one ended and the end of its console
+void mqttPublishLastLog()
 {
-    clientPubSub.beginPublish(topic.c_str(), msg.length(), retain);
-    clientPubSub.print(msg.c_str());
-    clientPubSub.endPublish();
+    static bool published = false;
+    if (published)
+        return;
+    published = true;
+
+    String tail = logPrintLast(false);
+    if (tail.length() > LASTLOG_MQTT_MAX)
+    {
+        int cut = tail.indexOf('\n', tail.length() - LASTLOG_MQTT_MAX);
+        tail = tail.substring(cut < 0 ? tail.length() - LASTLOG_MQTT_MAX : cut + 1);
+    }
+    DynamicJsonDocument doc(LASTLOG_MQTT_MAX + 256);
+    doc["reset"] = logResetReason();
+    doc["log"] = tail;
+    String payload;
+    serializeJson(doc, payload);
+    mqttPublishMsg(String(ConfigSettings.mqttTopic) + "/lastlog", payload, true);
+}
+
+// streamed, so msg may be longer than the PubSubClient buffer
+bool mqttPublishMsg(String topic, String msg, bool retain)
+{
+    if (!clientPubSub.beginPublish(topic.c_str(), msg.length(), retain))
+        return false;
+    if (clientPubSub.write((const uint8_t *)msg.c_str(), msg.length()) != msg.length())
+        return false;
+    return clientPubSub.endPublish();
 }
 
 void mqttPublishAvty()
@@ -152,11 +175,21 @@ void mqttPublishState()
     root["hostname"] = ConfigSettings.hostname;
     String mqttBuffer;
     serializeJson(root, mqttBuffer);
-    DEBUG_PRINTLN(mqttBuffer);
+    LOGD(MQTT, "%s", mqttBuffer);
     clientPubSub.publish(topic.c_str(), mqttBuffer.c_str(), true);
     ConfigSettings.mqttHeartbeatTime = millis() + (ConfigSettings.mqttInterval * 1000);
 }
 
+void mqttPublishMetrics()
+{
+    String topic(ConfigSettings.mqttTopic);
+    topic = topic + "/metrics";
+    if (!mqttPublishMsg(topic, bridgeMetricsJson(false), false))
+    {
+        LOGW(MQTT, "%s publish failed", topic);
+    }
+}
+
 void mqttPublishIo(String const &io, String const &state)
 {
     if (clientPubSub.connected())
@@ -179,27 +212,25 @@ void mqttCallback(char *topic, byte *payload, unsigned int length)
 
     const char *command = jsonBuffer["cmd"];
 
-    DEBUG_PRINT(F("mqtt Callback - "));
-    DEBUG_PRINTLN(jjson);
+    LOGD(MQTT, "mqtt Callback - %s", jjson);
 
     if (command) {
-        DEBUG_PRINT(F("mqtt cmd - "));
-        DEBUG_PRINTLN(command);
+        LOGD(MQTT, "mqtt cmd - %s", command);
         if (strcmp(command, "rst_esp") == 0)
         {
-            printLogMsg("ESP restart MQTT");
+            LOGI(MQTT, "ESP restart MQTT");
             ESP.restart();
         }
 
         if (strcmp(command, "rst_zig") == 0)
         {
-            printLogMsg("Zigbee restart MQTT");
+            LOGI(MQTT, "Zigbee restart MQTT");
             zigbeeRestart();
         }
 
         if (strcmp(command, "enbl_bsl") == 0)
         {
-            printLogMsg("Zigbee BSL enable MQTT");
+            LOGI(MQTT, "Zigbee BSL enable MQTT");
             zigbeeEnableBSL();
         }
     }
@@ -220,7 +251,7 @@ void mqttLoop()
         if (ConfigSettings.mqttReconnectTime == 0)
         {
             //mqttReconnect();
-            DEBUG_PRINTLN(F("mqttReconnect in 5 seconds"));
+            LOGD(MQTT, "mqttReconnect in 5 seconds");
             ConfigSettings.mqttReconnectTime = millis() + 5000;
         }
         else
@@ -239,6 +270,10 @@ void mqttLoop()
             if (ConfigSettings.mqttHeartbeatTime <= millis())
             {
                 mqttPublishState();
+                if (ConfigSettings.mqttMetrics)
+                {
+                    mqttPublishMetrics();
+                }
             }
         }
     }
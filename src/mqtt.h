@@ -4,9 +4,11 @@ void mqttReconnect();
 void mqttCallback(char *topic, byte *payload, unsigned int length);
 void mqttLoop();
 void mqttPublishState();
+void mqttPublishMetrics();
+void mqttPublishLastLog();
 void mqttOnConnect();
 void mqttPublishAvty();
 void mqttPublishDiscovery();
-void mqttPublishMsg(String topic, String msg, bool retain);
+bool mqttPublishMsg(String topic, String msg, bool retain);
 void mqttPublishIo(String const &io, String const &state);
 void mqttSubscribe(String topic);
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include <Arduino.h>
+#include <stdarg.h>
+#include "page.h"
+
+void PageWriter::begin(int code, const char *type)
+{
+  len = 0;
+  if (!server)
+    return;
+  // chunked for HTTP/1.1, HTTP/1.0 clients read until the connection closes
+  server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server->send(code, type, "");
+}
+
+void PageWriter::end()
+{
+  flush();
+  if (server)
+    server->sendContent("", 0);
+}
+
+void PageWriter::flush()
+{
+  // an empty chunk would end the page
+  if (len == 0)
+    return;
+  if (server)
+    server->sendContent(buf, len);
+  else
+    out->concat(buf, len);
+  len = 0;
+}
+
+void PageWriter::write(const char *data, size_t size)
+{
+  while (size > 0)
+  {
+    if (len == sizeof(buf))
+      flush();
+    size_t n = sizeof(buf) - len;
+    if (n > size)
+      n = size;
+    memcpy(buf + len, data, n);
+    len += n;
+    data += n;
+    size -= n;
+  }
+}
+
+void PageWriter::printf(const char *format, ...)
+{
+  va_list args;
+  for (int retry = 0; retry < 2; retry++)
+  {
+    size_t space = sizeof(buf) - len;
+    va_start(args, format);
+    int n = vsnprintf(buf + len, space, format, args);
+    va_end(args);
+    if (n < 0)
+      return;
+    if ((size_t)n < space)
+    {
+      len += n;
+      return;
+    }
+    if (len == 0)
+    {
+      // longer than the whole buffer, cut
+      len = space - 1;
+      return;
+    }
+    flush();
+  }
+}
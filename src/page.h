@@ -0,0 +1,92 @@
+#ifndef PAGE_H_
+#define PAGE_H_
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include "config.h"
+
+// A compiled page template (src/webh/templates.h, generated from
+// src/websrc/html): each segment is a span of text followed by a field,
+// Field is the enum class of the template's fields.
+#define PAGE_NO_FIELD 0xff
+
+struct PageSegment
+{
+  uint16_t offset;
+  uint16_t len;
+  uint8_t field;
+};
+
+template <typename Field>
+struct PageTemplate
+{
+  const char *text;
+  const PageSegment *segments;
+  uint16_t count;
+};
+
+// the Field of templates without fields
+enum class PageNoField : uint8_t
+{
+};
+
+// A page sent while it is put together. Template text is copied from flash
+// into one PAGE_BUFFER sized buffer, fields are filled by a callback
+// writing into the same buffer, and every full buffer goes out as an HTTP
+// chunk: no part of the page is kept on the heap.
+class PageWriter
+{
+public:
+  explicit PageWriter(WebServer &server) : server(&server), out(NULL), len(0) {}
+  // collects the page in a String instead
+  explicit PageWriter(String &out) : server(NULL), out(&out), len(0) {}
+
+  void begin(int code, const char *type = "text/html");
+  // sends the last chunk, the browser waits for it
+  void end();
+
+  void write(const char *data, size_t size);
+  void print(const char *text) { write(text, strlen(text)); }
+  void print(const String &text) { write(text.c_str(), text.length()); }
+  void print(int value) { printf("%d", value); }
+  void print(unsigned int value) { printf("%u", value); }
+  void print(long value) { printf("%ld", value); }
+  void print(unsigned long value) { printf("%lu", value); }
+  // two decimals, like String(float)
+  void print(double value) { printf("%.2f", value); }
+  void printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  // text only when on, for checked and selected attributes
+  void flag(bool on, const char *text = "checked")
+  {
+    if (on)
+      print(text);
+  }
+
+  // fill(page, field) writes the value of each field in turn
+  template <typename Field, typename Fill>
+  void render(const PageTemplate<Field> &tmpl, Fill fill)
+  {
+    for (uint16_t i = 0; i < tmpl.count; i++)
+    {
+      const PageSegment &segment = tmpl.segments[i];
+      write(tmpl.text + segment.offset, segment.len);
+      if (segment.field != PAGE_NO_FIELD)
+        fill(*this, (Field)segment.field);
+    }
+  }
+
+  void render(const PageTemplate<PageNoField> &tmpl)
+  {
+    render(tmpl, [](PageWriter &, PageNoField) {});
+  }
+
+private:
+  void flush();
+
+  WebServer *server;
+  String *out;
+  char buf[PAGE_BUFFER];
+  size_t len;
+};
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef PLATFORM_H_
+#define PLATFORM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// What the bridge core needs from the target. Implemented by
+// platform_esp32.cpp for the firmware and platform_native.cpp for the host
+// build, where the UART is a pseudo-terminal and sockets are plain Linux
+// sockets.
+
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef ARDUINO
+#include <lwip/sockets.h>
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#endif
+
+uint32_t platformMillis();
+uint32_t platformMicros();
+void platformSleep(uint32_t ms);
+
+// UART, never blocks. platformUartFd() becomes readable on UART activity
+// (-1 if there is no such fd and the core has to poll), platformUartAck()
+// is called after it was.
+int platformUartFd();
+void platformUartAck();
+size_t platformUartAvailable();
+size_t platformUartRead(uint8_t *data, size_t len);
+size_t platformUartWrite(const uint8_t *data, size_t len);
+// true once after the receiver lost data
+bool platformUartOverflow();
+
+// reports from the bridge task
+void platformLog(const char *msg);
+// client is -1 for UART data sent to more than one client
+void platformTrace(bool toUart, int client, const uint8_t *data, size_t len);
+void platformClientEvent(int client, bool connected);
+void platformSlowClient(int client, const char *ip, uint32_t lag, bool dropped);
+
+#endif
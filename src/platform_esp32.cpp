@@ -0,0 +1,268 @@
+#include <Arduino.h>
+#include <esp_vfs_eventfd.h>
+#include <esp_timer.h>
+#include "config.h"
+#include "log.h"
+#include "mqtt.h"
+#include "web.h"
+#include "platform.h"
+#include "bridge.h"
+
+extern struct ConfigSettingsStruct ConfigSettings;
+
+struct SlowClientEvent
+{
+  int client;
+  uint32_t lag;
+  bool dropped;
+  char ip[16];
+};
+// handed over to loop(), which publishes them to MQTT
+QueueHandle_t slowClientQueue = NULL;
+
+TaskHandle_t bridgeTaskHandle = NULL;
+// /metrics and the MQTT metrics topic share the bridge's one snapshot
+SemaphoreHandle_t metricsMutex = NULL;
+int uartEventFd = -1;
+volatile bool uartOverflow = false;
+
+uint32_t platformMillis()
+{
+  return millis();
+}
+
+uint32_t platformMicros()
+{
+  return (uint32_t)esp_timer_get_time();
+}
+
+void platformSleep(uint32_t ms)
+{
+  vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+int platformUartFd()
+{
+  return uartEventFd;
+}
+
+void platformUartAck()
+{
+  uint64_t count;
+  read(uartEventFd, &count, sizeof(count));
+}
+
+size_t platformUartAvailable()
+{
+  return Serial2.available();
+}
+
+size_t platformUartRead(uint8_t *data, size_t len)
+{
+  return Serial2.read(data, len);
+}
+
+size_t platformUartWrite(const uint8_t *data, size_t len)
+{
+  size_t room = Serial2.availableForWrite();
+  if (room == 0)
+    return 0;
+  return Serial2.write(data, std::min(len, room));
+}
+
+bool platformUartOverflow()
+{
+  if (!uartOverflow)
+    return false;
+  uartOverflow = false;
+  return true;
+}
+
+// the core formats its own messages, they are rare
+void platformLog(const char *msg)
+{
+  LOGI(BRIDGE, "%s", msg);
+}
+
+// just a copy into the console ring, formatted when the console is read
+void platformTrace(bool toUart, int client, const uint8_t *data, size_t len)
+{
+  if (len == 0)
+    return;
+  logRecord(toUart ? LOG_TO_UART : LOG_FROM_UART, client < 0 ? LOG_NO_CLIENT : client, data, len);
+}
+
+void platformClientEvent(int client, bool connected)
+{
+  if (connected && ConfigSettings.connectedSocket[client] != true)
+  {
+    LOGD(BRIDGE, "Connected client %d", client);
+    if (ConfigSettings.connectedClients == 0)
+    {
+      ConfigSettings.socketTime = millis();
+      LOGD(BRIDGE, "Socket time %lu", ConfigSettings.socketTime);
+    }
+    ConfigSettings.connectedSocket[client] = true;
+    ConfigSettings.connectedClients++;
+  }
+  else if (!connected && ConfigSettings.connectedSocket[client] != false)
+  {
+    LOGD(BRIDGE, "Disconnected client %d", client);
+    ConfigSettings.connectedSocket[client] = false;
+    ConfigSettings.connectedClients--;
+    if (ConfigSettings.connectedClients == 0)
+    {
+      ConfigSettings.socketTime = millis();
+      LOGD(BRIDGE, "Socket time %lu", ConfigSettings.socketTime);
+    }
+  }
+}
+
+void platformSlowClient(int client, const char *ip, uint32_t lag, bool dropped)
+{
+  SlowClientEvent event;
+  event.client = client;
+  event.lag = lag;
+  event.dropped = dropped;
+  strlcpy(event.ip, ip, sizeof(event.ip));
+  if (slowClientQueue)
+  {
+    xQueueSend(slowClientQueue, &event, 0);
+  }
+}
+
+void bridgeWake()
+{
+  if (uartEventFd >= 0)
+  {
+    uint64_t count = 1;
+    write(uartEventFd, &count, sizeof(count));
+  }
+}
+
+void bridgeTask(void *param)
+{
+  for (;;)
+  {
+    bridgeRun();
+  }
+}
+
+void bridgeStart()
+{
+  BridgeConfig config;
+  config.socketPort = ConfigSettings.socketPort;
+  config.serialRingSize = ConfigSettings.serialRingSize;
+  config.netRingSize = ConfigSettings.netRingSize;
+  config.znpFramer = ConfigSettings.znpFramer;
+  config.framerTimeout = ConfigSettings.framerTimeout;
+  config.clientLag = ConfigSettings.clientLag;
+  config.slowClientDrop = ConfigSettings.slowClientDrop;
+  config.writerBudget = ConfigSettings.writerBudget;
+  config.clientRoles = ConfigSettings.clientRoles;
+  strlcpy(config.primaryIp, ConfigSettings.primaryIp, sizeof(config.primaryIp));
+  config.observerRefuse = ConfigSettings.observerRefuse;
+  config.srspRouting = ConfigSettings.srspRouting;
+
+  ConfigSettings.connectedClients = 0;
+  slowClientQueue = xQueueCreate(4, sizeof(SlowClientEvent));
+  metricsMutex = xSemaphoreCreateMutex();
+
+  esp_vfs_eventfd_config_t eventfdConfig = ESP_VFS_EVENTD_CONFIG_DEFAULT();
+  esp_vfs_eventfd_register(&eventfdConfig);
+  uartEventFd = eventfd(0, 0);
+  if (uartEventFd < 0)
+  {
+    LOGW(BRIDGE, "eventfd failed, bridge falls back to polling");
+  }
+
+  if (!bridgeBegin(config))
+  {
+    LOGE(BRIDGE, "Bridge start failed");
+    return;
+  }
+
+  // data, FIFO-full and break events from the UART driver wake the bridge
+  Serial2.onReceive(bridgeWake);
+  Serial2.onReceiveError([](hardwareSerial_error_t error)
+                         {
+                           if (error == UART_BUFFER_FULL_ERROR || error == UART_FIFO_OVF_ERROR)
+                           {
+                             uartOverflow = true;
+                           }
+                           bridgeWake(); });
+
+  xTaskCreatePinnedToCore(bridgeTask, "bridge", BRIDGE_TASK_STACK, NULL, BRIDGE_TASK_PRIORITY, &bridgeTaskHandle, BRIDGE_TASK_CORE);
+}
+
+String latencyJson(const LatencyHistogram &hist, bool withBuckets)
+{
+  String json = "{\"count\":" + String(hist.count) + ",\"mean\":" + String(hist.mean()) + ",\"p50\":" + String(hist.percentile(50)) + ",\"p90\":" + String(hist.percentile(90)) + ",\"p99\":" + String(hist.percentile(99)) + ",\"max\":" + String(hist.max);
+  if (!withBuckets)
+    return json + "}";
+  json += ",\"buckets\":[";
+  for (int i = 0; i < LatencyHistogram::BUCKETS; i++)
+  {
+    if (i > 0)
+      json += ",";
+    json += String(hist.buckets[i]);
+  }
+  json += "]}";
+  return json;
+}
+
+// latency in microseconds, bucket n counts samples up to 2^n us
+String bridgeMetricsJson(bool withBuckets)
+{
+  if (!metricsMutex)
+    return "{}";
+  xSemaphoreTake(metricsMutex, portMAX_DELAY);
+  if (!bridgeLatencySnapshot(4 * BRIDGE_IDLE_MS))
+  {
+    LOGW(BRIDGE, "Latency snapshot timed out, metrics are stale");
+  }
+  LatencyHistogram hist;
+  String json = "{";
+  bridgeLatency(-1, LATENCY_UART_TO_TCP, hist);
+  json += "\"uart_to_tcp\":" + latencyJson(hist, withBuckets);
+  bridgeLatency(-1, LATENCY_TCP_TO_UART, hist);
+  json += ",\"tcp_to_uart\":" + latencyJson(hist, withBuckets);
+  json += ",\"clients\":[";
+  bool first = true;
+  for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
+  {
+    BridgeClientInfo info;
+    if (!bridgeClientInfo(cln, info) || !info.connected)
+      continue;
+    if (!first)
+      json += ",";
+    first = false;
+    json += "{\"client\":" + String(cln) + ",\"ip\":\"" + info.ip + "\"";
+    bridgeLatency(cln, LATENCY_UART_TO_TCP, hist);
+    json += ",\"uart_to_tcp\":" + latencyJson(hist, withBuckets);
+    bridgeLatency(cln, LATENCY_TCP_TO_UART, hist);
+    json += ",\"tcp_to_uart\":" + latencyJson(hist, withBuckets) + "}";
+  }
+  xSemaphoreGive(metricsMutex);
+  json += "]}";
+  return json;
+}
+
+// runs from loop(), MQTT is not thread safe so the bridge task never publishes itself
+void bridgeLoop()
+{
+  static bool socketState = false;
+  bool state = ConfigSettings.connectedClients > 0;
+  if (state != socketState)
+  {
+    socketState = state;
+    mqttPublishIo("socket", state ? "ON" : "OFF");
+  }
+
+  SlowClientEvent event;
+  while (slowClientQueue && xQueueReceive(slowClientQueue, &event, 0) == pdTRUE)
+  {
+    String msg = "{\"client\":" + String(event.client) + ",\"ip\":\"" + event.ip + "\",\"lag\":" + String(event.lag) + ",\"action\":\"" + (event.dropped ? "dropped" : "skipped") + "\"}";
+    mqttPublishMsg(String(ConfigSettings.mqttTopic) + "/slow_client", msg, false);
+  }
+}
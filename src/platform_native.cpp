@@ -0,0 +1,205 @@
+// Host build of the bridge core (pio run -e native). The Zigbee UART is the
+// master side of a pseudo-terminal, whatever opens the slave side plays
+// the ZNP; clients connect over loopback TCP like they would to the gateway.
+#include <errno.h>
+#include <getopt.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <sys/ioctl.h>
+#include "config.h"
+#include "platform.h"
+#include "bridge.h"
+#include "znp.h"
+
+int ptyMaster = -1;
+int ptySlave = -1;
+bool trace = false;
+
+uint32_t platformMillis()
+{
+  return platformMicros() / 1000;
+}
+
+uint32_t platformMicros()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+}
+
+void platformSleep(uint32_t ms)
+{
+  usleep(ms * 1000);
+}
+
+int platformUartFd()
+{
+  return ptyMaster;
+}
+
+void platformUartAck()
+{
+}
+
+size_t platformUartAvailable()
+{
+  int count = 0;
+  if (ioctl(ptyMaster, FIONREAD, &count) < 0)
+    return 0;
+  return count;
+}
+
+size_t platformUartRead(uint8_t *data, size_t len)
+{
+  ssize_t n = read(ptyMaster, data, len);
+  return n > 0 ? n : 0;
+}
+
+size_t platformUartWrite(const uint8_t *data, size_t len)
+{
+  ssize_t n = write(ptyMaster, data, len);
+  return n > 0 ? n : 0;
+}
+
+bool platformUartOverflow()
+{
+  return false;
+}
+
+void platformLog(const char *msg)
+{
+  fprintf(stderr, "[%u] %s\n", platformMillis(), msg);
+}
+
+void platformTrace(bool toUart, int client, const uint8_t *data, size_t len)
+{
+  if (!trace)
+    return;
+  fprintf(stderr, "[%u] %d %s", platformMillis(), client, toUart ? "->" : "<-");
+  for (size_t i = 0; i < len; i++)
+  {
+    fprintf(stderr, " %02x", data[i]);
+  }
+  char text[160];
+  if (znpDissect(data, len, text, sizeof(text)) > 0)
+  {
+    fprintf(stderr, " : %s", text);
+  }
+  fprintf(stderr, "\n");
+}
+
+void platformClientEvent(int client, bool connected)
+{
+  fprintf(stderr, "[%u] Client %d %s\n", platformMillis(), client, connected ? "connected" : "disconnected");
+}
+
+// bridgeLog() already printed it, there is no MQTT to publish it to
+void platformSlowClient(int, const char *, uint32_t, bool)
+{
+}
+
+bool ptyOpen(const char *link)
+{
+  ptyMaster = posix_openpt(O_RDWR | O_NOCTTY);
+  if (ptyMaster < 0 || grantpt(ptyMaster) < 0 || unlockpt(ptyMaster) < 0)
+    return false;
+  const char *name = ptsname(ptyMaster);
+
+  // keep the slave open: raw mode sticks and the master never reads EIO
+  // while the simulator reconnects
+  ptySlave = open(name, O_RDWR | O_NOCTTY);
+  if (ptySlave < 0)
+    return false;
+  struct termios tio;
+  tcgetattr(ptySlave, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(ptySlave, TCSANOW, &tio);
+  fcntl(ptyMaster, F_SETFL, fcntl(ptyMaster, F_GETFL, 0) | O_NONBLOCK);
+
+  if (link)
+  {
+    unlink(link);
+    if (symlink(name, link) < 0)
+      return false;
+    name = link;
+  }
+  printf("uart %s\n", name);
+  fflush(stdout);
+  return true;
+}
+
+void usage(const char *name)
+{
+  fprintf(stderr, "usage: %s [-p port] [-l pty link] [-f] [-r] [-s] [-v]\n"
+                  "  -f  reassemble ZNP frames (needed for -s and AREQ filters)\n"
+                  "  -r  primary/observer client roles\n"
+                  "  -s  disable SRSP routing\n"
+                  "  -v  print forwarded data\n",
+          name);
+}
+
+// pio test links the bridge into test runners that bring their own main()
+#ifndef PIO_UNIT_TESTING
+int main(int argc, char **argv)
+{
+  BridgeConfig config = {};
+  config.socketPort = 6638;
+  config.serialRingSize = SERIAL_RING_SIZE;
+  config.netRingSize = NET_RING_SIZE;
+  config.framerTimeout = FRAMER_TIMEOUT_MS;
+  config.clientLag = CLIENT_LAG;
+  config.slowClientDrop = true;
+  config.writerBudget = WRITER_BUDGET;
+  config.srspRouting = true;
+  const char *link = NULL;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "p:l:frsvh")) != -1)
+  {
+    switch (opt)
+    {
+    case 'p':
+      config.socketPort = atoi(optarg);
+      break;
+    case 'l':
+      link = optarg;
+      break;
+    case 'f':
+      config.znpFramer = true;
+      break;
+    case 'r':
+      config.clientRoles = true;
+      break;
+    case 's':
+      config.srspRouting = false;
+      break;
+    case 'v':
+      trace = true;
+      break;
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  signal(SIGPIPE, SIG_IGN);
+  if (!ptyOpen(link))
+  {
+    fprintf(stderr, "pty: %s\n", strerror(errno));
+    return 1;
+  }
+  if (!bridgeBegin(config))
+    return 1;
+  printf("tcp %d\n", config.socketPort);
+  fflush(stdout);
+
+  for (;;)
+  {
+    bridgeRun();
+  }
+}
+#endif
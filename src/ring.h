@@ -0,0 +1,450 @@
+#ifndef RING_H_
+#define RING_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+
+// Single-producer/single-consumer byte ring.
+// Capacity is a power of two so indexes wrap with a mask; head is only
+// written by the producer and tail only by the consumer, so one side may
+// run in another task without a lock. A full ring refuses data instead of
+// overwriting it: the producer leaves the rest in its source (UART driver
+// buffer, socket receive window) until space frees up.
+class ByteRing
+{
+public:
+  bool begin(size_t size)
+  {
+    size_t capacity = RING_MIN_SIZE;
+    while (capacity < size && capacity < RING_MAX_SIZE)
+      capacity <<= 1;
+
+    free(buf);
+    buf = (uint8_t *)malloc(capacity);
+    if (!buf)
+    {
+      mask = 0;
+      return false;
+    }
+    mask = capacity - 1;
+    head.store(0);
+    tail.store(0);
+    return true;
+  }
+
+  size_t capacity() const { return buf ? mask + 1 : 0; }
+  size_t available() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed); }
+  size_t space() const { return capacity() - (head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire)); }
+  bool isEmpty() const { return available() == 0; }
+  // absolute stream positions of the next byte written and read
+  size_t writePos() const { return head.load(std::memory_order_relaxed); }
+  size_t readPos() const { return tail.load(std::memory_order_relaxed); }
+
+  // producer side
+  size_t write(const uint8_t *data, size_t len)
+  {
+    size_t done = 0;
+    while (done < len)
+    {
+      size_t span;
+      uint8_t *ptr = writePtr(span);
+      if (span == 0)
+        break;
+      if (span > len - done)
+        span = len - done;
+      memcpy(ptr, data + done, span);
+      commit(span);
+      done += span;
+    }
+    return done;
+  }
+
+  // contiguous free span, fill it directly (e.g. from read(buf, len)) then commit()
+  uint8_t *writePtr(size_t &span)
+  {
+    size_t h = head.load(std::memory_order_relaxed);
+    size_t room = space();
+    size_t toEnd = capacity() - (h & mask);
+    span = room < toEnd ? room : toEnd;
+    return buf + (h & mask);
+  }
+
+  void commit(size_t len)
+  {
+    head.store(head.load(std::memory_order_relaxed) + len, std::memory_order_release);
+  }
+
+  // consumer side
+  size_t read(uint8_t *data, size_t len)
+  {
+    size_t done = 0;
+    while (done < len)
+    {
+      size_t span;
+      const uint8_t *ptr = readPtr(span);
+      if (span == 0)
+        break;
+      if (span > len - done)
+        span = len - done;
+      memcpy(data + done, ptr, span);
+      consume(span);
+      done += span;
+    }
+    return done;
+  }
+
+  // contiguous readable span, hand it straight to write(buf, len) then consume()
+  const uint8_t *readPtr(size_t &span) const
+  {
+    size_t t = tail.load(std::memory_order_relaxed);
+    size_t used = available();
+    size_t toEnd = capacity() - (t & mask);
+    span = used < toEnd ? used : toEnd;
+    return buf + (t & mask);
+  }
+
+  void consume(size_t len)
+  {
+    tail.store(tail.load(std::memory_order_relaxed) + len, std::memory_order_release);
+  }
+
+  static const size_t RING_MIN_SIZE = 256;
+  static const size_t RING_MAX_SIZE = 32768;
+
+private:
+  uint8_t *buf = nullptr;
+  size_t mask = 0;
+  std::atomic<size_t> head{0};
+  std::atomic<size_t> tail{0};
+};
+
+// Single-writer byte ring read by several consumers through their own
+// cursors (absolute stream positions). The writer never waits for readers:
+// callers check lag() before write() and move or drop readers that would
+// be overrun. Writer and readers must run in the same task.
+// A write can be limited to some readers (bit n = reader n); the others
+// skip() over it. Only a few such ranges are remembered until release()
+// drops them, past that a limited write goes to everyone.
+class BroadcastRing
+{
+public:
+  static const uint32_t ALL_READERS = 0xFFFFFFFF;
+  static const int MARK_COUNT = 64;
+
+  bool begin(size_t size)
+  {
+    size_t capacity = ByteRing::RING_MIN_SIZE;
+    while (capacity < size && capacity < ByteRing::RING_MAX_SIZE)
+      capacity <<= 1;
+
+    free(buf);
+    buf = (uint8_t *)malloc(capacity);
+    if (!buf)
+    {
+      mask = 0;
+      return false;
+    }
+    mask = capacity - 1;
+    restart(0);
+    return true;
+  }
+
+  size_t capacity() const { return buf ? mask + 1 : 0; }
+  size_t head() const { return pos; }
+  size_t lag(size_t cursor) const { return pos - cursor; }
+  // empties the ring and numbers positions from at on; positions wrap
+  // around, so they are only ever compared by their difference
+  void restart(size_t at)
+  {
+    pos = at;
+    markHead = 0;
+    markTail = 0;
+  }
+
+  void write(const uint8_t *data, size_t len, uint32_t readers)
+  {
+    // ranges already overwritten can't be read by anyone anymore
+    while (markTail != markHead && (long)(marks[markTail % MARK_COUNT].end + capacity() - (pos + len)) <= 0)
+      markTail++;
+    if (readers != ALL_READERS && len > 0 && markHead - markTail < MARK_COUNT)
+    {
+      Mark &m = marks[markHead % MARK_COUNT];
+      m.start = pos;
+      m.end = pos + len;
+      m.readers = readers;
+      markHead++;
+    }
+    write(data, len);
+  }
+
+  void write(const uint8_t *data, size_t len)
+  {
+    while (len > 0 && buf)
+    {
+      size_t toEnd = capacity() - (pos & mask);
+      size_t span = len < toEnd ? len : toEnd;
+      memcpy(buf + (pos & mask), data, span);
+      pos += span;
+      data += span;
+      len -= span;
+    }
+  }
+
+  // forgets reader masks of ranges that all readers have passed
+  void release(size_t cursor)
+  {
+    while (markTail != markHead && (long)(marks[markTail % MARK_COUNT].end - cursor) <= 0)
+      markTail++;
+  }
+
+  // moves cursor past ranges that were not written for this reader
+  size_t skip(size_t cursor, int reader) const
+  {
+    for (unsigned int i = markTail; i != markHead; i++)
+    {
+      const Mark &m = marks[i % MARK_COUNT];
+      if ((long)(m.end - cursor) <= 0 || (m.readers & (1UL << reader)))
+        continue;
+      if ((long)(m.start - cursor) > 0)
+        break;
+      cursor = m.end;
+    }
+    return cursor;
+  }
+
+  // as spans(), but stops in front of the next range skipped by this reader
+  int spans(size_t cursor, int reader, const uint8_t *ptr[2], size_t span[2]) const
+  {
+    size_t end = pos;
+    for (unsigned int i = markTail; i != markHead; i++)
+    {
+      const Mark &m = marks[i % MARK_COUNT];
+      if ((long)(m.end - cursor) > 0 && !(m.readers & (1UL << reader)))
+      {
+        if ((long)(m.start - cursor) <= 0)
+          return 0;
+        end = m.start;
+        break;
+      }
+    }
+    return spans(cursor, end, ptr, span);
+  }
+
+  // up to two spans (before and after the wrap) from cursor to head
+  int spans(size_t cursor, const uint8_t *ptr[2], size_t span[2]) const
+  {
+    return spans(cursor, pos, ptr, span);
+  }
+
+private:
+  int spans(size_t cursor, size_t end, const uint8_t *ptr[2], size_t span[2]) const
+  {
+    size_t used = end - cursor;
+    if (used == 0)
+      return 0;
+    size_t toEnd = capacity() - (cursor & mask);
+    ptr[0] = buf + (cursor & mask);
+    if (used <= toEnd)
+    {
+      span[0] = used;
+      return 1;
+    }
+    span[0] = toEnd;
+    ptr[1] = buf;
+    span[1] = used - toEnd;
+    return 2;
+  }
+
+  struct Mark
+  {
+    size_t start;
+    size_t end;
+    uint32_t readers;
+  };
+
+  uint8_t *buf = nullptr;
+  size_t mask = 0;
+  size_t pos = 0;
+  Mark marks[MARK_COUNT];
+  unsigned int markHead = 0;
+  unsigned int markTail = 0;
+};
+
+// Variable-length records, each a 16-bit length and the record bytes. A
+// full ring drops its oldest records to make room, so writers never wait.
+// Positions are absolute byte offsets: a reader keeps the position of the
+// next record it wants and knows it was overwritten once it is before
+// first(). Not thread safe, callers lock around it.
+class RecordRing
+{
+public:
+  bool begin(size_t size)
+  {
+    size_t capacity = ByteRing::RING_MIN_SIZE;
+    while (capacity < size && capacity < ByteRing::RING_MAX_SIZE)
+      capacity <<= 1;
+
+    if (owned)
+    {
+      free(buf);
+    }
+    buf = (uint8_t *)malloc(capacity);
+    owned = true;
+    if (!buf)
+    {
+      mask = 0;
+      return false;
+    }
+    mask = capacity - 1;
+    clear();
+    return true;
+  }
+
+  // storage the ring doesn't own, size a power of two; its bytes are left
+  // as they are for restore()
+  void begin(uint8_t *storage, size_t size)
+  {
+    if (owned)
+    {
+      free(buf);
+    }
+    buf = storage;
+    owned = false;
+    mask = size - 1;
+  }
+
+  // takes over records already in the storage, if their lengths chain
+  // from position from exactly to position to and none is shorter than
+  // minLength
+  bool restore(size_t from, size_t to, size_t minLength)
+  {
+    if (!buf || to - from > capacity())
+      return false;
+    for (size_t pos = from; pos != to; pos = next(pos))
+    {
+      if (to - pos < 2 || to - pos < 2 + length(pos) || length(pos) < minLength)
+        return false;
+    }
+    tail = from;
+    head = to;
+    return true;
+  }
+
+  size_t capacity() const { return buf ? mask + 1 : 0; }
+  size_t first() const { return tail; }
+  size_t end() const { return head; }
+  bool isEmpty() const { return head == tail; }
+  void clear() { tail = head; }
+  // empties the ring and numbers positions from pos on
+  void restart(size_t pos) { head = tail = pos; }
+
+  // drops the oldest records until one of len bytes fits, false if it
+  // never can; push() does this itself, call it first to learn the new
+  // first() before any byte is overwritten
+  bool makeRoom(size_t len)
+  {
+    if (!buf || len > 0xFFFF || len + 2 > capacity())
+      return false;
+    while (capacity() - (head - tail) < len + 2)
+      tail += 2 + length(tail);
+    return true;
+  }
+
+  // a record in two parts, e.g. a fixed header and a payload
+  bool push(const void *part1, size_t len1, const void *part2, size_t len2)
+  {
+    size_t len = len1 + len2;
+    if (!makeRoom(len))
+      return false;
+    uint8_t prefix[2] = {(uint8_t)(len & 0xFF), (uint8_t)(len >> 8)};
+    copyIn(prefix, 2);
+    copyIn(part1, len1);
+    copyIn(part2, len2);
+    return true;
+  }
+
+  // takes a copy of other's records from pos (one of its record positions)
+  // on, to read them without holding other's lock; capacity must be at
+  // least other's
+  bool copy(const RecordRing &other, size_t pos)
+  {
+    size_t len = other.head - pos;
+    if (!buf || len > capacity())
+      return false;
+    restart(pos);
+    while (len > 0)
+    {
+      size_t from = pos & other.mask;
+      size_t toEnd = other.capacity() - from;
+      size_t span = len < toEnd ? len : toEnd;
+      copyIn(other.buf + from, span);
+      pos += span;
+      len -= span;
+    }
+    return true;
+  }
+
+  // length of the record at pos and the position after it
+  size_t length(size_t pos) const { return buf[pos & mask] | (buf[(pos + 1) & mask] << 8); }
+  size_t next(size_t pos) const { return pos + 2 + length(pos); }
+
+  // copies up to max bytes of the record at pos, returns its full length
+  size_t read(size_t pos, void *data, size_t max) const
+  {
+    size_t len = length(pos);
+    size_t n = len < max ? len : max;
+    for (size_t i = 0; i < n; i++)
+    {
+      ((uint8_t *)data)[i] = buf[(pos + 2 + i) & mask];
+    }
+    return len;
+  }
+
+  // byte i of the record at pos, for formatting without a copy
+  uint8_t at(size_t pos, size_t i) const { return buf[(pos + 2 + i) & mask]; }
+
+  // up to two spans (before and after the wrap) of record bytes
+  // [offset, offset + len), to send them straight from the ring
+  int spans(size_t pos, size_t offset, size_t len, const uint8_t *ptr[2], size_t span[2]) const
+  {
+    if (len == 0)
+      return 0;
+    size_t start = pos + 2 + offset;
+    size_t toEnd = capacity() - (start & mask);
+    ptr[0] = buf + (start & mask);
+    if (len <= toEnd)
+    {
+      span[0] = len;
+      return 1;
+    }
+    span[0] = toEnd;
+    ptr[1] = buf;
+    span[1] = len - toEnd;
+    return 2;
+  }
+
+private:
+  void copyIn(const void *data, size_t len)
+  {
+    const uint8_t *src = (const uint8_t *)data;
+    while (len > 0)
+    {
+      size_t toEnd = capacity() - (head & mask);
+      size_t span = len < toEnd ? len : toEnd;
+      memcpy(buf + (head & mask), src, span);
+      head += span;
+      src += span;
+      len -= span;
+    }
+  }
+
+  uint8_t *buf = nullptr;
+  bool owned = false;
+  size_t mask = 0;
+  size_t head = 0;
+  size_t tail = 0;
+};
+
+#endif
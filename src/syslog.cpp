@@ -0,0 +1,123 @@
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#include <time.h>
+#include <atomic>
+#include "config.h"
+#include "log.h"
+#include "syslog.h"
+
+extern struct ConfigSettingsStruct ConfigSettings;
+
+struct SyslogRecord
+{
+  uint32_t time;
+  uint8_t len;
+  LogEvent event;
+};
+
+// filled from any task, drained by syslogTask
+QueueHandle_t syslogQueue = NULL;
+// counted by every pushing task, taken by syslogTask
+std::atomic<uint32_t> syslogDropped{0};
+
+void syslogPush(const LogEvent &event, size_t len)
+{
+  if (!syslogQueue)
+    return;
+  SyslogRecord record;
+  record.time = millis();
+  record.len = len;
+  memcpy(&record.event, &event, len);
+  while (xQueueSend(syslogQueue, &record, 0) != pdTRUE)
+  {
+    SyslogRecord oldest;
+    if (xQueueReceive(syslogQueue, &oldest, 0) == pdTRUE)
+    {
+      syslogDropped.fetch_add(1);
+    }
+  }
+}
+
+uint8_t syslogSeverity(uint8_t level)
+{
+  switch (level)
+  {
+  case LOG_LEVEL_ERROR:
+    return SYSLOG_ERR;
+  case LOG_LEVEL_WARN:
+    return SYSLOG_WARNING;
+  case LOG_LEVEL_INFO:
+    return SYSLOG_INFO;
+  default:
+    return SYSLOG_DEBUG;
+  }
+}
+
+// the module goes into MSGID
+size_t syslogFormat(uint32_t time, uint8_t severity, const char *module, const char *msg, char *out, size_t max)
+{
+  // nil timestamp until the wall clock was set
+  char stamp[24] = "-";
+  time_t now = time(NULL);
+  if (now > 1600000000)
+  {
+    time_t at = now - (millis() - time) / 1000;
+    struct tm tm;
+    gmtime_r(&at, &tm);
+    strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", &tm);
+  }
+  int n = snprintf(out, max, "<%u>1 %s %s zigstar - %s - %s", SYSLOG_FACILITY * 8 + severity, stamp, ConfigSettings.hostname, module, msg);
+  if (n < 0)
+    return 0;
+  return (size_t)n < max ? n : max - 1;
+}
+
+void syslogSend(WiFiUDP &udp, const char *message, size_t len)
+{
+  if (len == 0)
+    return;
+  if (udp.beginPacket(ConfigSettings.syslogServer, ConfigSettings.syslogPort))
+  {
+    udp.write((const uint8_t *)message, len);
+    udp.endPacket();
+  }
+}
+
+// Waits for a record, gives the burst it belongs to SYSLOG_BATCH_MS to
+// arrive, then sends everything queued. RFC 5426 allows one message per
+// datagram, so a burst is only paced, never packed together.
+void syslogTask(void *param)
+{
+  WiFiUDP udp;
+  char line[SYSLOG_MSG_MAX + 96];
+  char msg[SYSLOG_MSG_MAX];
+  SyslogRecord record;
+
+  for (;;)
+  {
+    xQueueReceive(syslogQueue, &record, portMAX_DELAY);
+    vTaskDelay(pdMS_TO_TICKS(SYSLOG_BATCH_MS));
+
+    uint32_t dropped = syslogDropped.exchange(0);
+    if (dropped)
+    {
+      snprintf(msg, sizeof(msg), "syslog queue full, %u records dropped", dropped);
+      syslogSend(udp, line, syslogFormat(millis(), SYSLOG_WARNING, "main", msg, line, sizeof(line)));
+    }
+    do
+    {
+      LogEvent event;
+      logEventRead(event, (const uint8_t *)&record.event, record.len);
+      logFormat(event, msg, sizeof(msg));
+      syslogSend(udp, line, syslogFormat(record.time, syslogSeverity(event.level), logModuleName(event.module), msg, line, sizeof(line)));
+    } while (xQueueReceive(syslogQueue, &record, 0) == pdTRUE);
+  }
+}
+
+void syslogBegin()
+{
+  if (!ConfigSettings.syslogEnable || strlen(ConfigSettings.syslogServer) == 0)
+    return;
+  syslogQueue = xQueueCreate(SYSLOG_QUEUE, sizeof(SyslogRecord));
+  xTaskCreatePinnedToCore(syslogTask, "syslog", SYSLOG_TASK_STACK, NULL, SYSLOG_TASK_PRIORITY, NULL, SYSLOG_TASK_CORE);
+}
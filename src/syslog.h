@@ -0,0 +1,13 @@
+// RFC 5424 severities
+#define SYSLOG_ERR 3
+#define SYSLOG_WARNING 4
+#define SYSLOG_NOTICE 5
+#define SYSLOG_INFO 6
+#define SYSLOG_DEBUG 7
+
+struct LogEvent;
+
+void syslogBegin();
+// never blocks, a full queue drops its oldest record; the first len bytes
+// of event are kept and formatted by the sender task
+void syslogPush(const LogEvent &event, size_t len);
@@ -3,53 +3,203 @@
 #include <ETH.h>
 #include "WiFi.h"
 #include <WebServer.h>
+#include <detail/RequestHandler.h>
+#include <errno.h>
+#include <lwip/sockets.h>
 #include "FS.h"
 //#include "FS.h"
 #include <LittleFS.h>
 #include "web.h"
 #include "config.h"
 #include "log.h"
+#include "ring.h"
 #include "etc.h"
+#include "bridge.h"
 #include <Update.h>
-#include "html.h"
+#include "page.h"
+#include "webh/templates.h"
 //#include "zigbee.h"
 #include <HTTPClient.h>
 
-#include "webh/glyphicons.woff.gz.h"
-#include "webh/required.css.gz.h"
-#include "webh/bootstrap.min.js.gz.h"
-#include "webh/functions.js.gz.h"
-#include "webh/jquery-min.js.gz.h"
-#include "webh/logo.png.gz.h"
-#include "webh/nok.png.gz.h"
-#include "webh/ok.png.gz.h"
-#include "webh/wait.gif.gz.h"
-#include "webh/toast.js.gz.h"
+#include "webh/assets.h"
+
+// a field added to a template but not filled by its handler fails the build
+#pragma GCC diagnostic error "-Wswitch"
 
 extern struct ConfigSettingsStruct ConfigSettings;
-extern unsigned long timeLog;
 
 WebServer serverWeb(80);
 
 HTTPClient clientWeb;
 
+// Zigbee pin sequences publish to MQTT, which only loop() may use; the
+// handlers leave them to webLoop()
+volatile bool zigbeeRestartPending = false;
+volatile bool zigbeeBslPending = false;
+
 void webServerHandleClient()
 {
   serverWeb.handleClient();
+  eventsLoop();
+  captureLoop();
+}
+
+// HTTP is served by its own task next to the network stack, away from the
+// bridge task's core and below everything else there: building a page or
+// a slow browser only holds up other web requests. One request is handled
+// at a time, plus the EVENT_CLIENTS and CAPTURE_CLIENTS streams.
+void webTask(void *param)
+{
+  for (;;)
+  {
+    webServerHandleClient();
+    vTaskDelay(pdMS_TO_TICKS(WEB_TASK_IDLE_MS));
+  }
+}
+
+void webLoop()
+{
+  if (zigbeeRestartPending)
+  {
+    zigbeeRestartPending = false;
+    zigbeeRestart();
+  }
+  if (zigbeeBslPending)
+  {
+    zigbeeBslPending = false;
+    zigbeeEnableBSL();
+  }
+}
+
+// Embedded assets go out with the content hash the asset build gave
+// them as a strong ETag. Pages link them as ?v=<hash>: such a URL always
+// has the same content and is cached for good, other requests revalidate
+// and get a 304 while the asset is unchanged. A single byte range of the
+// gzip data is served as a 206, HEAD gets the headers only.
+const WebAsset *assetFind(const char *url)
+{
+  size_t low = 0;
+  size_t high = WEB_ASSET_COUNT;
+  while (low < high)
+  {
+    size_t mid = (low + high) / 2;
+    int cmp = strcmp(url, WEB_ASSETS[mid].url);
+    if (cmp == 0)
+      return &WEB_ASSETS[mid];
+    if (cmp < 0)
+      high = mid;
+    else
+      low = mid + 1;
+  }
+  return NULL;
+}
+
+// "bytes=a-b", "bytes=a-" or "bytes=-n", false if not within len
+bool assetRange(const String &range, uint32_t len, uint32_t &from, uint32_t &to)
+{
+  const char *spec = range.c_str() + strlen("bytes=");
+  char *end;
+  to = len - 1;
+  if (*spec == '-')
+  {
+    uint32_t suffix = strtoul(spec + 1, &end, 10);
+    if (*end || suffix == 0)
+      return false;
+    from = suffix < len ? len - suffix : 0;
+    return true;
+  }
+  from = strtoul(spec, &end, 10);
+  if (end == spec || *end != '-' || from >= len)
+    return false;
+  spec = end + 1;
+  if (*spec)
+  {
+    uint32_t last = strtoul(spec, &end, 10);
+    if (*end || last < from)
+      return false;
+    if (last < to)
+      to = last;
+  }
+  return true;
+}
+
+void sendAsset(const WebAsset &asset)
+{
+  String etag = String("\"") + asset.hash + "\"";
+  serverWeb.sendHeader(F("ETag"), etag);
+  if (serverWeb.arg("v") == asset.hash)
+  {
+    serverWeb.sendHeader(F("Cache-Control"), F("public, max-age=31536000, immutable"));
+  }
+  else
+  {
+    serverWeb.sendHeader(F("Cache-Control"), F("no-cache"));
+  }
+
+  String match = serverWeb.header("If-None-Match");
+  if (match == "*" || match.indexOf(etag) >= 0)
+  {
+    serverWeb.send(304);
+    return;
+  }
+  serverWeb.sendHeader(F("Content-Encoding"), F("gzip"));
+  serverWeb.sendHeader(F("Accept-Ranges"), F("bytes"));
+
+  int code = 200;
+  uint32_t from = 0;
+  uint32_t to = asset.len - 1;
+  // other units and multiple ranges get the whole asset, so does a range
+  // of another version of it
+  String range = serverWeb.header("Range");
+  String ifRange = serverWeb.header("If-Range");
+  if (range.startsWith("bytes=") && range.indexOf(',') < 0 && (ifRange.length() == 0 || ifRange == etag))
+  {
+    if (!assetRange(range, asset.len, from, to))
+    {
+      serverWeb.sendHeader(F("Content-Range"), String("bytes */") + asset.len);
+      serverWeb.send(416);
+      return;
+    }
+    code = 206;
+    serverWeb.sendHeader(F("Content-Range"), String("bytes ") + from + "-" + to + "/" + asset.len);
+  }
+
+  serverWeb.setContentLength(to - from + 1);
+  serverWeb.send(code, asset.type, "");
+  if (serverWeb.method() != HTTP_HEAD)
+  {
+    serverWeb.sendContent_P((PGM_P)asset.data + from, to - from + 1);
+  }
 }
 
+// looked up ahead of the page routes
+class AssetHandler : public RequestHandler
+{
+public:
+  bool canHandle(HTTPMethod method, String uri) override
+  {
+    found = NULL;
+    if (method == HTTP_GET || method == HTTP_HEAD)
+      found = assetFind(uri.c_str());
+    return found != NULL;
+  }
+
+  bool handle(WebServer &server, HTTPMethod method, String uri) override
+  {
+    if (!found)
+      return false;
+    sendAsset(*found);
+    return true;
+  }
+
+private:
+  const WebAsset *found = NULL;
+};
+AssetHandler assetHandler;
+
 void initWebServer()
 {
-  serverWeb.on("/js/bootstrap.min.js", handle_bootstrap_js);
-  serverWeb.on("/js/functions.js", handle_functions_js);
-  serverWeb.on("/js/jquery-min.js", handle_jquery_js);
-  serverWeb.on("/css/required.css", handle_required_css);
-  serverWeb.on("/js/toast.js", handle_toast_js);
-  serverWeb.on("/fonts/glyphicons.woff", handle_glyphicons_woff);
-  serverWeb.on("/img/logo.png", handle_logo_png);
-  serverWeb.on("/img/wait.gif", handle_wait_gif);
-  serverWeb.on("/img/nok.png", handle_nok_png);
-  serverWeb.on("/img/ok.png", handle_ok_png);
+  serverWeb.addHandler(&assetHandler);
   serverWeb.on("/", handleRoot);
   serverWeb.on("/general", handleGeneral);
   serverWeb.on("/wifi", handleWifi);
@@ -68,6 +218,10 @@ void initWebServer()
   serverWeb.on("/readFile", handleReadfile);
   serverWeb.on("/saveFile", handleSavefile);
   serverWeb.on("/getLogBuffer", handleLogBuffer);
+  serverWeb.on("/events", handleEvents);
+  serverWeb.on("/capture.pcap", handleCapture);
+  serverWeb.on("/metrics", handleMetrics);
+  serverWeb.on("/lastlog", handleLastLog);
   serverWeb.on("/scanNetwork", handleScanNetwork);
   serverWeb.on("/cmdClearConsole", handleClearConsole);
   //serverWeb.on("/cmdGetVersion", handleGetVersion);
@@ -126,166 +280,103 @@ void initWebServer()
           }
         }
       });
+  const char *headers[] = {"Last-Event-ID", "If-None-Match", "Range", "If-Range"};
+  serverWeb.collectHeaders(headers, 4);
   serverWeb.begin();
+  xTaskCreatePinnedToCore(webTask, "web", WEB_TASK_STACK, NULL, WEB_TASK_PRIORITY, NULL, WEB_TASK_CORE);
 }
 
-void handle_functions_js()
-{
-  const char *dataType = "text/javascript";
-  serverWeb.sendHeader(F("Content-Encoding"), F("gzip"));
-  serverWeb.send_P(200, dataType, (const char *)functions_js_gz, functions_js_gz_len);
-}
-
-void handle_bootstrap_js()
-{
-  const char *dataType = "text/javascript";
-  serverWeb.sendHeader(F("Content-Encoding"), F("gzip"));
-  serverWeb.send_P(200, dataType, (const char *)bootstrap_min_js_gz, bootstrap_min_js_gz_len);
-}
-
-void handle_jquery_js()
-{
-  const char *dataType = "text/javascript";
-  serverWeb.sendHeader(F("Content-Encoding"), F("gzip"));
-  serverWeb.send_P(200, dataType, (const char *)jquery_min_js_gz, jquery_min_js_gz_len);
-}
-
-void handle_required_css()
-{
-  const char *dataType = "text/css";
-  serverWeb.sendHeader(F("Content-Encoding"), F("gzip"));
-  serverWeb.send_P(200, dataType, (const char *)required_css_gz, required_css_gz_len);
-}
-
-void handle_toast_js()
+// The common frame: header with the title and, when logins are on, the
+// logout link, then body with its fields filled by fill.
+template <typename Field, typename Fill>
+void writePage(PageWriter &page, const char *title, const PageTemplate<Field> &body, Fill fill, bool logoutLink)
 {
-  const char *dataType = "text/javascript";
-  serverWeb.sendHeader(F("Content-Encoding"), F("gzip"));
-  serverWeb.send_P(200, dataType, (const char *)toast_js_gz, toast_js_gz_len);
-}
-
-void handle_glyphicons_woff()
-{
-  const char *dataType = "font/woff";
-  serverWeb.sendHeader(F("Content-Encoding"), F("gzip"));
-  serverWeb.send_P(200, dataType, (const char *)glyphicons_woff_gz, glyphicons_woff_gz_len);
+  page.print("<html>");
+  page.render(HTML_HEADER, [&](PageWriter &page, HeaderField field)
+              {
+                switch (field)
+                {
+                case HeaderField::jqueryHash:
+                  page.print(jquery_min_js_gz_hash);
+                  break;
+                case HeaderField::bootstrapHash:
+                  page.print(bootstrap_min_js_gz_hash);
+                  break;
+                case HeaderField::functionsHash:
+                  page.print(functions_js_gz_hash);
+                  break;
+                case HeaderField::toastHash:
+                  page.print(toast_js_gz_hash);
+                  break;
+                case HeaderField::cssHash:
+                  page.print(required_css_gz_hash);
+                  break;
+                case HeaderField::logoHash:
+                  page.print(logo_png_gz_hash);
+                  break;
+                case HeaderField::pageName:
+                  page.print(title);
+                  break;
+                case HeaderField::logoutLink:
+                  if (logoutLink)
+                    page.render(HTML_LOGOUT);
+                  break;
+                }
+              });
+  page.render(body, fill);
+  page.print("</body></html>");
 }
 
-void handle_logo_png()
+template <typename Field, typename Fill>
+void sendPage(const char *title, const PageTemplate<Field> &body, Fill fill, int code = 200, bool logoutLink = ConfigSettings.webAuth)
 {
-  const char *dataType = "img/png";
-  serverWeb.sendHeader(F("Content-Encoding"), F("gzip"));
-  serverWeb.send_P(200, dataType, (const char *)logo_png_gz, logo_png_gz_len);
+  PageWriter page(serverWeb);
+  page.begin(code);
+  writePage(page, title, body, fill, logoutLink);
+  page.end();
 }
 
-void handle_wait_gif()
+void sendPage(const char *title, const PageTemplate<PageNoField> &body, int code = 200, bool logoutLink = ConfigSettings.webAuth)
 {
-  const char *dataType = "img/gif";
-  serverWeb.sendHeader(F("Content-Encoding"), F("gzip"));
-  serverWeb.send_P(200, dataType, (const char *)wait_gif_gz, wait_gif_gz_len);
-}
-
-void handle_nok_png()
-{
-  const char *dataType = "img/png";
-  serverWeb.sendHeader(F("Content-Encoding"), F("gzip"));
-  serverWeb.send_P(200, dataType, (const char *)nok_png_gz, nok_png_gz_len);
-}
-
-void handle_ok_png()
-{
-  const char *dataType = "img/png";
-  serverWeb.sendHeader(F("Content-Encoding"), F("gzip"));
-  serverWeb.send_P(200, dataType, (const char *)ok_png_gz, ok_png_gz_len);
+  sendPage(title, body, [](PageWriter &, PageNoField) {}, code, logoutLink);
 }
 
 void handleLoggedOut()
 {
-  String result;
-  result += F("<html>");
-  result += FPSTR(HTTP_HEADER);
-  result.replace("{{logoutLink}}", "");
-  result += FPSTR(HTTP_ERROR);
-  result += F("</html>");
-  result.replace("{{pageName}}", "Logged out");
-
-  serverWeb.send(200, F("text/html"), result);
+  sendPage("Logged out", HTML_ERROR, 200, false);
 }
 
 void handleNotFound()
 {
   if (checkAuth())
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += FPSTR(HTTP_ERROR);
-    result += F("</html>");
-    result.replace("{{pageName}}", "Not found - 404");
-
-    serverWeb.send(404, F("text/html"), result);
+    sendPage("Not found - 404", HTML_ERROR, 404);
   }
 }
 
 bool checkAuth()
 {
-  String result;
-  result += F("<html>");
-  result += FPSTR(HTTP_HEADER);
-  result.replace("{{logoutLink}}", "");
-
-  result += FPSTR(HTTP_ERROR);
-  result += F("</html>");
-  result.replace("{{pageName}}", "Authentication failed");
-
-  const char *www_realm = "Login Required";
-
-  if (ConfigSettings.webAuth && !serverWeb.authenticate(ConfigSettings.webUser, ConfigSettings.webPass))
-  {
-    serverWeb.requestAuthentication(DIGEST_AUTH, www_realm, result);
-    return false;
-  }
-  else
+  if (!ConfigSettings.webAuth || serverWeb.authenticate(ConfigSettings.webUser, ConfigSettings.webPass))
   {
     return true;
   }
+
+  // requestAuthentication() wants the whole page, rarely needed
+  String result;
+  PageWriter page(result);
+  writePage(page, "Authentication failed", HTML_ERROR, [](PageWriter &, PageNoField) {}, false);
+  page.end();
+
+  const char *www_realm = "Login Required";
+  serverWeb.requestAuthentication(DIGEST_AUTH, www_realm, result);
+  return false;
 }
 
 void handleHelp()
 {
   if (checkAuth())
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += FPSTR(HTTP_HELP);
-    result += F("</html>");
-    result.replace("{{pageName}}", "Help");
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    serverWeb.send(200, "text/html", result);
+    sendPage("Help", HTML_HELP);
   }
 }
 
@@ -293,46 +384,36 @@ void handleGeneral()
 {
   if (checkAuth())
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += FPSTR(HTTP_GENERAL);
-    result += F("</html>");
-
-    result.replace("{{pageName}}", "General");
-
-    if (ConfigSettings.disableWeb)
-    {
-      result.replace("{{disableWeb}}", "checked");
-    }
-    else
-    {
-      result.replace("{{disableWeb}}", "");
-    }
-
-    result.replace("{{refreshLogs}}", (String)ConfigSettings.refreshLogs);
-    result.replace("{{hostname}}", (String)ConfigSettings.hostname);
-
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{webAuth}}", "checked");
-    }
-    else
-    {
-      result.replace("{{webAuth}}", "");
-    }
-    result.replace("{{webUser}}", (String)ConfigSettings.webUser);
-    result.replace("{{webPass}}", (String)ConfigSettings.webPass);
-
-    serverWeb.send(200, "text/html", result);
+    sendPage("General", HTML_GENERAL, [](PageWriter &page, GeneralField field)
+             {
+               switch (field)
+               {
+               case GeneralField::hostname:
+                 page.print(ConfigSettings.hostname);
+                 break;
+               case GeneralField::refreshLogs:
+                 page.print(ConfigSettings.refreshLogs);
+                 break;
+               case GeneralField::webAuth:
+                 page.flag(ConfigSettings.webAuth);
+                 break;
+               case GeneralField::webUser:
+                 page.print(ConfigSettings.webUser);
+                 break;
+               case GeneralField::webPass:
+                 page.print(ConfigSettings.webPass);
+                 break;
+               case GeneralField::syslogEnable:
+                 page.flag(ConfigSettings.syslogEnable);
+                 break;
+               case GeneralField::syslogServer:
+                 page.print(ConfigSettings.syslogServer);
+                 break;
+               case GeneralField::syslogPort:
+                 page.print(ConfigSettings.syslogPort);
+                 break;
+               }
+             });
   }
 }
 
@@ -340,30 +421,15 @@ void handleSaveSucces(String msg)
 {
   if (checkAuth())
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += F("<h2>{{pageName}}</h2>");
-    result += F("<div id='main' class='col-sm-12'>");
-    result += F("<div id='main' class='col-sm-6'>");
-    result += F("<form method='GET' action='reboot' id='upload_form'>");
-    result += F("<label>Save ");
-    result += msg;
-    result += F(" OK !</label><br><br><br>");
-    result += F("<button type='submit' class='btn btn-warning mb-2'>Reboot</button>");
-    result += F("</form></div></div>");
-    result += F("</html>");
-    result.replace("{{pageName}}", "Saved");
-
-    serverWeb.send(200, "text/html", result);
+    sendPage("Saved", HTML_SAVED, [&](PageWriter &page, SavedField field)
+             {
+               switch (field)
+               {
+               case SavedField::msg:
+                 page.print(msg);
+                 break;
+               }
+             });
   }
 }
 
@@ -371,56 +437,53 @@ void handleWifi()
 {
   if (checkAuth())
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += FPSTR(HTTP_WIFI);
-    result += F("</html>");
-
-    result.replace("{{pageName}}", "Config WiFi");
-
-    DEBUG_PRINTLN(ConfigSettings.enableWiFi);
-    if (ConfigSettings.enableWiFi)
-    {
-
-      result.replace("{{checkedWiFi}}", "Checked");
-    }
-    else
-    {
-      result.replace("{{checkedWiFi}}", "");
-    }
-    DEBUG_PRINTLN(ConfigSettings.disableEmerg);
-    if (ConfigSettings.disableEmerg)
-    {
-      result.replace("{{checkedDisEmerg}}", "Checked");
-    }
-    else
-    {
-      result.replace("{{checkedDisEmerg}}", "");
-    }
-    result.replace("{{ssid}}", String(ConfigSettings.ssid));
-    result.replace("{{passWifi}}", String(ConfigSettings.password));
-    if (ConfigSettings.dhcpWiFi)
-    {
-      result.replace("{{dchp}}", "Checked");
-    }
-    else
-    {
-      result.replace("{{dchp}}", "");
-    }
-    result.replace("{{ip}}", ConfigSettings.ipAddressWiFi);
-    result.replace("{{mask}}", ConfigSettings.ipMaskWiFi);
-    result.replace("{{gw}}", ConfigSettings.ipGWWiFi);
+    sendPage("Config WiFi", HTML_WIFI, [](PageWriter &page, WifiField field)
+             {
+               switch (field)
+               {
+               case WifiField::checkedWiFi:
+                 page.flag(ConfigSettings.enableWiFi);
+                 break;
+               case WifiField::ssid:
+                 page.print(ConfigSettings.ssid);
+                 break;
+               case WifiField::passWifi:
+                 page.print(ConfigSettings.password);
+                 break;
+               case WifiField::dchp:
+                 page.flag(ConfigSettings.dhcpWiFi);
+                 break;
+               case WifiField::ip:
+                 page.print(ConfigSettings.ipAddressWiFi);
+                 break;
+               case WifiField::mask:
+                 page.print(ConfigSettings.ipMaskWiFi);
+                 break;
+               case WifiField::gw:
+                 page.print(ConfigSettings.ipGWWiFi);
+                 break;
+               case WifiField::checkedDisEmerg:
+                 page.flag(ConfigSettings.disableEmerg);
+                 break;
+               }
+             });
+  }
+}
 
-    serverWeb.send(200, "text/html", result);
+// an unknown speed shows as 115200
+bool serialSpeedSelected(int speed)
+{
+  switch (ConfigSettings.serialSpeed)
+  {
+  case 9600:
+  case 19200:
+  case 38400:
+  case 57600:
+  case 230400:
+  case 460800:
+    return ConfigSettings.serialSpeed == speed;
+  default:
+    return speed == 115200;
   }
 }
 
@@ -428,49 +491,87 @@ void handleSerial()
 {
   if (checkAuth())
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += FPSTR(HTTP_SERIAL);
-    result += F("</html>");
-
-    result.replace("{{pageName}}", "Config Serial");
-
-    if (ConfigSettings.serialSpeed == 9600)
-    {
-      result.replace("{{selected9600}}", "Selected");
-    }
-    else if (ConfigSettings.serialSpeed == 19200)
-    {
-      result.replace("{{selected19200}}", "Selected");
-    }
-    else if (ConfigSettings.serialSpeed == 38400)
-    {
-      result.replace("{{selected38400}}", "Selected");
-    }
-    else if (ConfigSettings.serialSpeed == 57600)
-    {
-      result.replace("{{selected57600}}", "Selected");
-    }
-    else if (ConfigSettings.serialSpeed == 115200)
-    {
-      result.replace("{{selected115200}}", "Selected");
-    }
-    else
-    {
-      result.replace("{{selected115200}}", "Selected");
-    }
-    result.replace("{{socketPort}}", String(ConfigSettings.socketPort));
-
-    serverWeb.send(200, "text/html", result);
+    sendPage("Config Serial", HTML_SERIAL, [](PageWriter &page, SerialField field)
+             {
+               switch (field)
+               {
+               case SerialField::selected9600:
+                 page.flag(serialSpeedSelected(9600), "Selected");
+                 break;
+               case SerialField::selected19200:
+                 page.flag(serialSpeedSelected(19200), "Selected");
+                 break;
+               case SerialField::selected38400:
+                 page.flag(serialSpeedSelected(38400), "Selected");
+                 break;
+               case SerialField::selected57600:
+                 page.flag(serialSpeedSelected(57600), "Selected");
+                 break;
+               case SerialField::selected115200:
+                 page.flag(serialSpeedSelected(115200), "Selected");
+                 break;
+               case SerialField::selected230400:
+                 page.flag(serialSpeedSelected(230400), "Selected");
+                 break;
+               case SerialField::selected460800:
+                 page.flag(serialSpeedSelected(460800), "Selected");
+                 break;
+               case SerialField::flowControl:
+                 page.flag(ConfigSettings.flowControl);
+                 break;
+               case SerialField::rtsPin:
+                 page.print(ConfigSettings.rtsPin);
+                 break;
+               case SerialField::ctsPin:
+                 page.print(ConfigSettings.ctsPin);
+                 break;
+               case SerialField::uartRxBuffer:
+                 page.print(ConfigSettings.uartRxBuffer);
+                 break;
+               case SerialField::uartRxFifoFull:
+                 page.print(ConfigSettings.uartRxFifoFull);
+                 break;
+               case SerialField::uartRxTimeout:
+                 page.print(ConfigSettings.uartRxTimeout);
+                 break;
+               case SerialField::socketPort:
+                 page.print(ConfigSettings.socketPort);
+                 break;
+               case SerialField::serialRing:
+                 page.print(ConfigSettings.serialRingSize);
+                 break;
+               case SerialField::netRing:
+                 page.print(ConfigSettings.netRingSize);
+                 break;
+               case SerialField::znpFramer:
+                 page.flag(ConfigSettings.znpFramer);
+                 break;
+               case SerialField::framerTimeout:
+                 page.print(ConfigSettings.framerTimeout);
+                 break;
+               case SerialField::srspRouting:
+                 page.flag(ConfigSettings.srspRouting);
+                 break;
+               case SerialField::clientLag:
+                 page.print(ConfigSettings.clientLag);
+                 break;
+               case SerialField::slowClientDrop:
+                 page.flag(ConfigSettings.slowClientDrop);
+                 break;
+               case SerialField::writerBudget:
+                 page.print(ConfigSettings.writerBudget);
+                 break;
+               case SerialField::clientRoles:
+                 page.flag(ConfigSettings.clientRoles);
+                 break;
+               case SerialField::primaryIp:
+                 page.print(ConfigSettings.primaryIp);
+                 break;
+               case SerialField::observerRefuse:
+                 page.flag(ConfigSettings.observerRefuse);
+                 break;
+               }
+             });
   }
 }
 
@@ -478,44 +579,27 @@ void handleEther()
 {
   if (checkAuth())
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += FPSTR(HTTP_ETHERNET);
-    result += F("</html>");
-
-    result.replace("{{pageName}}", "Config Ethernet");
-
-    if (ConfigSettings.dhcp)
-    {
-      result.replace("{{modeEther}}", "Checked");
-    }
-    else
-    {
-      result.replace("{{modeEther}}", "");
-    }
-    result.replace("{{ipEther}}", ConfigSettings.ipAddress);
-    result.replace("{{maskEther}}", ConfigSettings.ipMask);
-    result.replace("{{GWEther}}", ConfigSettings.ipGW);
-
-    if (ConfigSettings.disablePingCtrl)
-    {
-      result.replace("{{disablePingCtrl}}", "Checked");
-    }
-    else
-    {
-      result.replace("{{disablePingCtrl}}", "");
-    }
-
-    serverWeb.send(200, "text/html", result);
+    sendPage("Config Ethernet", HTML_ETHERNET, [](PageWriter &page, EthernetField field)
+             {
+               switch (field)
+               {
+               case EthernetField::modeEther:
+                 page.flag(ConfigSettings.dhcp);
+                 break;
+               case EthernetField::ipEther:
+                 page.print(ConfigSettings.ipAddress);
+                 break;
+               case EthernetField::maskEther:
+                 page.print(ConfigSettings.ipMask);
+                 break;
+               case EthernetField::GWEther:
+                 page.print(ConfigSettings.ipGW);
+                 break;
+               case EthernetField::disablePingCtrl:
+                 page.flag(ConfigSettings.disablePingCtrl);
+                 break;
+               }
+             });
   }
 }
 
@@ -523,265 +607,277 @@ void handleMqtt()
 {
   if (checkAuth())
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += FPSTR(HTTP_MQTT);
-    result += F("</html>");
-
-    result.replace("{{pageName}}", "Config MQTT");
+    sendPage("Config MQTT", HTML_MQTT, [](PageWriter &page, MqttField field)
+             {
+               switch (field)
+               {
+               case MqttField::mqttEnable:
+                 page.flag(ConfigSettings.mqttEnable);
+                 break;
+               case MqttField::mqttServer:
+                 page.print(ConfigSettings.mqttServer);
+                 break;
+               case MqttField::mqttPort:
+                 page.print(ConfigSettings.mqttPort);
+                 break;
+               case MqttField::mqttUser:
+                 page.print(ConfigSettings.mqttUser);
+                 break;
+               case MqttField::mqttPass:
+                 page.print(ConfigSettings.mqttPass);
+                 break;
+               case MqttField::mqttTopic:
+                 page.print(ConfigSettings.mqttTopic);
+                 break;
+               case MqttField::mqttInterval:
+                 page.print(ConfigSettings.mqttInterval);
+                 break;
+               case MqttField::mqttDiscovery:
+                 page.flag(ConfigSettings.mqttDiscovery);
+                 break;
+               case MqttField::mqttMetrics:
+                 page.flag(ConfigSettings.mqttMetrics);
+                 break;
+               }
+             });
+  }
+}
 
-    if (ConfigSettings.mqttEnable)
-    {
-      result.replace("{{mqttEnable}}", "Checked");
-    }
-    else
-    {
-      result.replace("{{mqttEnable}}", "");
-    }
-    result.replace("{{mqttServer}}", String(ConfigSettings.mqttServer));
-    result.replace("{{mqttPort}}", String(ConfigSettings.mqttPort));
-    result.replace("{{mqttUser}}", String(ConfigSettings.mqttUser));
-    result.replace("{{mqttPass}}", String(ConfigSettings.mqttPass));
-    result.replace("{{mqttTopic}}", String(ConfigSettings.mqttTopic));
-    /*
-  if (ConfigSettings.mqttRetain)
+void printSocketState(PageWriter &page)
+{
+  String readableTime;
+  getReadableTime(readableTime, ConfigSettings.socketTime);
+  if (ConfigSettings.connectedClients > 0)
   {
-    result.replace("{{mqttRetain}}", "Checked");
+    page.print("<img src='/img/ok.png'> ");
+    page.print(readableTime);
+    page.printf(" (%d %s)", ConfigSettings.connectedClients, ConfigSettings.connectedClients > 1 ? "clients" : "client");
   }
   else
   {
-    result.replace("{{mqttRetain}}", "");
+    page.print("<img src='/img/nok.png'> ");
+    page.print(readableTime);
   }
-  */
-    result.replace("{{mqttInterval}}", String(ConfigSettings.mqttInterval));
-    if (ConfigSettings.mqttDiscovery)
-    {
-      result.replace("{{mqttDiscovery}}", "Checked");
-    }
-    else
-    {
-      result.replace("{{mqttDiscovery}}", "");
-    }
-
-    serverWeb.send(200, "text/html", result);
-  }
-}
 
-void handleRoot()
-{
-  if (checkAuth())
+  for (int cln = 0; cln < MAX_SOCKET_CLIENTS; cln++)
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += FPSTR(HTTP_ROOT);
-    result += F("</html>");
-
-    result.replace("{{pageName}}", "Status");
-
-    String socketStatus;
-    String readableTime;
-    getReadableTime(readableTime, ConfigSettings.socketTime);
-    if (ConfigSettings.connectedClients > 0)
-    {
-      socketStatus = "<img src='/img/ok.png'>";
-      socketStatus = socketStatus + " " + readableTime + " (" + ConfigSettings.connectedClients;
-      if (ConfigSettings.connectedClients > 1)
-      {
-        socketStatus = socketStatus + " clients)";
-      }
-      else
-      {
-        socketStatus = socketStatus + " client)";
-      }
-    }
-    else
-    {
-      socketStatus = "<img src='/img/nok.png'>";
-      socketStatus = socketStatus + " " + readableTime;
-    }
-
-    result.replace("{{connectedSocket}}", socketStatus);
-
-    getReadableTime(readableTime, 0);
-    result.replace("{{uptime}}", readableTime);
-
-    float CPUtemp = getCPUtemp();
-    result.replace("{{deviceTemp}}", String(CPUtemp));
-
-    
-    if (ConfigSettings.board == 2) {
-      String OWWstrg;
-      float temp_ow = oneWireRead();
-
-      if (temp_ow)
-      {
-        OWWstrg = "<br><strong>OW temperature : </strong>" + String(temp_ow) + " &deg;C";
-        result.replace("{{dsTemp}}", OWWstrg);
-      }
-      else
-      {
-        result.replace("{{dsTemp}}", "");
-      }
-    }
-    else
-    {
-      result.replace("{{dsTemp}}", "");
-    }
-
-    result.replace("{{hwRev}}", ConfigSettings.boardName);
-
-    result.replace("{{espModel}}", String(ESP.getChipModel()));
-    result.replace("{{espCores}}", String(ESP.getChipCores()));
-    result.replace("{{espFreq}}", String(ESP.getCpuFreqMHz()));
-
-    result.replace("{{espHeapFree}}", String(ESP.getFreeHeap() / 1024));
-    result.replace("{{espHeapSize}}", String(ESP.getHeapSize() / 1024));
-
-    esp_chip_info_t chip_info;
-    esp_chip_info(&chip_info);
-
-    if (chip_info.features & CHIP_FEATURE_EMB_FLASH)
-    {
-      result.replace("{{espFlashType}}", "embedded");
-    }
-    else
+    BridgeClientInfo info;
+    if (bridgeClientInfo(cln, info) && info.connected)
     {
-      result.replace("{{espFlashType}}", "external");
-    }
-
-    result.replace("{{espFlashSize}}", String(ESP.getFlashChipSize() / (1024 * 1024)));
-
-    String ethState = "<strong>Connected : </strong>";
-    if (ConfigSettings.connectedEther)
-    {
-      int speed = ETH.linkSpeed();
-      String SpeedEth = String(speed) + String(" Mbps");
-      if (ETH.fullDuplex())
+      page.printf("<br>&nbsp;#%d %s ", cln, info.ip);
+      if (info.role == ROLE_PRIMARY)
       {
-        SpeedEth += String(", FULL DUPLEX");
+        page.print("<span class='badge badge-success'>primary</span>");
       }
       else
       {
-        SpeedEth += String(", HALF DUPLEX");
+        page.print("<span class='badge badge-secondary'>observer</span>");
       }
-      ethState += "<img src='/img/ok.png'>";
-      ethState += "<br><strong>MAC : </strong>" + ETH.macAddress();
-      ethState += "<br><strong>Speed : </strong> " + SpeedEth;
-      ethState += "<br><strong>Mode : </strong>";
-      if (ConfigSettings.dhcp)
+      page.printf(" rx %u B, tx %u B", (unsigned)info.rxBytes, (unsigned)info.txBytes);
+      if (info.droppedBytes)
       {
-        ethState += "DHCP<br><strong>IP : </strong>" + ETH.localIP().toString();
-        ethState += "<br><strong>Mask : </strong>" + ETH.subnetMask().toString();
-        ethState += "<br><strong>GW : </strong>" + ETH.gatewayIP().toString();
+        page.printf(", dropped %u B", (unsigned)info.droppedBytes);
       }
-      else
+      if (info.filteredBytes)
       {
-        ethState = ethState + "STATIC<br><strong>IP : </strong>" + ConfigSettings.ipAddress;
-        ethState = ethState + "<br><strong>Mask : </strong>" + ConfigSettings.ipMask;
-        ethState = ethState + "<br><strong>GW : </strong>" + ConfigSettings.ipGW;
+        page.printf(", filtered %u B", (unsigned)info.filteredBytes);
       }
     }
-    else
-    {
-      ethState += "<img src='/img/nok.png'>";
-    }
-    result.replace("{{stateEther}}", ethState);
+  }
+  if (ConfigSettings.clientRoles)
+  {
+    BridgeRoleStats primaryStats;
+    BridgeRoleStats observerStats;
+    bridgeRoleStats(ROLE_PRIMARY, primaryStats);
+    bridgeRoleStats(ROLE_OBSERVER, observerStats);
+    page.printf("<br><strong>Primary : </strong>rx %u B, tx %u B", (unsigned)primaryStats.rxBytes, (unsigned)primaryStats.txBytes);
+    page.printf("<br><strong>Observers : </strong>tx %u B, dropped %u B, refused %u", (unsigned)observerStats.txBytes, (unsigned)observerStats.droppedBytes, (unsigned)observerStats.refused);
+  }
+}
 
-    String wifiState = "<strong>Enabled : </strong>";
-    if (ConfigSettings.enableWiFi || ConfigSettings.emergencyWifi)
-    {
-      wifiState += "<img src='/img/ok.png'>";
-      if (ConfigSettings.emergencyWifi)
-      {
-        wifiState += "<strong> Emergency mode</strong>";
-      }
-      wifiState += "<br><strong>MAC : </strong>" + WiFi.softAPmacAddress();
-      wifiState += "<br><strong>Mode : </strong> ";
-      if (ConfigSettings.wifiModeAP)
-      {
-        String AP_NameString;
-        getDeviceID(AP_NameString);
-        wifiState += "AP <br><strong>SSID : </strong>" + AP_NameString;
-        wifiState += "<br>No password";
-        //wifiState += "<br><strong>Password : </strong>ZigStar1";
-        wifiState += "<br><strong>IP : </strong>192.168.4.1";
-      }
-      else
-      {
-        int rssi = WiFi.RSSI();
-        String rssiWifi = String(rssi) + String(" dBm");
-        wifiState = wifiState + "STA <br><strong>SSID : </strong>" + ConfigSettings.ssid;
-        wifiState += "<br><strong>Connected : </strong>";
-        if (rssi != 0)
-        {
-          wifiState += "<img src='/img/ok.png'>";
-          wifiState += "<br><strong>RSSI : </strong>" + rssiWifi;
-          wifiState += "<br><strong>Mode : </strong>";
-          if (ConfigSettings.dhcpWiFi)
-          {
-            wifiState += "DHCP<br><strong>IP : </strong>" + WiFi.localIP().toString();
-            wifiState += "<br><strong>Mask : </strong>" + WiFi.subnetMask().toString();
-            wifiState += "<br><strong>GW : </strong>" + WiFi.gatewayIP().toString();
-          }
-          else
-          {
-            wifiState = wifiState + "STATIC<br><strong>IP : </strong>" + ConfigSettings.ipAddressWiFi;
-            wifiState = wifiState + "<br><strong>Mask : </strong>" + ConfigSettings.ipMaskWiFi;
-            wifiState = wifiState + "<br><strong>GW : </strong>" + ConfigSettings.ipGWWiFi;
-          }
-        }
-        else
-        {
-          wifiState += "<img src='/img/nok.png'>";
-        }
-      }
-    }
-    else
-    {
-      wifiState += "<img src='/img/nok.png'>";
-    }
-    result.replace("{{stateWifi}}", wifiState);
+void printEtherState(PageWriter &page)
+{
+  page.print("<strong>Connected : </strong>");
+  if (!ConfigSettings.connectedEther)
+  {
+    page.print("<img src='/img/nok.png'>");
+    return;
+  }
+  page.print("<img src='/img/ok.png'>");
+  page.print("<br><strong>MAC : </strong>");
+  page.print(ETH.macAddress());
+  page.printf("<br><strong>Speed : </strong> %d Mbps, %s", ETH.linkSpeed(), ETH.fullDuplex() ? "FULL DUPLEX" : "HALF DUPLEX");
+  page.print("<br><strong>Mode : </strong>");
+  if (ConfigSettings.dhcp)
+  {
+    page.print("DHCP<br><strong>IP : </strong>");
+    page.print(ETH.localIP().toString());
+    page.print("<br><strong>Mask : </strong>");
+    page.print(ETH.subnetMask().toString());
+    page.print("<br><strong>GW : </strong>");
+    page.print(ETH.gatewayIP().toString());
+  }
+  else
+  {
+    page.printf("STATIC<br><strong>IP : </strong>%s", ConfigSettings.ipAddress);
+    page.printf("<br><strong>Mask : </strong>%s", ConfigSettings.ipMask);
+    page.printf("<br><strong>GW : </strong>%s", ConfigSettings.ipGW);
+  }
+}
 
-    String mqttState = "<strong>Enabled : </strong>";
-    if (ConfigSettings.mqttEnable)
-    {
-      mqttState += "<img src='/img/ok.png'>";
-      mqttState = mqttState + "<br><strong>Server : </strong>" + ConfigSettings.mqttServer;
-      mqttState += "<br><strong>Connected : </strong>";
-      if (ConfigSettings.mqttReconnectTime == 0)
-      {
-        mqttState += "<img src='/img/ok.png'>";
-      }
-      else
-      {
-        mqttState += "<img src='/img/nok.png'>";
-      }
-    }
-    else
-    {
-      mqttState += "<img src='/img/nok.png'>";
-    }
-    result.replace("{{stateMqtt}}", mqttState);
+void printWifiState(PageWriter &page)
+{
+  page.print("<strong>Enabled : </strong>");
+  if (!ConfigSettings.enableWiFi && !ConfigSettings.emergencyWifi)
+  {
+    page.print("<img src='/img/nok.png'>");
+    return;
+  }
+  page.print("<img src='/img/ok.png'>");
+  if (ConfigSettings.emergencyWifi)
+  {
+    page.print("<strong> Emergency mode</strong>");
+  }
+  page.print("<br><strong>MAC : </strong>");
+  page.print(WiFi.softAPmacAddress());
+  page.print("<br><strong>Mode : </strong> ");
+  if (ConfigSettings.wifiModeAP)
+  {
+    String AP_NameString;
+    getDeviceID(AP_NameString);
+    page.print("AP <br><strong>SSID : </strong>");
+    page.print(AP_NameString);
+    page.print("<br>No password");
+    //page.print("<br><strong>Password : </strong>ZigStar1");
+    page.print("<br><strong>IP : </strong>192.168.4.1");
+    return;
+  }
+  int rssi = WiFi.RSSI();
+  page.printf("STA <br><strong>SSID : </strong>%s", ConfigSettings.ssid);
+  page.print("<br><strong>Connected : </strong>");
+  if (rssi == 0)
+  {
+    page.print("<img src='/img/nok.png'>");
+    return;
+  }
+  page.print("<img src='/img/ok.png'>");
+  page.printf("<br><strong>RSSI : </strong>%d dBm", rssi);
+  page.print("<br><strong>Mode : </strong>");
+  if (ConfigSettings.dhcpWiFi)
+  {
+    page.print("DHCP<br><strong>IP : </strong>");
+    page.print(WiFi.localIP().toString());
+    page.print("<br><strong>Mask : </strong>");
+    page.print(WiFi.subnetMask().toString());
+    page.print("<br><strong>GW : </strong>");
+    page.print(WiFi.gatewayIP().toString());
+  }
+  else
+  {
+    page.printf("STATIC<br><strong>IP : </strong>%s", ConfigSettings.ipAddressWiFi);
+    page.printf("<br><strong>Mask : </strong>%s", ConfigSettings.ipMaskWiFi);
+    page.printf("<br><strong>GW : </strong>%s", ConfigSettings.ipGWWiFi);
+  }
+}
+
+void printMqttState(PageWriter &page)
+{
+  page.print("<strong>Enabled : </strong>");
+  if (!ConfigSettings.mqttEnable)
+  {
+    page.print("<img src='/img/nok.png'>");
+    return;
+  }
+  page.print("<img src='/img/ok.png'>");
+  page.printf("<br><strong>Server : </strong>%s", ConfigSettings.mqttServer);
+  page.print("<br><strong>Connected : </strong>");
+  if (ConfigSettings.mqttReconnectTime == 0)
+  {
+    page.print("<img src='/img/ok.png'>");
+  }
+  else
+  {
+    page.print("<img src='/img/nok.png'>");
+  }
+}
 
-    serverWeb.send(200, "text/html", result);
+void handleRoot()
+{
+  if (checkAuth())
+  {
+    sendPage("Status", HTML_ROOT, [](PageWriter &page, RootField field)
+             {
+               switch (field)
+               {
+               case RootField::connectedSocket:
+                 printSocketState(page);
+                 break;
+               case RootField::uptime:
+               {
+                 String readableTime;
+                 getReadableTime(readableTime, 0);
+                 page.print(readableTime);
+                 break;
+               }
+               case RootField::deviceTemp:
+                 page.print(getCPUtemp());
+                 break;
+               case RootField::dsTemp:
+               {
+                 float temp_ow = ConfigSettings.board == 2 ? oneWireRead() : 0;
+                 if (temp_ow)
+                 {
+                   page.printf("<br><strong>OW temperature : </strong>%.2f &deg;C", temp_ow);
+                 }
+                 break;
+               }
+               case RootField::version:
+                 page.print(VERSION);
+                 break;
+               case RootField::debug:
+#ifdef DEBUG
+                 page.print(" DEBUG");
+#endif
+                 break;
+               case RootField::hwRev:
+                 page.print(ConfigSettings.boardName);
+                 break;
+               case RootField::espModel:
+                 page.print(ESP.getChipModel());
+                 break;
+               case RootField::espCores:
+                 page.print(ESP.getChipCores());
+                 break;
+               case RootField::espFreq:
+                 page.print(ESP.getCpuFreqMHz());
+                 break;
+               case RootField::espFlashSize:
+                 page.print(ESP.getFlashChipSize() / (1024 * 1024));
+                 break;
+               case RootField::espFlashType:
+               {
+                 esp_chip_info_t chip_info;
+                 esp_chip_info(&chip_info);
+                 page.print(chip_info.features & CHIP_FEATURE_EMB_FLASH ? "embedded" : "external");
+                 break;
+               }
+               case RootField::espHeapFree:
+                 page.print(ESP.getFreeHeap() / 1024);
+                 break;
+               case RootField::espHeapSize:
+                 page.print(ESP.getHeapSize() / 1024);
+                 break;
+               case RootField::stateEther:
+                 printEtherState(page);
+                 break;
+               case RootField::stateWifi:
+                 printWifiState(page);
+                 break;
+               case RootField::stateMqtt:
+                 printMqttState(page);
+                 break;
+               }
+             });
   }
 }
 
@@ -790,22 +886,12 @@ void handleSaveGeneral()
   if (checkAuth())
   {
     String StringConfig;
-    String disableWeb;
     String refreshLogs;
     String hostname;
     String webAuth;
     String webUser;
     String webPass;
 
-    if (serverWeb.arg("disableWeb") == "on")
-    {
-      disableWeb = "1";
-    }
-    else
-    {
-      disableWeb = "0";
-    }
-
     if (serverWeb.arg("refreshLogs").toDouble() < 1000)
     {
       refreshLogs = "1000";
@@ -851,22 +937,38 @@ void handleSaveGeneral()
       webPass = "admin";
     }
 
+    String syslogEnable;
+    if (serverWeb.arg("syslogEnable") == "on")
+    {
+      syslogEnable = "1";
+    }
+    else
+    {
+      syslogEnable = "0";
+    }
+    String syslogPort = String(SYSLOG_PORT);
+    if (serverWeb.arg("syslogPort").toInt() > 0)
+    {
+      syslogPort = String(serverWeb.arg("syslogPort").toInt());
+    }
+
     //DEBUG_PRINTLN(hostname);
     const char *path = "/config/configGeneral.json";
 
-    StringConfig = "{\"disableWeb\":" + disableWeb + ",\"refreshLogs\":" + refreshLogs + ",\"webAuth\":" + webAuth + ",\"webUser\":\"" + webUser + "\",\"webPass\":\"" + webPass + "\",\"hostname\":\"" + hostname + "\"}";
-    DEBUG_PRINTLN(StringConfig);
+    StringConfig = "{\"refreshLogs\":" + refreshLogs + ",\"webAuth\":" + webAuth + ",\"webUser\":\"" + webUser + "\",\"webPass\":\"" + webPass + "\",\"hostname\":\"" + hostname + "\",\"syslogEnable\":" + syslogEnable + ",\"syslogServer\":\"" + serverWeb.arg("syslogServer") + "\",\"syslogPort\":" + syslogPort + "}";
     DynamicJsonDocument doc(1024);
     deserializeJson(doc, StringConfig);
 
     File configFile = LittleFS.open(path, FILE_WRITE);
     if (!configFile)
     {
-      DEBUG_PRINTLN(F("failed open"));
+      LOGE(WEB, "%s failed open", path);
     }
     else
     {
-      serializeJson(doc, configFile);
+      // the values may hold passwords, only the size goes to the log
+      size_t size = serializeJson(doc, configFile);
+      LOGD(WEB, "%s saved, %u bytes", path, (unsigned)size);
     }
     handleSaveSucces("config");
   }
@@ -921,18 +1023,18 @@ void handleSaveWifi()
     const char *path = "/config/configWifi.json";
 
     StringConfig = "{\"enableWiFi\":" + enableWiFi + ",\"ssid\":\"" + ssid + "\",\"pass\":\"" + pass + "\",\"dhcpWiFi\":" + dhcpWiFi + ",\"ip\":\"" + ipAddress + "\",\"mask\":\"" + ipMask + "\",\"gw\":\"" + ipGW + "\",\"disableEmerg\":\"" + disableEmerg + "\"}";
-    DEBUG_PRINTLN(StringConfig);
     DynamicJsonDocument doc(1024);
     deserializeJson(doc, StringConfig);
 
     File configFile = LittleFS.open(path, FILE_WRITE);
     if (!configFile)
     {
-      DEBUG_PRINTLN(F("failed open"));
+      LOGE(WEB, "%s failed open", path);
     }
     else
     {
-      serializeJson(doc, configFile);
+      size_t size = serializeJson(doc, configFile);
+      LOGD(WEB, "%s saved, %u bytes", path, (unsigned)size);
     }
     handleSaveSucces("config");
   }
@@ -945,21 +1047,132 @@ void handleSaveSerial()
     String StringConfig;
     String serialSpeed = serverWeb.arg("baud");
     String socketPort = serverWeb.arg("port");
+    String serialRing = serverWeb.arg("serialRing");
+    String netRing = serverWeb.arg("netRing");
+    if (serialRing == "")
+    {
+      serialRing = String(SERIAL_RING_SIZE);
+    }
+    if (netRing == "")
+    {
+      netRing = String(NET_RING_SIZE);
+    }
+    String znpFramer;
+    if (serverWeb.arg("znpFramer") == "on")
+    {
+      znpFramer = "1";
+    }
+    else
+    {
+      znpFramer = "0";
+    }
+    String framerTimeout = serverWeb.arg("framerTimeout");
+    if (framerTimeout == "")
+    {
+      framerTimeout = String(FRAMER_TIMEOUT_MS);
+    }
+    String clientLag = serverWeb.arg("clientLag");
+    if (clientLag == "")
+    {
+      clientLag = String(CLIENT_LAG);
+    }
+    String writerBudget = serverWeb.arg("writerBudget");
+    if (writerBudget == "")
+    {
+      writerBudget = String(WRITER_BUDGET);
+    }
+    String clientRoles;
+    if (serverWeb.arg("clientRoles") == "on")
+    {
+      clientRoles = "1";
+    }
+    else
+    {
+      clientRoles = "0";
+    }
+    String primaryIp = serverWeb.arg("primaryIp");
+    String observerRefuse;
+    if (serverWeb.arg("observerRefuse") == "on")
+    {
+      observerRefuse = "1";
+    }
+    else
+    {
+      observerRefuse = "0";
+    }
+    String rtsPin = serverWeb.arg("rtsPin");
+    if (rtsPin == "")
+    {
+      rtsPin = "-1";
+    }
+    String ctsPin = serverWeb.arg("ctsPin");
+    if (ctsPin == "")
+    {
+      ctsPin = "-1";
+    }
+    String flowControl;
+    if (serverWeb.arg("flowControl") == "on")
+    {
+      int rts, cts;
+      if (!zigbeeFlowControlPins(rtsPin.toInt(), ctsPin.toInt(), rts, cts))
+      {
+        serverWeb.send(500, "text/plain", "RTS/CTS flow control needs both pins");
+        return;
+      }
+      flowControl = "1";
+    }
+    else
+    {
+      flowControl = "0";
+    }
+    String uartRxBuffer = serverWeb.arg("uartRxBuffer");
+    if (uartRxBuffer == "")
+    {
+      uartRxBuffer = String(UART_RX_BUFFER);
+    }
+    String uartRxFifoFull = serverWeb.arg("uartRxFifoFull");
+    if (uartRxFifoFull == "")
+    {
+      uartRxFifoFull = String(UART_RX_FIFO_FULL);
+    }
+    String uartRxTimeout = serverWeb.arg("uartRxTimeout");
+    if (uartRxTimeout == "")
+    {
+      uartRxTimeout = String(UART_RX_TIMEOUT);
+    }
+    String srspRouting;
+    if (serverWeb.arg("srspRouting") == "on")
+    {
+      srspRouting = "1";
+    }
+    else
+    {
+      srspRouting = "0";
+    }
+    String slowClientDrop;
+    if (serverWeb.arg("slowClientDrop") == "on")
+    {
+      slowClientDrop = "1";
+    }
+    else
+    {
+      slowClientDrop = "0";
+    }
     const char *path = "/config/configSerial.json";
 
-    StringConfig = "{\"baud\":" + serialSpeed + ", \"port\":" + socketPort + "}";
-    DEBUG_PRINTLN(StringConfig);
-    DynamicJsonDocument doc(1024);
+    StringConfig = "{\"baud\":" + serialSpeed + ", \"port\":" + socketPort + ", \"serialRing\":" + serialRing + ", \"netRing\":" + netRing + ", \"znpFramer\":" + znpFramer + ", \"framerTimeout\":" + framerTimeout + ", \"clientLag\":" + clientLag + ", \"slowClientDrop\":" + slowClientDrop + ", \"writerBudget\":" + writerBudget + ", \"clientRoles\":" + clientRoles + ", \"primaryIp\":\"" + primaryIp + "\", \"observerRefuse\":" + observerRefuse + ", \"srspRouting\":" + srspRouting + ", \"flowControl\":" + flowControl + ", \"rtsPin\":" + rtsPin + ", \"ctsPin\":" + ctsPin + ", \"uartRxBuffer\":" + uartRxBuffer + ", \"uartRxFifoFull\":" + uartRxFifoFull + ", \"uartRxTimeout\":" + uartRxTimeout + "}";
+    DynamicJsonDocument doc(2048);
     deserializeJson(doc, StringConfig);
 
     File configFile = LittleFS.open(path, FILE_WRITE);
     if (!configFile)
     {
-      DEBUG_PRINTLN(F("failed open"));
+      LOGE(WEB, "%s failed open", path);
     }
     else
     {
-      serializeJson(doc, configFile);
+      size_t size = serializeJson(doc, configFile);
+      LOGD(WEB, "%s saved, %u bytes", path, (unsigned)size);
     }
     handleSaveSucces("config");
   }
@@ -1002,18 +1215,18 @@ void handleSaveEther()
     const char *path = "/config/configEther.json";
 
     StringConfig = "{\"dhcp\":" + dhcp + ",\"ip\":\"" + ipAddress + "\",\"mask\":\"" + ipMask + "\",\"gw\":\"" + ipGW + "\",\"disablePingCtrl\":\"" + disablePingCtrl + "\"}";
-    DEBUG_PRINTLN(StringConfig);
     DynamicJsonDocument doc(1024);
     deserializeJson(doc, StringConfig);
 
     File configFile = LittleFS.open(path, FILE_WRITE);
     if (!configFile)
     {
-      DEBUG_PRINTLN(F("failed open"));
+      LOGE(WEB, "%s failed open", path);
     }
     else
     {
-      serializeJson(doc, configFile);
+      size_t size = serializeJson(doc, configFile);
+      LOGD(WEB, "%s saved, %u bytes", path, (unsigned)size);
     }
     handleSaveSucces("config");
   }
@@ -1060,22 +1273,30 @@ void handleSaveMqtt()
     {
       discovery = "0";
     }
+    String metrics;
+    if (serverWeb.arg("metrics") == "on")
+    {
+      metrics = "1";
+    }
+    else
+    {
+      metrics = "0";
+    }
     const char *path = "/config/configMqtt.json";
 
-    StringConfig = "{\"enable\":" + enable + ",\"server\":\"" + server + "\",\"port\":" + port + ",\"user\":\"" + user + "\",\"pass\":\"" + pass + "\",\"topic\":\"" + topic + "\",\"interval\":" + interval + ",\"discovery\":" + discovery + "}";
-
-    DEBUG_PRINTLN(StringConfig);
+    StringConfig = "{\"enable\":" + enable + ",\"server\":\"" + server + "\",\"port\":" + port + ",\"user\":\"" + user + "\",\"pass\":\"" + pass + "\",\"topic\":\"" + topic + "\",\"interval\":" + interval + ",\"discovery\":" + discovery + ",\"metrics\":" + metrics + "}";
     DynamicJsonDocument doc(1024);
     deserializeJson(doc, StringConfig);
 
     File configFile = LittleFS.open(path, FILE_WRITE);
     if (!configFile)
     {
-      DEBUG_PRINTLN(F("failed open"));
+      LOGE(WEB, "%s failed open", path);
     }
     else
     {
-      serializeJson(doc, configFile);
+      size_t size = serializeJson(doc, configFile);
+      LOGD(WEB, "%s saved, %u bytes", path, (unsigned)size);
     }
     handleSaveSucces("config");
   }
@@ -1085,43 +1306,15 @@ void handleLogs()
 {
   if (checkAuth())
   {
-    String result;
-
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += F("<h2>{{pageName}}</h2>");
-    result += F("<div id='main' class='col-sm-12'>");
-    result += F("<div id='help_btns' class='col-sm-8'>");
-    result += F("<button type='button' onclick='cmd(\"ClearConsole\");document.getElementById(\"console\").value=\"\";' class='btn btn-secondary'>Clear Console</button> ");
-//#ifdef DEBUG
-//    result += F("<button type='button' onclick='cmd(\"GetVersion\");' class='btn btn-success'>Get Version</button> ");
-//    result += F("<button type='button' onclick='cmd(\"ZigRestart\");' class='btn btn-danger'>Zig Restart</button> ");
-//#endif
-    result += F("<button type='button' onclick='cmd(\"ZigRST\");' class='btn btn-primary'>Zigbee Restart</button> ");
-    result += F("<button type='button' onclick='cmd(\"ZigBSL\");' class='btn btn-warning'>Zigbee BSL</button> ");
-    result += F("</div></div>");
-    result += F("<div id='main' class='col-sm-8'>");
-    result += F("<div class='col-md-12'>Raw data :</div>");
-    result += F("<textarea class='col-md-12' id='console' rows='16' ></textarea>");
-    result += F("</div>");
-    result += F("</body>");
-    result += F("<script language='javascript'>");
-    result += F("logRefresh({{refreshLogs}});");
-    result += F("</script>");
-    result += F("</html>");
-
-    result.replace("{{pageName}}", "Console");
-    result.replace("{{refreshLogs}}", (String)ConfigSettings.refreshLogs);
-
-    serverWeb.send(200, F("text/html"), result);
+    sendPage("Console", HTML_CONSOLE, [](PageWriter &page, ConsoleField field)
+             {
+               switch (field)
+               {
+               case ConsoleField::refreshLogs:
+                 page.print(ConfigSettings.refreshLogs);
+                 break;
+               }
+             });
   }
 }
 
@@ -1129,24 +1322,7 @@ void handleReboot()
 {
   if (checkAuth())
   {
-    String result;
-
-    result += F("<html>");
-    result += F("<meta http-equiv='refresh' content='1; URL=/'>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += F("<h2>{{pageName}}</h2>");
-    result = result + F("</body></html>");
-    result.replace("{{pageName}}", "Rebooted");
-
-    serverWeb.send(200, F("text/html"), result);
+    sendPage("Rebooted", HTML_REBOOT);
 
     ESP.restart();
   }
@@ -1156,27 +1332,7 @@ void handleUpdate()
 {
   if (checkAuth())
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += F("<h2>{{pageName}}</h2>");
-    result += F("<div class='btn-group-vertical'>");
-    result += F("<a href='/setchipid' class='btn btn-primary mb-2'>setChipId</button>");
-    result += F("<a href='/setmodeprod' class='btn btn-primary mb-2'>setModeProd</button>");
-    result += F("</div>");
-
-    result = result + F("</body></html>");
-    result.replace("{{pageName}}", "Update Zigbee");
-
-    serverWeb.send(200, F("text/html"), result);
+    sendPage("Update Zigbee", HTML_ZIGBEE_UPDATE);
   }
 }
 
@@ -1184,24 +1340,8 @@ void handleESPUpdate()
 {
   if (checkAuth())
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += F("<h2>{{pageName}}</h2>");
-    result += FPSTR(HTTP_UPDATE);
-    result = result + F("</body></html>");
-    result.replace("{{pageName}}", "Update ESP32");
     serverWeb.sendHeader("Connection", "close");
-
-    serverWeb.send(200, "text/html", result);
+    sendPage("Update ESP32", HTML_UPDATE);
   }
 }
 
@@ -1209,57 +1349,23 @@ void handleFSbrowser()
 {
   if (checkAuth())
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    result += F("<h2>{{pageName}}</h2>");
-    result += F("<div id='main' class='col-sm-12'>");
-    result += F("<div id='help_btns' class='col-md-11'>");
-    result.replace("{{pageName}}", "FSBrowser");
-
-    String str = "";
-    File root = LittleFS.open("/config");
-    File file = root.openNextFile();
-    while (file)
-    {
-      String tmp = file.name();
-      //DEBUG_PRINTLN(tmp);
-      //tmp = tmp.substring(8);
-      result += F("<a href='#' onClick=\"readfile('");
-      result += tmp;
-      result += F("');\">");
-      result += tmp;
-      result += F("<br>(");
-      result += file.size();
-      result += F(" B)</a>");
-      file = root.openNextFile();
-    }
-    result += F("</div>");
-    result += F("<div id='main' class='col-md-9'>");
-    result += F("<div class='app-main-content'>");
-    result += F("<form method='POST' action='saveFile'>");
-    result += F("<div class='form-group'>");
-    result += F("<div><label for='file'>File : <span id='title'></span></label>");
-    result += F("<input type='hidden' name='filename' id='filename' value=''></div>");
-    result += F("<textarea class='form-control' id='file' name='file' rows='10'>");
-    result += F("</textarea>");
-    result += F("</div>");
-    result += F("<button type='submit' class='btn btn-primary mb-2'>Save</button>");
-    result += F("</form>");
-    result += F("</div>");
-    result += F("</div>");
-    result += F("</div>");
-    result += F("</body></html>");
-
-    serverWeb.send(200, F("text/html"), result);
+    sendPage("FSBrowser", HTML_FSBROWSER, [](PageWriter &page, FsbrowserField field)
+             {
+               switch (field)
+               {
+               case FsbrowserField::files:
+               {
+                 File root = LittleFS.open("/config");
+                 File file = root.openNextFile();
+                 while (file)
+                 {
+                   page.printf("<a href='#' onClick=\"readfile('%s');\">%s<br>(%u B)</a>", file.name(), file.name(), (unsigned)file.size());
+                   file = root.openNextFile();
+                 }
+                 break;
+               }
+               }
+             });
   }
 }
 
@@ -1301,7 +1407,7 @@ void handleSavefile()
       File file = LittleFS.open(filename, "w");
       if (!file)
       {
-        DEBUG_PRINT(F("Failed to open file for reading\r\n"));
+        LOGE(WEB, "%s failed open", filename);
         return;
       }
 
@@ -1309,12 +1415,11 @@ void handleSavefile()
 
       if (bytesWritten > 0)
       {
-        DEBUG_PRINTLN(F("File was written"));
-        DEBUG_PRINTLN(bytesWritten);
+        LOGD(WEB, "%s written, %d bytes", filename, bytesWritten);
       }
       else
       {
-        DEBUG_PRINTLN(F("File write failed"));
+        LOGE(WEB, "%s write failed", filename);
       }
 
       file.close();
@@ -1328,10 +1433,290 @@ void handleLogBuffer()
 {
   if (checkAuth())
   {
-    String result;
-    result = logPrint();
+    // ?seq=N returns only records from N on, the reply carries the next
+    // seq and flags records lost since (or a reboot)
+    size_t seq = logFirst();
+    if (serverWeb.hasArg("seq"))
+    {
+      seq = strtoul(serverWeb.arg("seq").c_str(), NULL, 10);
+    }
+    bool overrun;
+    String result = logPrint(seq, overrun, serverWeb.arg("decode") == "1");
 
-    serverWeb.send(200, F("text/html"), result);
+    serverWeb.sendHeader(F("X-Log-Seq"), String(seq));
+    if (overrun && serverWeb.hasArg("seq"))
+    {
+      serverWeb.sendHeader(F("X-Log-Overrun"), "1");
+    }
+    if (result.length() == 0 && !overrun)
+    {
+      serverWeb.send(204);
+      return;
+    }
+    serverWeb.send(200, F("text/plain"), result);
+  }
+}
+
+// the console as the previous boot left it, ?decode=1 as on the console
+void handleLastLog()
+{
+  if (checkAuth())
+  {
+    String result = F("reset reason: ");
+    result += logResetReason();
+    result += '\n';
+    result += logPrintLast(serverWeb.arg("decode") == "1");
+    serverWeb.send(200, F("text/plain"), result);
+  }
+}
+
+// bridge latency histograms, /metrics?reset=1 starts them over
+void handleMetrics()
+{
+  if (checkAuth())
+  {
+    String result = bridgeMetricsJson(true);
+    if (serverWeb.arg("reset") == "1")
+    {
+      bridgeLatencyReset();
+    }
+    serverWeb.send(200, F("application/json"), result);
+  }
+}
+
+// Console push: the socket of an /events request is kept and fed new
+// records every EVENT_TICK_MS as one event. A browser that doesn't take
+// them fast enough gets no new batch until the last one is out; when
+// records were overwritten meanwhile, or the gateway rebooted, a "lost"
+// event precedes the batch, which then starts at the oldest record.
+struct EventClient
+{
+  WiFiClient client;
+  size_t seq;
+  bool decode;
+  String pending;
+  unsigned long sentTime;
+};
+EventClient eventClients[EVENT_CLIENTS];
+unsigned long eventsTime = 0;
+
+void handleEvents()
+{
+  if (checkAuth())
+  {
+    int slot;
+    for (slot = 0; slot < EVENT_CLIENTS; slot++)
+    {
+      if (!eventClients[slot].client.connected())
+        break;
+    }
+    if (slot == EVENT_CLIENTS)
+    {
+      serverWeb.send(503, F("text/plain"), F("Too many consoles"));
+      return;
+    }
+
+    EventClient &sub = eventClients[slot];
+    sub.client = serverWeb.client();
+    sub.client.setNoDelay(true);
+    // a reconnecting browser continues where it left off
+    sub.seq = logFirst();
+    if (serverWeb.hasHeader("Last-Event-ID"))
+    {
+      sub.seq = strtoul(serverWeb.header("Last-Event-ID").c_str(), NULL, 10);
+    }
+    else if (serverWeb.hasArg("seq"))
+    {
+      sub.seq = strtoul(serverWeb.arg("seq").c_str(), NULL, 10);
+    }
+    sub.decode = serverWeb.arg("decode") == "1";
+    sub.pending = F("HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\nConnection: keep-alive\r\n\r\nretry: 2000\n\n");
+    sub.sentTime = millis();
+  }
+}
+
+// false once the browser is gone
+bool eventsSend(EventClient &sub)
+{
+  ssize_t sent = send(sub.client.fd(), sub.pending.c_str(), sub.pending.length(), MSG_DONTWAIT);
+  if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+  {
+    sub.client.stop();
+    sub.pending = "";
+    return false;
+  }
+  if (sent > 0)
+  {
+    sub.pending.remove(0, sent);
+    sub.sentTime = millis();
+  }
+  return true;
+}
+
+void eventsLoop()
+{
+  if (millis() - eventsTime < EVENT_TICK_MS)
+    return;
+  eventsTime = millis();
+
+  for (int slot = 0; slot < EVENT_CLIENTS; slot++)
+  {
+    EventClient &sub = eventClients[slot];
+    if (!sub.client.connected())
+      continue;
+    if (sub.pending.length() == 0)
+    {
+      bool overrun;
+      String text = logPrint(sub.seq, overrun, sub.decode);
+      if (overrun)
+      { // fell behind the ring or rebooted: say so, then go on from the oldest record
+        sub.pending = "event: lost\ndata: \n\n";
+      }
+      if (text.length() > 0)
+      {
+        text.remove(text.length() - 1);
+        text.replace("\n", "\ndata: ");
+        sub.pending += "id: " + String(sub.seq) + "\ndata: " + text + "\n\n";
+      }
+      else if (!overrun && millis() - sub.sentTime > EVENT_KEEPALIVE_MS)
+      {
+        sub.pending = ":\n\n";
+      }
+    }
+    if (sub.pending.length() > 0)
+    {
+      eventsSend(sub);
+    }
+  }
+}
+
+// Traffic capture: a pcap stream of the console's traffic records, sent
+// as one HTTP chunk per packet. LINKTYPE_USER0 with a 2-byte
+// pseudo-header: direction (0 to the Zigbee UART, 1 from it) and socket
+// client (0xFF for all). Each record is copied out of the ring before it
+// is sent, packets longer than CAPTURE_SNAPLEN are cut. A browser that
+// falls behind skips the records it missed.
+#define PCAP_LINKTYPE_USER0 147
+#define PCAP_PSEUDO_LEN 2
+
+struct CaptureClient
+{
+  WiFiClient client;
+  size_t seq;
+  // what is being sent: the HTTP response header and pcap file header
+  // first, then one chunk per packet
+  uint8_t packet[8 + 16 + PCAP_PSEUDO_LEN + CAPTURE_SNAPLEN + 2];
+  size_t packetLen;
+  size_t sent;
+  int64_t epochMs;
+};
+CaptureClient captureClients[CAPTURE_CLIENTS];
+
+void handleCapture()
+{
+  if (checkAuth())
+  {
+    int slot;
+    for (slot = 0; slot < CAPTURE_CLIENTS; slot++)
+    {
+      if (!captureClients[slot].client.connected())
+        break;
+    }
+    if (slot == CAPTURE_CLIENTS)
+    {
+      serverWeb.send(503, F("text/plain"), F("Capture already running"));
+      return;
+    }
+
+    CaptureClient &cap = captureClients[slot];
+    cap.client = serverWeb.client();
+    cap.client.setNoDelay(true);
+    cap.seq = logFirst();
+    cap.sent = 0;
+    // record times are millis(), the wall clock if it was ever set
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    cap.epochMs = (int64_t)now.tv_sec * 1000 + now.tv_usec / 1000 - millis();
+
+    const uint32_t header[6] = {0xA1B2C3D4, 0x00040002, 0, 0, PCAP_PSEUDO_LEN + CAPTURE_SNAPLEN, PCAP_LINKTYPE_USER0};
+    int len = snprintf((char *)cap.packet, sizeof(cap.packet), "HTTP/1.1 200 OK\r\nContent-Type: application/vnd.tcpdump.pcap\r\nContent-Disposition: attachment; filename=capture.pcap\r\nCache-Control: no-cache\r\nTransfer-Encoding: chunked\r\n\r\n%x\r\n", (unsigned)sizeof(header));
+    memcpy(cap.packet + len, header, sizeof(header));
+    len += sizeof(header);
+    memcpy(cap.packet + len, "\r\n", 2);
+    cap.packetLen = len + 2;
+  }
+}
+
+// puts the next traffic record from cap.seq into cap.packet, false if
+// there is none yet; the lock only covers copying the record
+bool captureNext(CaptureClient &cap)
+{
+  uint8_t data[sizeof(LogHeader) + CAPTURE_SNAPLEN];
+  size_t len = 0;
+  logLock();
+  const RecordRing &ring = logRecords();
+  if ((ptrdiff_t)(cap.seq - ring.first()) < 0 || (ptrdiff_t)(ring.end() - cap.seq) < 0)
+  {
+    cap.seq = ring.first();
+  }
+  while (len == 0 && cap.seq != ring.end())
+  {
+    LogHeader header;
+    ring.read(cap.seq, &header, sizeof(header));
+    if (header.type != LOG_MSG)
+    {
+      len = ring.read(cap.seq, data, sizeof(data));
+    }
+    cap.seq = ring.next(cap.seq);
+  }
+  logUnlock();
+  if (len == 0)
+    return false;
+
+  // chunk size line, pcap record header and pseudo-header, the data and
+  // the chunk's line break
+  LogHeader header;
+  memcpy(&header, data, sizeof(header));
+  size_t origLen = PCAP_PSEUDO_LEN + len - sizeof(header);
+  size_t dataLen = len - sizeof(header) < CAPTURE_SNAPLEN ? len - sizeof(header) : CAPTURE_SNAPLEN;
+  size_t packetLen = PCAP_PSEUDO_LEN + dataLen;
+  size_t n = snprintf((char *)cap.packet, 8, "%x\r\n", (unsigned)(16 + packetLen));
+  int64_t ms = cap.epochMs + header.time;
+  uint32_t record[4] = {(uint32_t)(ms / 1000), (uint32_t)(ms % 1000) * 1000, (uint32_t)packetLen, (uint32_t)origLen};
+  memcpy(cap.packet + n, record, sizeof(record));
+  n += sizeof(record);
+  cap.packet[n++] = header.type == LOG_TO_UART ? 0 : 1;
+  cap.packet[n++] = header.client;
+  memcpy(cap.packet + n, data + sizeof(header), dataLen);
+  n += dataLen;
+  memcpy(cap.packet + n, "\r\n", 2);
+  cap.packetLen = n + 2;
+  cap.sent = 0;
+  return true;
+}
+
+void captureLoop()
+{
+  for (int slot = 0; slot < CAPTURE_CLIENTS; slot++)
+  {
+    CaptureClient &cap = captureClients[slot];
+    while (cap.client.connected())
+    {
+      if (cap.sent == cap.packetLen && !captureNext(cap))
+        break;
+      ssize_t sent = send(cap.client.fd(), cap.packet + cap.sent, cap.packetLen - cap.sent, MSG_DONTWAIT);
+      if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+      {
+        cap.client.stop();
+        break;
+      }
+      if (sent > 0)
+      {
+        cap.sent += sent;
+      }
+      if (cap.sent < cap.packetLen)
+        break;
+    }
   }
 }
 
@@ -1393,7 +1778,7 @@ void handleZigbeeRestart()
   {
     serverWeb.send(200, F("text/html"), "");
 
-    zigbeeRestart();
+    zigbeeRestartPending = true;
   }
 }
 
@@ -1403,59 +1788,16 @@ void handleZigbeeBSL()
   {
     serverWeb.send(200, F("text/html"), "");
 
-    zigbeeEnableBSL();
-  }
-}
-
-void printLogTime()
-{
-  String tmpTime;
-  timeLog = millis();
-  tmpTime = String(timeLog, DEC);
-  logPush('[');
-  for (int j = 0; j < tmpTime.length(); j++)
-  {
-    logPush(tmpTime[j]);
-  }
-  logPush(']');
-}
-
-void printLogMsg(String msg)
-{
-  printLogTime();
-  logPush(' ');
-  logPush('|');
-  logPush(' ');
-  for (int j = 0; j < msg.length(); j++)
-  {
-    logPush(msg[j]);
+    zigbeeBslPending = true;
   }
-  logPush('\n');
 }
 
 void handleWEBUpdate()
 {
   if (checkAuth())
   {
-    String result;
-    result += F("<html>");
-    result += FPSTR(HTTP_HEADER);
-    if (ConfigSettings.webAuth)
-    {
-      result.replace("{{logoutLink}}", LOGOUT_LINK);
-    }
-    else
-    {
-      result.replace("{{logoutLink}}", "");
-    }
-    
-    result += F("<h2>{{pageName}}</h2>");
-    //result += FPSTR(HTTP_UPDATE);
-    result = result + F("</body></html>");
-    result.replace("{{pageName}}", "Update ESP32");
     serverWeb.sendHeader("Connection", "close");
-
-    serverWeb.send(200, "text/html", result);
+    sendPage("Update ESP32", HTML_ERROR);
     checkUpdateFirmware();
   }
 }
@@ -1486,15 +1828,13 @@ void checkUpdateFirmware()
       // this is required to start firmware update process
       Update.begin(UPDATE_SIZE_UNKNOWN);
       Update.onProgress(progressFunc);
-      DEBUG_PRINT("FW Size: ");
-      
-      DEBUG_PRINTLN(totalLength);
+      LOGI(WEB, "FW Size: %d", totalLength);
       // create buffer for read
       uint8_t buff[128] = { 0 };
       // get tcp stream
       WiFiClient * stream = clientWeb.getStreamPtr();
       // read all data from server
-      DEBUG_PRINTLN("Updating firmware...");
+      LOGI(WEB, "Updating firmware...");
       while(clientWeb.connected() && (len > 0 || len == -1)) {
           // get available data size
           size_t size = stream->available();
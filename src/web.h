@@ -1,5 +1,6 @@
 void initWebServer();
 void webServerHandleClient();
+void webLoop();
 void handleGeneral();
 void handleRoot();
 void handleWifi();
@@ -18,6 +19,12 @@ void handleFSbrowser();
 void handleReadfile();
 void handleSavefile();
 void handleLogBuffer();
+void handleMetrics();
+void handleLastLog();
+void handleEvents();
+void eventsLoop();
+void handleCapture();
+void captureLoop();
 void handleScanNetwork();
 void handleClearConsole();
 void handleGetVersion();
@@ -28,19 +35,7 @@ void handleSaveGeneral();
 void handleHelp();
 void handleESPUpdate();
 void handleLoggedOut();
-void printLogTime();
-void printLogMsg(String msg);
 void handleSaveSucces(String msg);
-void handle_functions_js();
-void handle_jquery_js();
-void handle_bootstrap_js();
-void handle_required_css();
-void handle_toast_js();
-void handle_glyphicons_woff();
-void handle_logo_png();
-void handle_wait_gif();
-void handle_nok_png();
-void handle_ok_png();
 void zigbeeCmdSend(uint8_t one_byte);
 bool checkAuth();
 void handleWEBUpdate();
@@ -0,0 +1,39 @@
+// generated by tools/webfilesbuilder from src/websrc/gzipped, do not edit
+#ifndef WEBH_ASSETS_H_
+#define WEBH_ASSETS_H_
+
+#include "required.css.gz.h"
+#include "glyphicons.woff.gz.h"
+#include "logo.png.gz.h"
+#include "nok.png.gz.h"
+#include "ok.png.gz.h"
+#include "wait.gif.gz.h"
+#include "bootstrap.min.js.gz.h"
+#include "functions.js.gz.h"
+#include "jquery-min.js.gz.h"
+#include "toast.js.gz.h"
+
+struct WebAsset
+{
+  const char *url;
+  const char *type;
+  const uint8_t *data;
+  uint32_t len;
+  const char *hash;
+};
+
+// sorted by url
+constexpr WebAsset WEB_ASSETS[] PROGMEM = {
+    {"/css/required.css", "text/css", required_css_gz, required_css_gz_len, required_css_gz_hash},
+    {"/fonts/glyphicons.woff", "font/woff", glyphicons_woff_gz, glyphicons_woff_gz_len, glyphicons_woff_gz_hash},
+    {"/img/logo.png", "image/png", logo_png_gz, logo_png_gz_len, logo_png_gz_hash},
+    {"/img/nok.png", "image/png", nok_png_gz, nok_png_gz_len, nok_png_gz_hash},
+    {"/img/ok.png", "image/png", ok_png_gz, ok_png_gz_len, ok_png_gz_hash},
+    {"/img/wait.gif", "image/gif", wait_gif_gz, wait_gif_gz_len, wait_gif_gz_hash},
+    {"/js/bootstrap.min.js", "text/javascript", bootstrap_min_js_gz, bootstrap_min_js_gz_len, bootstrap_min_js_gz_hash},
+    {"/js/functions.js", "text/javascript", functions_js_gz, functions_js_gz_len, functions_js_gz_hash},
+    {"/js/jquery-min.js", "text/javascript", jquery_min_js_gz, jquery_min_js_gz_len, jquery_min_js_gz_hash},
+    {"/js/toast.js", "text/javascript", toast_js_gz, toast_js_gz_len, toast_js_gz_hash}};
+#define WEB_ASSET_COUNT 10
+
+#endif
@@ -1,4 +1,5 @@
 #define bootstrap_min_js_gz_len 15886
+#define bootstrap_min_js_gz_hash "e2e2803a002367f2"
 const uint8_t bootstrap_min_js_gz[] PROGMEM = {
 0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xdd,0x3d,0x6b,0x57,0xe3,0xc6,0x92,0xdf,0xf7,0x57,0x80,0xee,0x2c,0x23,0x85,0xc6,0x40,0x92,0xbb,0x77,0xaf,0x8d,0xe2,0xc3,0x00,0x93,0x61,0x1e,0x40,0x80,0x99,0xcc,0x84,0xf8,0x72,0x84,0xdd,0x18,0x65,0x4c,0xcb,0x91,0xda,0x30,0x04,0x7b,0x7f,0xfb,0x56,0xf5,0x4b,0xdd,0x52,0xcb,0x36,0xb3,0xc9,0xfd,0xb0,0x39,0x39,0x8c,0xd5,0xef,0x47,0x75,0x55,0x75,0xbd,0x7a,0xf3,0x9b,0xd5,0xff,0x58,0x59,0xf9,0x66,0xe5,0x45,0x96,0xf1,0x82,0xe7,0xc9,0x78,0xe5,0xee,0xfb,0xd6,0xf7,0xad,0xed,0x95,0xf0,0x86,0xf3,0x71,0xd1,0xde,0xdc,0x1c,0x52,0x7e,0xa5,0x33,0x5b,0xfd,0xec,0x76,0x33,0x12,0x15,0xf6,0xb2,0xf1,0x43,0x9e,0x0e,0x6f,0xf8,0xca,0xb7,0x5b,0xdb,0xdb,0x1b,0xf0,0xe7,0x9f,0x2b,0xe7,0x37,0xd4,0x6a,0x68,0x77,0xc2,0x6f,0xb2,0xbc,0xb0,0x5a,0x4a,0xf9,0xcd,0xe4,0x4a,0xb4,0xc1,0xef,0xaf,0x8a,0x4d,0xd3,0xec,0xe6,0x10,0xfe,0xdc,0x14,0x9b,0xfd,0x8c,0xf1,0x3c,0xbd,0x9a,0x70,0xa8,0x26,0x7b,0x79,0x9b,0xf6,0x29,0x2b,0xe8,0x60,0x65,0xc2,0x06,0x34,0x5f,0x79,0x77,0x78,0xbe,0x4c,0x73,0x57,0xa3,0xec,0x6a,0xf3,0x36,0x29,0x38,0xcd,0x37,0xdf,0x1e,0xee,0x1d,0x1c,0x9d,0x1d,0x88,0xe6,0x36,0xff,0x63,0xf5,0x7a,0xc2,0xfa,0x3c,0xcd,0x58,0xc8,0x09,0x8d,0x1e,0x83,0xec,0xea,0x37,0xda,0xe7,0x41,0x1c,0xf3,0x87,0x31,0xcd,0xae,0x57,0xe8,0x97,0x71,0x96,0xf3,0x62,0x6d,0x2d,0xc0,0x0e,0xaf,0x53,0x46,0x07,0xc1,0xaa,0xce,0xbc,0xcd,0x06,0x93,0x11,0xed,0xd2,0x50,0x95,0x22,0x39,0xfd,0x7d,0x92,0xe6,0x34,0x0c,0x7e,0xfb,0x7d,0x42,0xf3,0x87,0x20,0x2a,0x53,0xc6,0xd9,0x78,0x4c,0xf3,0xd6,0x6f,0x45,0x10,0x45,0xed,0x40,0xf7,0x5a,0x76,0x24,0x1b,0x5f,0x5b,0x93,0xff,0xb6,0x92,0xdb,0x41,0x57,0xfe,0x0c,0x2f,0x02,0xd5,0x7c,0x40,0x74,0xbb,0xc4,0x6a,0xae,0x07,0xe3,0x6e,0xd3,0x30,0xe4,0x31,0x9f,0x4e,0x0b,0x3a,0xba,0x8e,0x5a,0x66,0xe2,0xf1,0xe3,0x8c,0xf0,0xd6,0x6f,0x3f,0x61,0x25,0xf8,0x71,0x22,0x2a,0x45,0xb3,0x90,0xdf,0xa4,0x05,0xb1,0x66,0x3e,0x24,0x13,0x98,0xfb,0xa4,0xa0,0x2b,0x50,0x2d,0x85,0xf9,0x77,0x74,0xe6,0x4a,0x2a,0x17,0xe6,0x3a,0xcb,0xc3,0xbb,0x24,0x5f,0x61,0xf1,0x56,0x87,0xed,0xd0,0xd6,0x88,0xb2,0x21,0xbf,0xe9,0xb0,0xf5,0xf5,0xe8,0x11,0xd3,0xd3,0x98,0x5e,0xb0,0x5e,0x27,0x6d,0x51,0x36,0xb9,0xa5,0x79,0x72,0x35,0xa2,0xb1,0xfd,0x31,0x9d,0xae,0x6e,0x93,0x14,0xf6,0x86,0x5d,0xa7,0xc3,0x89,0xcc,0x5f,0xdd,0x22,0xc1,0x5d,0x32,0x9a,0xd0,0x20,0x85,0x7e,0xd6,0xd6,0xc2,0xb4,0x75,0x9f,0xa7,0x5c,0xe5,0x45,0xe4,0x58,0xec,0x45,0x4b,0x2e,0xc3,0x49,0x9e,0xc1,0xd8,0xf9,0x03,0x0c,0x27,0x6d,0x7d,0xa6,0x0f,0x24,0x8d,0x66,0x33,0x33,0xca,0x02,0x47,0x49,0x58,0xf4,0x98,0x53,0x3e,0xc9,0xd9,0x0a,0x2c,0x24,0x0c,0xbc,0x35,0xce,0x33,0x9e,0xe1,0x02,0xc3,0x14,0x08,0x13,0x69,0x50,0x88,0xf0,0xb2,0x22,0xec,0x1d,0xe1,0x72,0x0a,0x2c,0x56,0x1d,0x42,0xeb,0x45,0x48,0xa3,0x4e,0x7a,0x1d,0xaa,0x14,0x00,0xf9,0xe3,0x7b,0xa6,0x87,0x70,0xf6,0x70,0x7b,0x95,0x8d,0x0a,0x3d,0xf1,0x79,0x65,0xb0,0x19,0x8e,0x33,0x83,0xc5,0xb8,0x4e,0x47,0x00,0x7f,0x61,0xb9,0xec,0x66,0xb4,0xde,0x16,0xf6,0x69,0xd1,0xcf,0xd3,0x31,0x80,0xbe,0x18,0xa2,0xb5,0x96,0xb3,0x08,0x26,0xd3,0x1a,0x4f,0x8a,0x9b,0x56,0x32,0x1e,0x8f,0x1e,0x42,0x86,0x8b,0xa1,0xda,0x62,0xe5,0xdc,0x46,0x61,0x56,0x6e,0x1c,0x8f,0xb7,0x3b,0x7c,0x27,0xc9,0x87,0xd0,0x0a,0xe3,0x85,0xde,0x40,0xae,0x37,0x30,0x8f,0xd9,0x64,0x34,0x5a,0x8d,0x4d,0x89,0x0b,0xde,0xeb,0xda,0x1f,0xed,0xc7,0x59,0x87,0xff,0xe7,0xb7,0x00,0xed,0x72,0xb8,0x61,0x1e,0x11,0xd8,0xa5,0x16,0x74,0x70,0x90,0xf4,0x6f,0x9c,0x79,0x61,0x83,0xb0,0x1d,0x24,0xed,0xd0,0x38,0x23,0x69,0x9c,0x5f,0xb0,0x98,0xf7,0x08,0xec,0x32,0xac,0x78,0xd7,0xbf,0xaf,0x58,0xfe,0x51,0x80,0x43,0x3b,0x25,0xe5,0x64,0xdb,0x00,0x25,0x36,0xd4,0xe0,0xb7,0x86,0x12,0xf8,0x3d,0x03,0xd8,0x07,0xc0,0x8b,0x53,0xf8,0xb1,0x60,0x19,0x0b,0x6f,0xc7,0x29,0x2d,0xc2,0x8c,0x2c,0xaa,0x0a,0x93,0xc5,0x43,0x66,0x66,0xee,0x9f,0xb6,0x7f,0x62,0x19,0xe1,0x8b,0xda,0x0f,0x73,0xd8,0xe1,0x68,0x66,0x36,0x31,0x9b,0x0d,0xe3,0xe1,0xda,0xda,0xb0,0x75,0x93,0x14,0x56,0x85,0x30,0x80,0xa6,0x93,0xc9,0x88,0x07,0x51,0x77,0xd8,0x52,0xbf,0xdb,0x70,0x78,0xe3,0xc9,0xda,0xda,0x64,0x4e,0xe1,0x89,0x29,0x3c,0xe9,0x48,0x50,0x0f,0x00,0x3d,0xb0,0x22,0xc5,0x91,0x53,0x36,0xb0,0xce,0x7b,0x66,0xf6,0x2f,0x16,0x58,0x82,0xc5,0xab,0xdb,0x1d,0x35,0xac,0xa1,0x40,0x1c,0x51,0x0b,0xea,0x84,0x97,0xad,0xf3,0xd3,0xdd,0xa3,0xb3,0xc3,0xf3,0xc3,0xe3,0xa3,0xcb,0x83,0xa3,0xfd,0x12,0x9d,0x44,0x8f,0x50,0x07,0x36,0x86,0x14,0x94,0x9f,0xa7,0xb7,0x34,0x9b,0xf0,0xd0,0xce,0x9c,0x4e,0x2f,0x5b,0x80,0x65,0x86,0x43,0x9a,0x9f,0x9b,0x41,0x1c,0xb0,0x01,0x9c,0x15,0xc0,0x56,0x70,0x3a,0xa1,0x8f,0x19,0x8e,0xe0,0x32,0x7e,0x74,0xfb,0x68,0x07,0x57,0x85,0x53,0x25,0x20,0xb0,0xa2,0xef,0x0f,0xf7,0xdb,0xf6,0x2e,0x20,0xc4,0x03,0x5c,0xc7,0xff,0xf3,0x3f,0xe1,0x36,0xfd,0xaf,0x6f,0xde,0x25,0xfc,0xa6,0x05,0x95,0x06,0xd9,0x6d,0x08,0x07,0x67,0x90,0xf5,0x05,0x48,0xe3,0x5e,0x1c,0x8c,0x28,0xfe,0x7c,0xf1,0x70,0x38,0x80,0x8a,0x9d,0x48,0xcf,0x93,0xcf,0xb0,0xdd,0x33,0x3a,0x82,0x3d,0xcb,0xf2,0x97,0x79,0x76,0xab,0x4a,0xb6,0x6b,0x40,0x1e,0x8b,0x86,0x76,0xb9,0x24,0x53,0x80,0xe7,0x07,0x09,0x4f,0x36,0x38,0x1c,0x1c,0x0a,0x0b,0x8f,0x28,0x64,0x15,0x70,0x5f,0xf0,0x37,0x40,0xf4,0x31,0xd5,0x78,0xa6,0x5a,0xe7,0x26,0xa7,0xd7,0x50,0x98,0xc6,0x80,0xa2,0xa0,0xe8,
 0x6a,0x1c,0xb3,0x2e,0xc3,0x35,0x82,0x11,0xb7,0x83,0x60,0xc6,0xf3,0x07,0x8d,0x2a,0xcc,0xf0,0x05,0x21,0xd0,0x43,0x84,0xa5,0xeb,0xd2,0x36,0x1e,0xe0,0x59,0x3f,0xe1,0x00,0x95,0x25,0x6e,0x11,0x89,0x62,0x3e,0xe5,0xca,0xed,0xc3,0x51,0xc2,0x7f,0x9b,0x66,0x86,0xa3,0xe6,0x91,0x6a,0x60,0xab,0x23,0x27,0x0a,0x9b,0x1f,0xb5,0xfa,0x45,0x11,0x5a,0xa0,0xb3,0x31,0x50,0x2d,0x01,0xa5,0x63,0x0d,0x25,0xe8,0x28,0x41,0x42,0x98,0xc6,0xe3,0x24,0x2f,0xe8,0xcb,0x51,0x96,0x70,0x18,0x2e,0xc9,0xec,0x6f,0x66,0x96,0x3e,0x9d,0x4e,0xb3,0x6e,0x48,0x63,0xda,0x2a,0xc6,0xa3,0x94,0x87,0x40,0xea,0xa2,0x8b,0x2d,0x40,0x1d,0x31,0xab,0xa4,0x6c,0xd3,0xef,0xbe,0x09,0x9d,0x36,0xd7,0x9d,0x16,0xe1,0xc0,0x6e,0xcd,0x80,0xfe,0x5e,0x8f,0xb2,0xfb,0xb6,0x07,0xe9,0xf2,0x56,0x76,0x7d,0x0d,0x20,0xfa,0x8a,0x22,0xd3,0x02,0x90,0xe7,0x01,0x49,0xa7,0x9e,0x98,0x9e,0x2a,0x05,0xed,0xcf,0x48,0x31,0x19,0x0b,0xba,0xdc,0x50,0xc5,0xf4,0x04,0x1c,0xd0,0x88,0x26,0x4c,0xd4,0x49,0x0b,0xdf,0x82,0xcb,0x82,0x21,0x87,0x79,0x4d,0xa7,0xd0,0x0b,0xcb,0x06,0xf4,0x1c,0xc8,0x16,0x8c,0x0a,0xfe,0xee,0xdd,0xd0,0xfe,0xe7,0x3d,0x81,0x03,0xdb,0x36,0xbb,0x82,0xf4,0x4e,0xa3,0xf7,0x14,0x51,0x2b,0x8b,0x4a,0x92,0x65,0x48,0x5f,0x05,0x2d,0xb4,0xfa,0xc9,0x68,0x24,0x28,0x86,0x84,0xc6,0x2c,0x66,0x17,0x69,0x8f,0xe4,0x40,0xbf,0xe1,0x9f,0x22,0xce,0xd7,0xd6,0x2e,0x5b,0x66,0x94,0x80,0xea,0xba,0x01,0x95,0xbf,0x83,0x76,0x98,0xc4,0x39,0x79,0x9c,0xb5,0x78,0x76,0x06,0xeb,0xc0,0x86,0xb2,0xad,0x24,0x6a,0xdd,0x0a,0xa0,0xdb,0xfc,0xb5,0x08,0x2f,0x92,0x8d,0x3f,0x7a,0xeb,0xd1,0x66,0x1a,0x5d,0x6c,0xf7,0xa0,0xe0,0xdb,0xec,0x9e,0xe6,0x7b,0x49,0x41,0xe1,0xec,0x89,0xd3,0xc0,0xe8,0xfd,0xca,0x29,0x1d,0x1e,0x7c,0x19,0x03,0x75,0x6a,0x71,0x5a,0xf0,0xb0,0x88,0x22,0x7e,0x93,0x67,0xf7,0x2b,0x98,0x77,0x90,0xe7,0x30,0x25,0x0e,0x55,0xdf,0x23,0xb3,0x22,0xab,0xae,0x3f,0x6f,0xaf,0x1c,0x8f,0x05,0x7e,0x0a,0x9e,0xaf,0xa7,0xeb,0xcf,0x83,0x15,0x98,0xdf,0x5d,0x3a,0x00,0x46,0x10,0xe7,0x88,0xa9,0x05,0xa6,0xc2,0x79,0x42,0x96,0x0d,0x16,0xc0,0xca,0xc9,0x20,0xa7,0xf5,0x3c,0x12,0x38,0x25,0x99,0x11,0x40,0xce,0x83,0xb3,0x9b,0x64,0x90,0xdd,0x9f,0x02,0x9f,0x54,0x03,0x7c,0x73,0xc2,0xf4,0x0f,0xb5,0x14,0xad,0x84,0x73,0x40,0xf8,0xb2,0x66,0x64,0x9d,0x2e,0x9c,0x56,0xc9,0xd0,0x19,0xe6,0x50,0x1c,0x72,0xec,0xe1,0x08,0x36,0x53,0x97,0xe7,0xb0,0x4d,0x05,0x4f,0x58,0x1f,0x4b,0x94,0x83,0xe8,0xf2,0x36,0xec,0x58,0x92,0x43,0x37,0x58,0xba,0x7b,0xd9,0x72,0x07,0x19,0xda,0xb9,0x91,0x38,0xe8,0x1d,0x0b,0xfd,0xe8,0x5e,0x42,0x73,0x8c,0x68,0x43,0x3f,0x0a,0x49,0x10,0xc9,0x12,0xee,0x53,0x4e,0xc5,0xa8,0x6d,0xa0,0xc5,0xd9,0x94,0xbc,0xae,0xe1,0x4f,0x87,0xd6,0x1e,0x21,0x68,0xca,0x7d,0x0a,0x0c,0x77,0xff,0xbc,0x58,0x79,0x9d,0xdc,0x25,0x67,0x82,0xa2,0xad,0x28,0xb6,0xb7,0x58,0x91,0x1d,0xb5,0xd4,0xbf,0x2b,0xb7,0x93,0x82,0xaf,0x5c,0xe1,0xe8,0xfa,0xa3,0x09,0xee,0xde,0x15,0x05,0x08,0xb6,0x2e,0x09,0x4e,0x33,0x2d,0x40,0x8a,0x92,0x77,0x19,0xb6,0xae,0x59,0x4b,0x32,0xbf,0x1a,0x0d,0xac,0x08,0x34,0xa0,0xbf,0x5a,0x12,0xd9,0xe2,0x09,0xda,0xf9,0x76,0x6d,0x8d,0x03,0xf4,0xed,0xfc,0x73,0x3a,0xdd,0x06,0xb4,0x8b,0x69,0x6b,0x6b,0xff,0x14,0xbf,0xb6,0x7b,0x98,0xf7,0x6d,0x6f,0x67,0x7b,0x3a,0xfd,0x7e,0x47,0x64,0xd5,0x60,0x6f,0xe1,0x9c,0x12,0xbe,0x02,0xe7,0x19,0x26,0xa2,0x26,0x75,0xb7,0xdd,0xfa,0x27,0x5c,0x90,0x10,0xf6,0x46,0xb4,0x28,0x56,0xf8,0x4d,0xc2,0xf0,0xd6,0xb4,0xd5,0xda,0x0a,0x80,0x49,0xed,0x5c,0xb6,0x2a,0xcb,0x1d,0x46,0x44,0x4c,0x88,0xde,0x4e,0x46,0x09,0xa7,0x0e,0xfe,0x00,0x7e,0x69,0xd8,0xa2,0x77,0x08,0x70,0x05,0xc0,0x71,0x9a,0x8c,0x2e,0xaa,0xa4,0xb6,0x17,0x3f,0x5e,0x01,0x78,0xe0,0x2e,0xb4,0x19,0x01,0x04,0x4b,0x87,0xd8,0x8a,0xfc,0x84,0xbe,0x07,0xc0,0x19,0x55,0xa0,0x7a,0x88,0x27,0x4a,0x10,0xa5,0x08,0x0e,0xb7,0x24,0xe3,0x06,0x26,0x5b,0xb2,0x0e,0x20,0x0e,0xf5,0x2b,0x57,0x7c,0xa5,0x60,0x00,0x0c,0x0f,0x88,0x53,0x91,0x9c,0x62,0x90,0x40,0x19,0x1e,0x90,0x24,0x06,0x82,0xdc,0x52,0x1f,0xfd,0x18,0x36,0x61,0x3d,0x21,0x37,0x62,0xb3,0x2e,0xf2,0x1e,0xb9,0x8e,0x1f,0xf7,0xde,0x1e,0x9f,0x1d,0xb4,0x83,0xfe,0x28,0x2b,0x68,0xb0,0xde,0x27,0xe2,0x7b,0x5f,0x25,0x0c,0x64,0xca,0xe1,0xde,0x9b,0xcb,0xfd,0xdd,0xf3,0xdd,0xcb,0xdd,0x93,0x43,0xcc,0x49,0xfb,0x9f,0x21,0x63,0x3d,0x68,0x09,0x52,0x9a,0x8c,0xd3,0x60,0x46,0x06,0xa6,0xcf,0xdb,0x38,0xb8,0x4e,0x06,0x34,0x20,0xe3,0x38,0x28,0x6e,0xb2,0xfb,0x80,0xdc,0xc5,0x16,0xf4,0xda,0xf7,0x96,0xe8,0x11,0x27,0xd0,0xba,0x54,0xf8,0x2b,0xe6,0x33,0x09,0x4c,0x69,0x89,0x1c,0x0d,0xc5,0x6f,0x89,0x11,0xc5,0x1e,0xfa,0x6e,0x37,0x21,0x78,0x79,0x9d,0xa6,0x0e,0x9e,0xc6,0x94,0xc0,0xc0,0x11,0x99,0xa1,0x68,0xc4,0x1e,0xb6,0x78,0x80,0x3b,0x09,0xb4,0x09,0x56,0x7d,0x5f,0xb2,0x60,0x27,0xb9,0xd8,0x5d,0x3a,0x08,0x23,0xc0,0xf5,0xa2,0x42,0x4e,0x6f,0xb3,0x3b,0xaa,0x1b,0x12,0x6c,0x50,0x6b,0x90,0x16,0x63,0x67,0x44,0x40,0x80,0x5a,0xb2,0xe0,0x3e,0xac,0x4b,0xe8,0x8c,0x8b,0x24,0xba,0x6f,0x3d,0x57,0x79,0xcc,0x79,0x75,0x94,0x9e,0x09,0x5e,0xb6,0xfc,0xbc,0x0e,0x94,0x70,0x98,0x3f,0xb8,0x52,0x85,0x2c,0x6e,0xe4,0x3f,0xb0,0x30,0xb0,0x76,0x92,0x07,0xc0,0x99,0x17,0xe2,0x54,0xae,0x0f,0xf0,0x94,0x8a,0x91,0xd4,0x96,0xc5,0x33,0x98,0x61,0x4b,0x2e,0xd8,0x75,0x4b,0x40,0x4a,0x64,0x71,0x9e,0x25,0xed,0x05,0xee,0x81,0x8a,0x16,0x9d,0x75,0x2b,0x5b,0x2b,0xf9,0x2c,
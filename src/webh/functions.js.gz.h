@@ -1,5 +1,6 @@
-#define functions_js_gz_len 1167
+#define functions_js_gz_len 1727
+#define functions_js_gz_hash "993e36c7cced7ec9"
 const uint8_t functions_js_gz[] PROGMEM = {
-0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xcd,0x57,0xed,0x6e,0xdb,0x36,0x14,0xfd,0x6d,0x3f,0x05,0xa1,0x15,0xb3,0x34,0x3b,0x92,0xdb,0x15,0xfb,0x31,0xc7,0x2b,0xda,0xe6,0x73,0x48,0xda,0xa2,0x36,0xd6,0x60,0x43,0x11,0x30,0xd2,0x95,0xc4,0x4d,0x22,0x35,0x92,0x8a,0xed,0x15,0x79,0xa0,0x3d,0xc7,0x5e,0x6c,0x97,0x94,0x64,0xc9,0xce,0xe2,0x36,0x40,0x83,0x25,0x08,0x94,0x48,0xbc,0xe7,0xde,0x73,0xce,0xbd,0x94,0xcd,0xb8,0xe4,0xa1,0x66,0x82,0x93,0x04,0xf4,0x45,0x2a,0x5d,0xef,0x53,0xbf,0x77,0x4d,0x25,0x59,0xa6,0x92,0x4c,0x09,0x2f,0xb3,0x6c,0xd2,0xef,0xb1,0xd8,0x5d,0x30,0x1e,0x89,0x85,0x7f,0x71,0x7e,0x76,0xa2,0x75,0xf1,0x1e,0xfe,0x2c,0x41,0x69,0x8f,0x04,0x01,0x39,0x62,0x12,0x62,0xb1,0x24,0xa0,0x09,0x2d,0xb5,0x04,0xd5,0xef,0x11,0xd2,0xe0,0x61,0x41,0x36,0x21,0xae,0x87,0xf9,0x20,0x53,0x40,0xda,0xa4,0x2f,0x91,0xc1,0x35,0x5c,0xbc,0xbd,0xfa,0x1d,0x42,0xed,0x7d,0x32,0x49,0x4f,0xb9,0x06,0xc9,0x31,0xe5,0xe1,0xb2,0xc8,0x84,0x04,0x69,0x93,0x6a,0xb9,0x22,0xc8,0x0f,0x7f,0xda,0xf4,0x1b,0x60,0xd7,0x39,0x57,0xcb,0x3c,0x7b,0x66,0x79,0xce,0xe7,0xef,0x1c,0x53,0xad,0xd7,0xbb,0x21,0x21,0xd5,0x61,0x4a,0x5c,0xf0,0x3e,0x8b,0x67,0xa1,0x14,0x4a,0xc4,0x7a,0x3b,0x45,0xdf,0xfc,0x5a,0xe2,0x96,0xe0,0xa6,0x2a,0xc2,0xd1,0x41,0x55,0x16,0x85,0x90,0xfa,0x9f,0xbf,0x49,0x81,0x06,0x66,0x40,0x38,0xbd,0x66,0x09,0xd5,0x50,0x56,0xec,0x69,0x06,0x12,0x2b,0xfc,0x22,0xd0,0xa4,0xce,0x1a,0xb2,0x68,0xa0,0x80,0x48,0x85,0x48,0x45,0x04,0xd2,0xd1,0x8a,0xd4,0x1c,0xea,0x2a,0xbe,0xef,0x5b,0x36,0x6b,0x7b,0x63,0x8a,0x7c,0x26,0x96,0x99,0x04,0x5d,0x4a,0x6e,0x9e,0x4f,0xfa,0x37,0xfd,0x7e,0xdc,0xb4,0xb5,0x10,0x0b,0x90,0x6e,0x4e,0xc3,0x51,0x98,0x47,0x5e,0x7f,0xa3,0xbb,0x4d,0xcb,0x31,0x03,0x3e,0xf0,0x05,0x97,0x40,0xa3,0x95,0xd2,0x48,0x2b,0x4c,0x29,0x4f,0xc0,0x94,0xa8,0x13,0xd9,0xc1,0x30,0x83,0x60,0x22,0x6d,0xdc,0xcc,0xc4,0x91,0xe9,0x94,0x3c,0x27,0x76,0xad,0x87,0xbc,0x21,0x43,0x13,0x11,0x55,0x05,0xa9,0x42,0x70,0x05,0x73,0x58,0x6a,0x6b,0x61,0x24,0xc2,0x32,0x07,0xae,0x7d,0xac,0x7b,0x98,0x81,0xf9,0xf7,0xd5,0xea,0x34,0x32,0xe4,0x3c,0x9f,0x71,0x0e,0xf2,0x64,0x7e,0x7e,0x36,0x6d,0xd2,0x18,0x4c,0xe5,0xba,0x25,0x57,0x00,0x77,0x9d,0xe3,0xc3,0xb9,0x33,0x72,0x66,0xa0,0xdf,0x19,0x59,0x2f,0x10,0x39,0x75,0x86,0xa0,0x42,0x5a,0x80,0x4d,0x33,0x74,0xbe,0x45,0x99,0xed,0x33,0xa3,0x79,0xa4,0x65,0x09,0x8d,0x46,0x05,0xba,0x36,0xf3,0x04,0x35,0xa0,0x33,0x83,0xd7,0x02,0x47,0x8d,0xeb,0xbd,0xf9,0xaa,0x80,0xc1,0x68,0x40,0x8b,0x22,0x63,0x38,0x2d,0x28,0x39,0x48,0x75,0x9e,0x0d,0x5a,0x24,0x8f,0x8c,0x55,0xe8,0xee,0xda,0xdc,0x63,0xd0,0xc7,0xb3,0x73,0x63,0x44,0xa9,0xdc,0xc7,0x69,0xae,0x93,0xa8,0x5c,0x59,0x82,0xce,0xfd,0x4c,0xee,0x6a,0x73,0x1e,0xd6,0xc3,0x79,0x0a,0x32,0x17,0x86,0xe5,0xe3,0xb6,0x52,0xaf,0x79,0xde,0xdf,0xcb,0x6d,0x8d,0x5f,0xdb,0xd2,0xee,0x9e,0xc7,0x72,0x2f,0x2b,0x33,0xcc,0x9e,0x78,0x94,0x5e,0xee,0xd8,0xf3,0x3d,0x34,0x63,0xce,0x72,0x10,0xa5,0x76,0x3b,0x4c,0xb6,0x54,0x4d,0xc8,0xcd,0x88,0x7c,0x3f,0x1e,0x8f,0xbd,0x9d,0xb6,0x57,0x88,0xdb,0x2f,0x8a,0x07,0x74,0xdf,0x18,0x15,0xb3,0x0c,0x5c,0x73,0x79,0x9c,0xee,0x3b,0x9a,0xe9,0x0c,0x36,0x86,0xd8,0x90,0xdd,0x8d,0x31,0x11,0x9c,0xe6,0x06,0x76,0x4d,0xb3,0x12,0xbe,0x10,0x72,0xcf,0xad,0x62,0x84,0x1e,0x21,0xec,0x85,0xc1,0xb6,0x3d,0xb3,0x5e,0x3e,0x60,0xd3,0x32,0x91,0xbc,0x87,0x18,0x0d,0x4c,0xdd,0x5c,0x3d,0xd2,0xa6,0x85,0x18,0x26,0xb2,0xd6,0xff,0x2f,0xd9,0x34,0x1d,0x5d,0xd5,0x96,0x41,0x75,0x77,0x9b,0x8f,0x15,0xcf,0x44,0xf2,0xaa,0x8c,0x63,0x90,0x0f,0xf9,0x82,0xc2,0x9e,0xf2,0x37,0xa0,0x17,0x42,0xfe,0xb1,0xe3,0x5d,0x7f,0xa7,0x11,0xbc,0x82,0x6e,0x7e,0xa2,0x39,0xfb,0x2c,0x4f,0x88,0x92,0xe1,0x74,0x10,0xe0,0x7f,0xc1,0x82,0x32,0x44,0xb2,0x78,0xf0,0x93,0xf3,0x7f,0x37,0xee,0x3f,0xf9,0x7e,0x7e,0x2b,0x74,0x5c,0x7a,0xc8,0x66,0x94,0x45,0x84,0x42,0x67,0xb3,0xd3,0x03,0x17,0xe7,0xca,0xb6,0xe3,0x4e,0x25,0x4a,0xb1,0x68,0x3d,0x7f,0x78,0xdd,0xcc,0x84,0xdf,0xb6,0x9a,0x14,0xbb,0xf6,0x4f,0x47,0x22,0x22,0x9c,0x21,0x42,0xbe,0xbe,0xbc,0x96,0x95,0x19,0x6a,0x14,0xa8,0x30,0x69,0x06,0x54,0xc1,0x29,0x8f,0x85,0x6b,0xcf,0x01,0x4f,0x8c,0xbe,0x9f,0x67,0x6f,0xdf,0xb8,0x4e,0x8a,0xdf,0xe5,0xd5,0x8f,0x41,0x40,0x0b,0x86,0x43,0xa3,0xd3,0xf2,0xca,0x0f,0x45,0x1e,0x48,0x28,0x84,0x0a,0x96,0xab,0xbf,0xa4,0x80,0xe0,0x57,0x96,0xe0,0x4c,0xc8,0xe3,0x0f,0x7b,0x47,0x1f,0x70,0xc5,0x26,0x53,0x41,0x66,0x73,0xa3,0x29,0x91,0xe0,0xd0,0xee,0xbd,0x7a,0xdd,0xd6,0x21,0xc4,0x98,0x41,0x15,0x0a,0x43,0x3b,0xea,0x15,0xdf,0xde,0xab,0xdf,0xc6,0x1f,0x27,0x4d,0x04,0x9e,0x85,0x78,0x26,0x68,0xf4,0x5a,0x94,0xdc,0x44,0x8e,0xed,0x4a,0x2c,0x24,0x71,0xcd,0x32,0xb3,0x8f,0xf0,0xcf,0xfe,0x56,0x0e,0x1f,0x5f,0xcc,0x89,0x4e,0x71,0x69,0x38,0xac,0x0e,0x38,0x9b,0x99,0x86,0xb7,0x8a,0xb2,0x8f,0x7e,0x13,0x72,0x19,0x9a,0x18,0x5b,0xe9,0xa6,0x21,0x82,0x4a,0x4e,0x44,0x69,0x7a,0xf7,0xc3,0x98,0x7c,0x57,0x5d,0x9e,0xe2,0x67,0xed,0xa4,0x13,0x70,0x40,0x57,0xb8,0xfe,0xec,0x39,0x2e,0xd5,0xe1,0xad,0x0e,0xb4,0xe4,0x80,0xc5,0x71,0x7d,0xc2,0x3a,0xc0,0x5b,0x34,0x7c,0xaf,0xbd,0x69,0xd8,0x14,0xe5,0x55,0xc6,0x54,0x0a,0xd1,0x25,0xd5,0xde,0x1a,0xae,0xf1,0x3d,0xf6,0x32,0x11,0xf6,0x9e,0xc5,0xc4,0x5d,0xa7,0xdb,0xaf,0xeb,0x56,0x1a,0xeb,0x30,0x2c,0xd2,0x46,0x04,0x0d,0x17,0xcf,0xd7,0xe2,0x88,
-0x2d,0x21,0x72,0x9f,0x7a,0x64,0x48,0x1c,0x92,0xe2,0x43,0x45,0x68,0x22,0x9c,0x4a,0x2a,0xa9,0x8e,0x72,0xbb,0xf2,0x98,0x4a,0xdb,0x69,0x22,0xba,0xea,0x66,0xe9,0x37,0x9c,0x65,0x3b,0x5b,0x9d,0x16,0x9b,0x8f,0x4b,0x0b,0x5b,0xe0,0xb1,0xae,0xda,0x67,0x11,0xde,0x0d,0x1b,0x89,0x76,0x8d,0xf2,0x68,0xdd,0xf9,0x7a,0x79,0xa3,0x7d,0x48,0xe1,0x4c,0x84,0x78,0x78,0x9c,0x69,0xc9,0x78,0xe2,0x56,0x44,0x4c,0x06,0xe5,0x57,0x34,0x9e,0xb8,0xce,0x37,0x0d,0xa4,0xaa,0x82,0xe3,0x48,0xb5,0x96,0x38,0xd7,0x78,0x36,0x77,0x46,0xd5,0xec,0xf9,0x57,0x52,0x2c,0x14,0xc8,0xcb,0x75,0xeb,0x4b,0x99,0x79,0xeb,0x0c,0x35,0xe9,0x14,0xf7,0x1c,0xc2,0x35,0xbe,0xd5,0xdc,0x8e,0xaa,0x5b,0x71,0x57,0x22,0x5a,0x6d,0xc5,0xf9,0xe6,0xd9,0xad,0x40,0x86,0x68,0x0c,0x8c,0x51,0xdd,0x29,0x6e,0x7c,0x95,0x89,0x85,0x3d,0xc5,0xde,0xe0,0xc5,0x58,0xf8,0x2f,0xa1,0xce,0x7e,0xd6,0x82,0x10,0x00,0x00
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xd5,0x58,0xeb,0x72,0x13,0x37,0x14,0xfe,0x6d,0x3f,0x85,0xd8,0x76,0xc8,0xba,0xb1,0xd7,0x09,0xb7,0x1f,0x84,0x90,0x01,0x12,0x20,0x9d,0x84,0x30,0x38,0x53,0x98,0xb6,0x0c,0x23,0xef,0x6a,0xed,0x2d,0xbb,0xd2,0x22,0x69,0xe3,0xb8,0x90,0x07,0xea,0x73,0xf4,0xc5,0xfa,0x49,0xda,0xab,0x4d,0x42,0x99,0x21,0x53,0xca,0x30,0x4e,0xac,0x73,0xfb,0xce,0x77,0x8e,0xa4,0xa3,0xc4,0x05,0x0f,0x75,0x22,0x38,0x99,0x31,0xfd,0x66,0x2e,0xfd,0xc1,0xc7,0x7e,0xef,0x8c,0x4a,0x72,0x3e,0x97,0x64,0x97,0xf0,0x22,0x4d,0x77,0xfa,0xbd,0x24,0xf6,0x17,0x09,0x8f,0xc4,0x22,0x78,0x73,0x7c,0xf4,0x5c,0xeb,0xfc,0x15,0xfb,0x50,0x30,0xa5,0x07,0x64,0x3c,0x26,0x4f,0x13,0xc9,0x62,0x71,0x4e,0x98,0x26,0xb4,0xd0,0x92,0xa9,0x7e,0x8f,0x90,0xca,0x9e,0x2d,0x48,0xd7,0xc4,0x1f,0xc0,0x1f,0x4b,0x15,0x23,0x8d,0xd3,0x47,0x40,0x70,0xc6,0xde,0x9c,0x4c,0xff,0x60,0xa1,0x1e,0x7c,0x34,0x4e,0x0f,0xb9,0x66,0x92,0xc3,0xe5,0xc1,0x79,0x9e,0x0a,0xc9,0xa4,0x75,0xaa,0xe5,0x92,0x00,0x1f,0xfe,0x35,0xee,0x3b,0xc6,0xbe,0x77,0xac,0xce,0xb3,0xf4,0x96,0xc5,0x79,0x7a,0xfa,0xd2,0x33,0xd1,0x7a,0xbd,0x0b,0x12,0x52,0x1d,0xce,0x89,0xcf,0x06,0x5f,0xb4,0x4f,0x42,0x29,0x94,0x88,0xf5,0xaa,0x8b,0xbe,0xf9,0x6f,0x81,0x5b,0x80,0xdd,0xac,0x08,0x07,0x83,0xaa,0xc8,0x73,0x21,0xf5,0xdf,0x7f,0x91,0x1c,0x04,0xa6,0x8c,0x70,0x7a,0x96,0xcc,0xa8,0x66,0x85,0x43,0x4f,0x53,0x26,0x11,0xe1,0x17,0x01,0x92,0x5a,0x32,0xa0,0xa8,0x4c,0x19,0x2c,0x15,0x2c,0x15,0x11,0x80,0xa3,0x15,0x29,0x31,0x94,0x51,0x82,0x20,0xb0,0x68,0x6a,0x7a,0x63,0x0a,0x3c,0x3b,0x16,0x99,0x64,0xba,0x90,0xdc,0xac,0xef,0xf4,0x2f,0xfa,0xfd,0xb8,0x2a,0x6b,0x2e,0x16,0x4c,0xfa,0x19,0x0d,0x87,0x61,0x16,0x0d,0xfa,0x9d,0xea,0x56,0x25,0x87,0x07,0x2c,0x04,0x82,0x4b,0x46,0xa3,0xa5,0xd2,0x80,0x15,0xce,0x29,0x9f,0x31,0x13,0xa2,0x74,0x64,0x1b,0xc3,0x34,0x82,0xd1,0xb4,0x7a,0x13,0xa3,0x47,0x76,0x77,0xc9,0x1d,0x62,0x65,0x3d,0xe0,0x66,0x29,0x48,0x84,0x95,0x53,0x52,0xb9,0xe0,0x8a,0x9d,0xb2,0x73,0x6d,0x29,0x8c,0x44,0x58,0x64,0x8c,0xeb,0x00,0x71,0x0f,0x52,0x66,0x7e,0x7d,0xbc,0x3c,0x8c,0x0c,0xb8,0x41,0x90,0x70,0xce,0xe4,0xf3,0xd3,0xe3,0xa3,0xdd,0xca,0x8d,0xb1,0x71,0xac,0x5b,0x70,0x39,0xe3,0xbe,0xf7,0xec,0xe0,0xd4,0x1b,0x7a,0x13,0xa6,0x5f,0x9a,0xb4,0xf6,0x60,0xb9,0xeb,0x6d,0x32,0x15,0xd2,0x9c,0x59,0x37,0x9b,0xde,0x4d,0xa4,0xd9,0xac,0x99,0x9c,0x87,0x5a,0x16,0xac,0xca,0x51,0x31,0x5d,0x92,0xf9,0x1c,0x39,0x80,0x99,0x8d,0x27,0x02,0xad,0xc6,0xf5,0xe8,0x74,0x99,0xb3,0x8d,0xe1,0x06,0xcd,0xf3,0x34,0x41,0xb7,0x20,0xe5,0xf1,0x5c,0x67,0xe9,0x46,0x63,0xc9,0x23,0x43,0x15,0xd8,0xad,0xc9,0x7d,0xc6,0xf4,0xb3,0xc9,0xb1,0x21,0xa2,0x50,0xfe,0xf7,0x49,0xae,0x37,0x53,0x99,0xb2,0x00,0xbd,0xaf,0x23,0xb9,0x9d,0x9b,0x77,0xbd,0x1c,0x9e,0xce,0x99,0xcc,0x84,0x41,0xf9,0x7d,0x53,0xa9,0x6b,0x9c,0x5f,0xcf,0xe5,0x6a,0x8e,0xdf,0x9a,0xd2,0xf6,0x9e,0x47,0xb8,0x47,0x8e,0x0c,0xb3,0x27,0xfe,0x6f,0x7b,0xbe,0x07,0x32,0x4e,0x93,0x8c,0x89,0x42,0xfb,0x2d,0x24,0x2b,0x59,0xed,0x90,0x8b,0x21,0xb9,0xbd,0xb5,0xb5,0x35,0xb8,0x92,0x76,0x67,0xb1,0x7e,0x50,0x5c,0x23,0xfb,0x86,0xa8,0x38,0x49,0x99,0x6f,0x3e,0xbe,0xd7,0x4e,0x4e,0x74,0xca,0x3a,0x4d,0x6c,0xc0,0x5e,0x6d,0x63,0x34,0x38,0xcd,0x8c,0xd9,0x19,0x4d,0x0b,0xf6,0x2f,0x4d,0xbe,0x72,0xab,0x98,0x44,0x9f,0xc2,0x6c,0xcf,0xd8,0x36,0x35,0xb3,0x5c,0x7e,0xfb,0xa2,0x99,0xca,0xa4,0x62,0x36,0x61,0x1f,0xea,0x61,0xa7,0x5c,0xda,0x67,0xa1,0x88,0x58,0xd4,0x5c,0xb2,0xe5,0xfa,0xc1,0x19,0x42,0xa8,0x5a,0xbb,0x29,0x3b,0x64,0x8f,0xf2,0xdc,0xb8,0xd6,0xa0,0x7f,0x88,0x36,0xc8,0x53,0x1a,0x36,0x0d,0x40,0x91,0x19,0xcc,0x2e,0xe5,0x2a,0x44,0xe5,0x84,0xa1,0x0b,0x28,0x8d,0xae,0x23,0x19,0x16,0xa5,0x23,0xb2,0x47,0x8c,0x63,0x72,0x9f,0xb4,0xa4,0x9b,0x76,0xcd,0x4d,0x68,0xcd,0x72,0x80,0x42,0xcd,0xf4,0x9c,0x3c,0x24,0xf7,0xee,0xde,0xbd,0x7d,0xcf,0xf6,0x4a,0xc7,0x65,0x4b,0x55,0x15,0x53,0xa5,0x65,0xdb,0x18,0x33,0x19,0x3b,0x3f,0x89,0x7d,0xef,0x77,0xee,0x0d,0xc9,0xba,0xd7,0x51,0xe9,0x15,0xc1,0xb7,0x07,0x76,0xf8,0x00,0x91,0x98,0x88,0xf2,0x42,0xcd,0x41,0xd8,0x74,0x49,0x70,0x4e,0x12,0x33,0xdb,0x2c,0xe8,0x72,0x88,0x01,0x24,0x4d,0x13,0x3e,0xc3,0xb8,0x67,0xd7,0xa7,0x52,0x2c,0x14,0x93,0x44,0xc8,0xb6,0x1a,0xe6,0x33,0xbe,0xa1,0x3b,0x64,0x4e,0x30,0x25,0xd1,0xcc,0xcf,0x94,0x65,0x10,0xf9,0xdd,0x28,0xa7,0x45,0x5b,0x81,0x89,0x28,0x24,0xc8,0x35,0x99,0x41,0xf7,0x15,0x8b,0xd1,0xfb,0x73,0xa3,0x6c,0x3a,0xcb,0xcd,0x42,0x6e,0x2e,0x32,0xd4,0xb3,0xba,0x66,0x98,0xf7,0x5a,0xe6,0xbe,0xe7,0x24,0x7b,0x91,0x2d,0xf6,0xae,0x87,0x94,0xfc,0x56,0xed,0xf7,0xc8,0x36,0xe8,0xde,0x1a,0x94,0xcb,0xb6,0x4b,0x5c,0xe1,0x21,0xf2,0x3c,0xc8,0xbc,0x9b,0x8a,0x7d,0xb0,0x76,0x4e,0x3e,0x30,0xf1,0xdb,0x5d,0xe2,0x02,0x98,0x91,0xd7,0xfe,0x12,0x64,0x66,0x31,0x6b,0x2d,0x08,0x9e,0x31,0xa5,0x68,0x77,0xe7,0xd7,0x89,0xb9,0xc6,0x04,0xf5,0x54,0x69,0xeb,0xf3,0x30,0xda,0x71,0x92,0xb2,0xd7,0x58,0x10,0x51,0x4d,0x11,0xdf,0x55,0xcb,0xf6,0xaa,0x2d,0x4a,0x13,0x81,0x46,0x91,0x35,0x3d,0x4a,0x14,0xb6,0x07,0x36,0x8a,0x97,0xe2,0x1e,0x32,0xca,0x5f,0x1f,0xce,0x1b,0x8d,0x08,0xaa,0x89,0x01,0xd5,0xf8,0x20,0xa3,0xd1,0x4a,0xd4,0x41,0x3b,0x31,0x26,0xa5,0x90,0xeb,0x69,0xa1,0x94,0xa5,0x4a,0xf7,0x50,0x6b,0x15,0x26,0x78,0x72,0x74,0x32,0x39,0xd8,0x27,0x37,0x6f,0xb6,0xb7,
+0x5c,0xc5,0x66,0x79,0xf6,0xad,0xed,0xc5,0xde,0xe7,0x7a,0xe1,0xc2,0x72,0xe1,0x3a,0xd4,0x94,0xdf,0xa1,0x0f,0x45,0xc6,0x48,0x54,0x96,0x39,0x96,0x22,0xc3,0x00,0xbf,0x20,0x82,0x77,0x3a,0xd0,0xb5,0x81,0x2f,0xb8,0xed,0xc0,0xce,0x99,0x20,0xb8,0xdb,0x73,0x35,0x88,0x8a,0x41,0xf7,0x2d,0x08,0x41,0x0f,0xb3,0xc7,0x7c,0xaf,0x69,0xe5,0x46,0xec,0xb0,0x5d,0x74,0xae,0x8d,0x2e,0xf4,0x6b,0xbd,0x36,0x4a,0xa1,0x1b,0x0b,0x8d,0xe0,0x16,0xae,0x51,0xf7,0x2e,0x02,0x4b,0x82,0xa7,0xcb,0x55,0xaa,0xa6,0x34,0x7c,0x3f,0x24,0x05,0xc7,0xf9,0xad,0x88,0x32,0x2b,0x18,0xbf,0x99,0x6b,0x82,0x84,0x93,0x29,0xd3,0x0b,0xc6,0xb8,0xf5,0xe0,0x58,0x69,0xef,0x95,0x4f,0x9f,0xec,0xed,0x34,0x33,0x07,0xb6,0xbb,0xa0,0xca,0x13,0xdb,0x7b,0x33,0x3a,0x12,0xb3,0xd1,0xc9,0x19,0x3a,0xa5,0xe0,0xde,0xa0,0xc4,0xd0,0xea,0xb7,0xcb,0xb6,0xdd,0x67,0xda,0xd0,0xec,0xd2,0xd5,0x4b,0x70,0x48,0xaa,0x1b,0xc3,0xbc,0xe0,0xcc,0xe3,0x6d,0x2d,0xc2,0xba,0x49,0xdd,0xcd,0xee,0xd5,0x57,0x7e,0x94,0x9c,0x5d,0x9a,0x04,0x50,0x02,0xc2,0x0d,0x87,0xb3,0x4c,0xa4,0xde,0x51,0x5f,0xb6,0xdc,0xa9,0x03,0x5d,0x32,0xfd,0xac,0x74,0xb6,0x99,0x7e,0x5a,0x1d,0xbe,0x7e,0x8f,0x22,0x1c,0x9c,0x3f,0x2e,0xe2,0x18,0xef,0xa4,0x6f,0x77,0xbe,0x5d,0xe3,0xdc,0x84,0x8b,0x9e,0xbf,0x40,0x23,0x09,0xf9,0xfe,0x8a,0x07,0xc0,0xa5,0xf7,0x27,0x77,0xa6,0xdd,0x67,0x8e,0xf7,0x20,0xc9,0x66,0x44,0xc9,0x70,0x77,0x63,0x8c,0xdf,0xc6,0x0b,0x9a,0xc0,0x32,0x89,0x37,0x1e,0x7a,0xff,0xf5,0x08,0xf6,0x59,0xbc,0x5f,0x9e,0x8f,0x5a,0x2c,0x5d,0xe7,0x13,0xa2,0xc8,0x71,0xaf,0xb0,0xc9,0xe4,0x70,0xdf,0xc7,0xe5,0x6f,0xcb,0x71,0x69,0x26,0x4a,0x25,0x51,0x3d,0x14,0xe2,0xb3,0xeb,0x09,0x4f,0xf0,0xca,0xc5,0x55,0x47,0x5a,0x2b,0x45,0x58,0x78,0x9b,0x30,0xf9,0xf6,0xe9,0x35,0xa8,0xcc,0xf6,0x40,0x82,0x0a,0x4e,0x53,0x46,0x15,0x3b,0xe4,0xb1,0xf0,0xed,0x1f,0x87,0x7e,0x34,0xf9,0xfd,0x3c,0x39,0x79,0xe1,0x7b,0x73,0xad,0x73,0x75,0x7f,0x3c,0xa6,0x79,0x82,0xa6,0xd1,0xf3,0x62,0x1a,0xe0,0x34,0x1c,0x63,0x20,0x13,0x6a,0x7c,0xbe,0xfc,0x53,0x0a,0x36,0xfe,0x35,0xc1,0xf1,0x4e,0xe5,0xb3,0xd7,0xa3,0xa7,0xaf,0x21,0xb1,0xce,0xd4,0x38,0xb5,0xbe,0x41,0x4a,0x84,0x6b,0xb0,0xd9,0xc7,0xa5,0xdc,0xc6,0x21,0xc4,0x4e,0x85,0x0a,0x89,0xd9,0x21,0xcf,0x4a,0x02,0xfb,0x5d,0xfd,0xb6,0xf5,0x76,0xa7,0xd2,0xc0,0xc8,0xc3,0x53,0x41,0xa3,0x27,0xa2,0xe0,0x46,0x73,0xcb,0x4a,0x62,0xdc,0xac,0xbe,0x11,0x27,0x76,0x09,0x3f,0x1e,0xac,0xf8,0x28,0xc7,0x35,0x88,0x36,0x37,0xdd,0x5f,0xbd,0xba,0x9e,0x36,0xd7,0x82,0x26,0x6f,0x83,0x4a,0xe5,0x5d,0x68,0x74,0x6c,0xa4,0x8b,0x0a,0x08,0x32,0x79,0x8e,0xdb,0x19,0xf1,0xee,0x6d,0x91,0x9f,0xdc,0xc7,0x36,0x1e,0x60,0x3b,0x2d,0x85,0x7d,0x8c,0x72,0xb8,0x4e,0xee,0x40,0x54,0xaa,0x37,0x79,0x80,0x92,0xfd,0x24,0x8e,0xcb,0x31,0x6c,0x1f,0x5f,0x41,0xf8,0xa8,0xf9,0x52,0xa1,0xc9,0x8b,0x69,0x9a,0x98,0x51,0xf2,0x1d,0xd5,0x83,0xda,0x5c,0xe3,0x4c,0x7c,0x34,0x13,0xf6,0x3b,0x46,0x49,0xbf,0x76,0xf7,0xa0,0x8c,0xeb,0x72,0x2c,0xd5,0x10,0xa4,0xd1,0x18,0x57,0x58,0x06,0x81,0x16,0x4f,0x93,0x73,0x16,0xf9,0xdb,0xe6,0xcc,0xf3,0xc8,0x1c,0x8b,0x8a,0xd0,0x99,0xf0,0x5c,0xaa,0xc4,0xfd,0x7d,0xef,0x2a,0x3f,0x26,0xd2,0xaa,0x9b,0x88,0x2e,0xdb,0x5e,0xfa,0x15,0x66,0xd9,0xf4,0x56,0xab,0xc4,0xe6,0x0d,0x65,0xcd,0x16,0x54,0x95,0xfb,0x2c,0x22,0xe6,0x88,0xad,0x62,0x1a,0x19,0xe5,0x51,0x5d,0xf9,0x52,0xdc,0x29,0x1f,0x20,0x1c,0x89,0x90,0xa6,0x0c,0xb3,0x05,0xa6,0x6b,0xdf,0x01,0x31,0x1e,0x54,0xe0,0x60,0xfc,0xe8,0x7b,0x3f,0x54,0x26,0x2e,0x0a,0xda,0x91,0x6a,0xcc,0xfa,0xde,0x5c,0xb2,0xd8,0x8c,0xf6,0xa6,0xec,0x41,0x39,0x90,0xbf,0xab,0x4b,0x5f,0xc8,0x74,0x50,0x7b,0x28,0x41,0xcf,0xb1,0xe7,0x60,0x6e,0x1e,0x1b,0x7e,0x2b,0xab,0x35,0xbd,0xa9,0x88,0x96,0x2b,0x7a,0x81,0x59,0x5b,0x53,0x4c,0x60,0x0d,0xc5,0x18,0xd9,0x1d,0x62,0xe3,0xab,0x54,0x2c,0xbc,0x6a,0x82,0x34,0x14,0xfe,0x03,0x04,0x09,0xc9,0x63,0x97,0x16,0x00,0x00
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 #define glyphicons_woff_gz_len 23188
+#define glyphicons_woff_gz_hash "8de85c5181611420"
 const uint8_t glyphicons_woff_gz[] PROGMEM = {
 0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x64,0x75,0x73,0x70,0x25,0x4e,0xb0,0x75,0xbc,0xb1,0x6d,0x6b,0xe3,0x8d,0x6d,0x67,0x63,0x63,0x63,0xdb,0xb6,0xad,0x8d,0x6d,0xdb,0xde,0xd8,0xbc,0xb1,0x36,0x4e,0x6e,0x6c,0xe7,0xbe,0xfd,0xbd,0xf7,0xfd,0xf7,0x4d,0xd5,0xa9,0x9e,0x3e,0xd3,0x33,0xa7,0x7b,0xaa,0xa6,0xc7,0x43,0x51,0x52,0x12,0x0c,0x1c,0xec,0xdf,0xd0,0x0d,0x04,0x43,0xf9,0xcf,0x36,0xea,0xfd,0x9f,0xff,0xff,0x0f,0x49,0x49,0x35,0x05,0x30,0x30,0x70,0xad,0x7f,0x53,0xc2,0xff,0x60,0x47,0x9f,0xbe,0x25,0x25,0x2e,0x21,0xf9,0x8f,0x73,0xfd,0xe7,0x93,0xfc,0x03,0x29,0xb8,0x38,0x18,0x94,0xa2,0x2a,0x33,0xdb,0x3f,0x2e,0xf5,0x9f,0x2f,0xf1,0x0f,0x86,0x16,0x9d,0x36,0x51,0x26,0x76,0x46,0x8e,0xff,0xb8,0x2d,0x30,0x30,0x88,0x01,0x30,0x30,0x18,0xe7,0x8d,0xda,0x83,0x20,0x13,0x77,0x57,0x52,0x30,0x30,0xa8,0x9c,0x7f,0x31,0x50,0xff,0x0b,0x5a,0x88,0x17,0x0b,0x23,0x97,0x7f,0x71,0x50,0x05,0xff,0x7c,0xd8,0xff,0x00,0x02,0x81,0x41,0x5a,0xd8,0x7a,0x99,0xff,0xe3,0x2a,0xc0,0xc0,0x14,0x70,0xc0,0xc0,0x52,0x4b,0xfc,0xf4,0x07,0x1d,0x2c,0xcd,0x8c,0x4c,0xc1,0xc0,0x94,0xff,0x9d,0x05,0xc6,0xfe,0x0f,0x9c,0xd0,0x0a,0xcc,0x6b,0x96,0xff,0xc8,0x7f,0xdc,0xc3,0xff,0xcb,0x8f,0x12,0x5e,0x1c,0x0a,0xcd,0xd2,0xce,0xd5,0x13,0x0c,0x4c,0x05,0xf5,0x9f,0xb6,0x22,0x18,0x18,0xa4,0xeb,0xe2,0x18,0xa9,0xa1,0xad,0x83,0xc9,0xbf,0x38,0x55,0xc3,0x7f,0xb9,0xd0,0xfc,0x03,0x8b,0xc3,0xfb,0xef,0x59,0x3b,0x23,0xcf,0x7f,0xba,0xea,0x91,0xff,0xd5,0xf0,0xbf,0x75,0x58,0x83,0xad,0xd9,0x1b,0xd9,0x99,0xfd,0xe3,0xfe,0xe9,0x82,0xe7,0xfd,0xdb,0x5b,0xd4,0xcc,0x50,0x90,0xed,0xe8,0xe0,0xf2,0xaf,0x56,0x4d,0xe9,0x7f,0xf9,0x30,0x82,0x81,0xc1,0x2f,0x74,0x15,0x1f,0x71,0x78,0x98,0x19,0xff,0xcb,0x4f,0xf7,0x9f,0x0e,0x18,0xcc,0x7f,0x18,0xc2,0x55,0x53,0xfa,0x67,0xff,0xf7,0x16,0xa7,0x05,0x8a,0xe6,0xfe,0xb3,0xf3,0xee,0x41,0x6e,0xff,0x67,0x5d,0xd2,0x3d,0x37,0x4c,0x0c,0x4d,0x0d,0x0d,0xff,0x42,0x1a,0xc3,0xc1,0xa0,0x1a,0x1a,0xff,0x9b,0x9b,0x62,0x42,0x26,0x33,0x18,0x12,0x43,0x82,0x41,0x4b,0x83,0xc9,0x82,0xfd,0xb7,0x6e,0x7e,0x66,0x9e,0x33,0x30,0x30,0x39,0x30,0x38,0x3d,0xe4,0x1a,0x14,0x14,0x44,0x06,0x2f,0xfa,0x83,0xc9,0x88,0xc5,0x78,0x03,0xfc,0x10,0xb2,0x14,0x35,0x10,0x2e,0x8a,0x08,0x48,0x74,0x35,0xf6,0x77,0xa0,0xe0,0x06,0x24,0x74,0x1f,0x04,0x82,0x10,0x76,0x23,0x47,0x5c,0x16,0x36,0x92,0xa4,0xa4,0x82,0x47,0x8c,0x05,0x63,0x4d,0x43,0x40,0xfc,0xa7,0xe5,0xb9,0x71,0x99,0x2a,0x64,0xa9,0x2a,0x42,0x38,0x16,0x90,0x5e,0x62,0xa5,0x3a,0x3c,0xfa,0x15,0x15,0x67,0xb7,0xdb,0xcb,0xce,0xde,0x58,0x3b,0xcf,0x80,0xec,0x34,0xa9,0x24,0x17,0x42,0xea,0xb4,0x88,0xb8,0xa8,0x25,0x81,0xaf,0xdf,0x44,0x0b,0x85,0xc9,0x06,0x07,0x1e,0xc1,0x54,0x0a,0xa8,0x0c,0xd1,0x6f,0x09,0x26,0x25,0x47,0x96,0x20,0xcc,0x11,0x6f,0x87,0xaf,0x2d,0xed,0xdc,0xb5,0xd2,0x17,0x07,0x14,0xea,0xc8,0x3e,0xbe,0xf6,0xea,0xc1,0xa0,0xb5,0x76,0x71,0xbf,0xfe,0x4d,0x99,0xbb,0xee,0xf5,0xb8,0xbe,0xca,0xf6,0xe8,0x0f,0x8d,0xcc,0x8a,0x1c,0x47,0x41,0x0e,0xd2,0x20,0x6f,0x94,0x84,0xc0,0x82,0x2e,0x73,0x54,0x07,0xd4,0xbf,0x13,0xac,0x42,0xee,0x33,0xcd,0x96,0xd3,0x86,0x58,0x20,0x27,0xcb,0x0d,0xb1,0x2b,0x22,0xd8,0x57,0xf3,0xed,0xff,0xec,0x88,0xb9,0x52,0x09,0xf0,0xe9,0xb1,0x30,0xa4,0x21,0x43,0xdf,0x9c,0x50,0x6a,0x52,0x78,0x55,0x97,0x96,0x58,0x2e,0x90,0xad,0xae,0x99,0xac,0x0e,0xa6,0xaf,0x6a,0xaa,0xaa,0xd2,0x46,0x76,0x4a,0xfd,0xc6,0x33,0x63,0x92,0x73,0xc4,0x8f,0xd3,0x39,0xad,0x9e,0xb7,0xc7,0x43,0x04,0x20,0x23,0x5a,0x50,0x26,0x5a,0x92,0xc9,0x5d,0xd1,0xce,0x5d,0x0d,0x63,0x9c,0xbb,0x6f,0x28,0x92,0x13,0x7b,0xfc,0x7d,0x8a,0xf3,0x1d,0x6e,0xb9,0x64,0x70,0x52,0x9d,0xee,0xb7,0x32,0x4f,0x0d,0x7b,0xa5,0x6c,0x55,0x51,0x99,0xb6,0x63,0x86,0xfe,0x4f,0xa7,0xf0,0x31,0x9e,0x31,0x68,0x26,0xa7,0xb0,0x72,0x2f,0x0d,0x0c,0x0d,0xf8,0x73,0xfb,0x1a,0xcc,0x55,0xba,0xdc,0x05,0x9e,0xee,0xe4,0xe7,0x49,0xdd,0xc7,0x59,0x9f,0x94,0xaa,0xd2,0xa7,0x2e,0xf7,0x7e,0x8d,0x9a,0xa3,0xd5,0xec,0x95,0xbe,0x9a,0xa7,0x5a,0x49,0x4d,0xe3,0xef,0x44,0xdf,0x7d,0xb6,0x05,0xdb,0x57,0xe3,0x3a,0x8c,0x7c,0x0f,0x02,0x3f,0xe8,0xdb,0x0f,0x2d,0x5e,0x95,0xfb,0x7e,0x13,0xdc,0x45,0xf7,0x30,0xc8,0xdd,0x05,0xf3,0xd3,0xcc,0x4d,0x2e,0xdd,0x95,0xf0,0x93,0x25,0x4c,0x14,0x3b,0x03,0xb4,0x3d,0x56,0x72,0x70,0x66,0x9b,0xee,0xb7,0xbc,0x8e,0xf9,0x9d,0x88,0x79,0x50,0x72,0x7d,0x18,0xf5,0x9f,0x2e,0xbf,0x52,0x4c,0x12,0x5e,0x6f,0xf4,0x1d,0x72,0x88,0xea,0xfa,0x65,0x62,0xd6,0xaf,0xc9,0x58,0x6c,0x39,0xf1,0xa7,0xb9,0x60,0x83,0xc3,0x60,0x66,0xe2,0xf6,0xd6,0x7c,0xac,0x83,0xa4,0x18,0x00,0xe0,0x8a,0x5a,0x15,0x18,0x06,0x2d,0x4a,0x38,0x3d,0xa6,0x85,0xb0,0xca,0x01,0xdd,0x61,0x4f,0x18,0x23,0x3e,0x0c,0x00,0x05,0xf6,0x06,0x93,0x42,0x5a,0x65,0x51,0xad,0x53,0xb0,0x1e,0x3b,0xb2,0x58,0xb9,0x70,0x06,0x00,0x42,0xbb,0x76,0x45,0x82,0xb4,0x51,0x0d,0xdb,0x3a,0x11,0xae,0x5f,0xf5,0x74,0x06,0x2e,0x21,0x4c,0x46,0x02,0x3a,0x8b,0x68,0xb5,0x08,0x80,0x6e,0x2d,0x51,0xd2,0x0f,0x6a,0x36,0x90,0x01,0xa8,0xcc,0xfd,0xed,0xae,0x22,0x61,0x08,0x1a,0x21,0x37,0x98,0x46,0x04,0x8d,0xe3,0xaa,0x12,0x9d,0xb6,0x58,0x10,0x52,0x53,0x18,0xeb,0x51,0xc2,0x13,0x7f,0xba,0xa8,0x4f,0x7c,0x78,0x7c,0x88,0x7a,0x48,0x1d,0x17,0x6f,0xcd,0xb4,0x03,0x86,0x02,0x32,0x1b,0x11,0x77,0x6a,0x7c,0x80,0x7a,0x08,0x09,0x17,0xcf,0x13,0xf1,0x51,0xc1,0x93,0x30,
 0x83,0xbf,0xdd,0xe8,0xd0,0x28,0xe5,0x04,0x39,0x96,0xc1,0x96,0x8d,0x3f,0x30,0x29,0x48,0x21,0x7c,0x8c,0x85,0xad,0x61,0xe2,0x06,0x93,0xf3,0x7e,0xb6,0xc0,0x20,0x3c,0x29,0xec,0x44,0xa9,0x9f,0x72,0x31,0x91,0xd3,0xa7,0x03,0x39,0x82,0xa1,0x05,0x9c,0x22,0x7b,0x34,0x6f,0x9e,0x00,0xd7,0xa7,0x40,0x61,0xd6,0xc3,0x71,0x5a,0xf4,0x7a,0x8f,0x5b,0xba,0xe8,0x0b,0x8c,0xa2,0x99,0x33,0x93,0xcb,0xc8,0x74,0x85,0x9a,0xc6,0x3f,0x0a,0x9f,0x87,0xc3,0x19,0xfe,0x87,0xc7,0x1f,0xf2,0x79,0x14,0xdd,0x3c,0x09,0xd7,0xe4,0xb5,0x2d,0xcd,0x08,0x28,0xde,0xcf,0xa5,0x5a,0x5e,0x4a,0x72,0xcc,0x87,0x4c,0x41,0xb6,0x19,0x90,0x09,0x08,0xe1,0x8e,0x83,0x7e,0x97,0xe9,0xd3,0x36,0xff,0x01,0x74,0xf8,0xb3,0xe0,0x8b,0xf9,0x09,0xf4,0xf2,0x65,0xf9,0x15,0xd3,0xf8,0x47,0x5f,0xca,0xf5,0xf3,0x4c,0xed,0x34,0x68,0x97,0x78,0x17,0x2c,0x61,0x01,0x05,0xf7,0xbf,0x7e,0xf0,0xdf,0x3b,0xfa,0xd7,0x03,0x20,0x3c,0x37,0x46,0x7a,0xe1,0x7c,0x09,0x96,0x5b,0x59,0x04,0x3d,0xb0,0xe3,0x56,0xf0,0xec,0x28,0xb4,0xdb,0xcc,0x74,0x93,0xa9,0xb4,0x77,0x18,0xb5,0x55,0x08,0x69,0x9c,0x9f,0x42,0x87,0xb5,0xc7,0xad,0xdb,0x1a,0xc4,0xa9,0x50,0x49,0xe1,0x82,0x18,0x84,0xd7,0x44,0xd7,0xe4,0x08,0x74,0xac,0xa5,0xd7,0x37,0x4a,0x84,0xf1,0xd1,0x8d,0x21,0x4a,0x4b,0x4b,0x18,0xc3,0x54,0x1e,0x26,0xcf,0xbf,0x97,0xda,0xbf,0x5b,0xca,0x65,0xfb,0xd7,0x1f,0x4d,0x9d,0x17,0xf7,0xa4,0x95,0x95,0x52,0xae,0x1c,0xf2,0x9d,0xcc,0x5a,0xb6,0x62,0x9c,0x9e,0x83,0x3e,0xbf,0x0c,0xcc,0xaf,0xb6,0x3a,0x5d,0xae,0x3b,0x4f,0xec,0x4f,0x72,0x7c,0x66,0x3b,0x11,0xa7,0x5a,0x58,0x10,0x3b,0x63,0x6d,0x8c,0xb9,0x25,0x4d,0x79,0xf3,0xa9,0xe4,0x57,0x53,0x87,0xc8,0xe7,0x3e,0x58,0xbf,0x6a,0x44,0x5e,0x96,0x53,0x87,0x08,0x11,0x44,0x8e,0xb5,0x91,0x8b,0xa1,0x63,0x05,0x19,0xf0,0xc7,0xd7,0x52,0x87,0xa0,0x0e,0x30,0xe2,0x03,0x29,0x72,0x1c,0x43,0x75,0xc6,0xd9,0x1f,0xd7,0xf2,0xbf,0x86,0x39,0xe2,0x88,0xec,0x8c,0x76,0x4d,0x61,0x53,0xcc,0x9a,0x3e,0x48,0x85,0xc6,0x73,0xbe,0x79,0x8d,0x09,0xc4,0x95,0x04,0xbd,0xc8,0xf0,0x8a,0xe1,0x47,0x8d,0x91,0xa6,0x88,0x6f,0x1d,0x3c,0xd2,0xda,0xc3,0xca,0x94,0xc4,0x79,0x12,0x44,0xca,0x23,0x26,0x31,0x41,0xb0,0x16,0x91,0x61,0x86,0x2a,0xd1,0x64,0xca,0x8a,0x47,0xb9,0x26,0x49,0x5b,0x07,0x0a,0xcb,0xb3,0x27,0x5f,0x84,0x29,0x85,0x3f,0xa4,0x58,0xd2,0xe0,0x91,0xd2,0x8d,0xa3,0x19,0x2f,0xd2,0xb9,0x4b,0xc7,0x6b,0x31,0x98,0xbf,0xb2,0x2e,0x98,0xe8,0xd1,0x34,0xed,0x9b,0x48,0xcd,0x20,0xaf,0x0c,0x34,0x86,0xba,0x65,0x24,0x08,0xc2,0xa0,0x9d,0xc7,0x12,0xdf,0xb2,0xae,0x13,0x22,0xf8,0x0f,0xba,0x7e,0xfc,0x15,0xba,0xbd,0x0d,0x3d,0xc3,0x7d,0x21,0xf3,0x2c,0x7c,0x81,0xfd,0x03,0xa9,0xf6,0xcb,0x09,0x6a,0x9f,0x58,0xc8,0x89,0x40,0x14,0x3c,0x62,0x73,0x5e,0x32,0x38,0xa9,0x84,0x02,0x35,0x56,0x9e,0xaa,0xb7,0x52,0x7c,0x60,0x21,0x9b,0xbc,0xfe,0x10,0x53,0x48,0xbb,0xf6,0xe5,0x33,0xba,0x6b,0xac,0x7e,0x20,0xa4,0xeb,0x1b,0xc9,0xb8,0xb5,0x90,0x10,0xb7,0xe0,0xcf,0x05,0x55,0x1b,0x33,0xbb,0xd0,0xa6,0x32,0x11,0xed,0xe6,0xd6,0x26,0x71,0x63,0xd4,0x42,0x76,0xa4,0x75,0x59,0xba,0x92,0xdf,0x7c,0xbf,0x85,0x3b,0xf1,0xad,0x53,0x46,0x94,0x28,0xe1,0x33,0xae,0x69,0x9c,0x2c,0xeb,0xb8,0x0d,0xb3,0xcf,0xf9,0x8c,0xb0,0x63,0x81,0x90,0x30,0x41,0x5a,0x33,0x30,0x43,0x9c,0x62,0x71,0xaf,0x92,0xfb,0xf4,0xa1,0xa6,0x53,0x90,0xd8,0xda,0x9f,0x26,0x7b,0x8d,0xb8,0x1b,0xe4,0xb8,0x80,0x6f,0xb1,0xc1,0xaf,0xa1,0x73,0xaf,0x58,0xc5,0x9b,0x2f,0x58,0x34,0x42,0x96,0xa3,0xf2,0x35,0x1a,0x07,0xe9,0xb1,0x2b,0x0c,0xbd,0x82,0x26,0x49,0x66,0x53,0x3f,0xcc,0xd0,0x34,0x20,0x3b,0x17,0x2d,0xc3,0x51,0x48,0x05,0xc4,0xde,0x93,0x06,0x02,0xb2,0x02,0xc2,0xcf,0xc6,0xfc,0x0f,0x1f,0x3d,0xc5,0x7a,0x73,0xf5,0x68,0x69,0x9d,0x8c,0x85,0x11,0x71,0x31,0x3b,0xd8,0x6f,0xa2,0x3c,0xc3,0xe5,0xa8,0x2d,0x57,0x83,0x66,0xd1,0x90,0x4a,0x31,0x2a,0xd9,0xf5,0xd8,0xa0,0xba,0xc6,0x1a,0x51,0x38,0x7f,0xb2,0xfa,0x32,0x02,0xf8,0x6a,0xe7,0xce,0xad,0xb3,0x31,0xaf,0xd3,0x26,0x90,0xb4,0xdd,0x00,0xc2,0xe1,0x7b,0xd6,0xc0,0xab,0xec,0x85,0x6a,0xcf,0xb7,0xb2,0xc7,0xf0,0x3c,0xab,0x8e,0xc3,0xe8,0xf2,0x2f,0x3b,0xb9,0x7b,0xc4,0xf3,0xcd,0xf5,0x38,0xf1,0x17,0x89,0x27,0x64,0x8f,0x32,0xa7,0x1f,0xa0,0xe9,0x76,0xa6,0xee,0x1e,0x13,0x11,0x0f,0xe1,0x36,0x76,0x57,0xa6,0x78,0x8b,0x83,0xdb,0x8b,0x0f,0x1b,0x8b,0x96,0x09,0xe7,0x06,0x1f,0xff,0xcd,0x25,0x4d,0x5b,0xff,0x1a,0x1f,0xd0,0x8a,0xad,0x26,0x5b,0x37,0xf0,0xe9,0xc6,0x0f,0x71,0x88,0x8d,0x6b,0x9e,0x93,0xd8,0x88,0x6d,0x5a,0x2f,0x90,0x13,0xd5,0x01,0x35,0xd5,0x5b,0xb8,0x99,0xb2,0x05,0xed,0x16,0xa3,0x90,0x08,0x7f,0xe7,0x5c,0x7a,0x58,0x75,0x62,0x47,0x3a,0x92,0x90,0xb4,0xda,0xa2,0x2e,0x7b,0xe1,0xb2,0x11,0xdd,0xf8,0xd1,0x75,0x4e,0x8b,0xeb,0x9e,0x45,0x2e,0xcb,0x15,0xb0,0x63,0xc2,0x1a,0xf0,0x87,0xa1,0x3a,0x60,0x99,0x84,0x2b,0x5d,0xf4,0x0e,0xc1,0x41,0xfe,0xfc,0x34,0x63,0x34,0x01,0xc0,0x89,0x32,0x8c,0xd3,0xce,0xa9,0xcb,0x90,0x76,0xbc,0x42,0x75,0x6b,0xb5,0xa7,0x83,0xd4,0x1f,0xc1,0x90,0x6c,0x2b,0xa8,0x16,0xee,0x78,0x27,0xd7,0x9c,0xa3,0x2a,0x65,0x51,0xa3,0x27,0x88,0x74,0x9b,0x4b,0xd1,0xfd,0x22,0xf2,0x04,0x4b,0xf1,0x23,0xb6,0x7a,0x4d,0xa2,0x35,0xde,0x2b,0xd8,0x66,0xf0,0x8a,0xd3,0x1d,0xb3,0xee,0x02,0x6d,0xe3,0xe4,0x34,0xec,0x4f,0xd7,0x09,0x6e,0x38,0x1f,0x8c,0x1b,0xca,0x8f,0x25,0x32,0x02,0x1d,0x19,0xc2,0x59,0xee,0x0b,0x8c,0x0c,0x05,0xb0,0x70,0x1b,0x21,0xa2,0x66,
@@ -1,4 +1,5 @@
 #define jquery_min_js_gz_len 30180
+#define jquery_min_js_gz_hash "9be2669737589b4f"
 const uint8_t jquery_min_js_gz[] PROGMEM = {
 0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xcc,0xbd,0x79,0x7b,0xdb,0x46,0xb2,0x37,0xfa,0xff,0xfb,0x29,0x44,0x8c,0x87,0x01,0xcc,0x16,0x45,0x39,0xc9,0xbc,0x67,0x40,0xc3,0x7c,0x1c,0x3b,0x4e,0x3c,0x93,0x6d,0x62,0x67,0x99,0x43,0x31,0x79,0xb0,0x91,0x04,0xc5,0x4d,0x24,0x65,0xd9,0x11,0x39,0x9f,0xfd,0xd6,0xaf,0xaa,0xbb,0xd1,0x00,0x41,0x25,0x33,0xe7,0x9e,0xe7,0xde,0x2c,0x22,0x96,0x46,0xaf,0xd5,0xd5,0xb5,0xd7,0xc5,0xe3,0xd6,0xd9,0xec,0x1f,0xb7,0xf9,0xe6,0xc3,0xd9,0xbb,0x8f,0xbb,0x4f,0xba,0x97,0x67,0xfb,0x33,0x3f,0x0d,0xce,0xfe,0xf6,0xe6,0xec,0xd5,0xea,0x76,0x99,0xc5,0xbb,0x62,0xb5,0x3c,0x8b,0x97,0xd9,0xd9,0x6a,0x37,0xcd,0x37,0x67,0xe9,0x6a,0xb9,0xdb,0x14,0xc9,0xed,0x6e,0xb5,0xd9,0x52,0xd1,0xd9,0x0d,0x3e,0xed,0xae,0x36,0x93,0x8b,0x79,0x91,0xe6,0xcb,0x6d,0x7e,0xf6,0xf8,0xe2,0xff,0xb4,0xc6,0xb7,0xcb,0x14,0x1f,0xfa,0xb1,0x4a,0x82,0x7b,0xef,0x96,0x1e,0x6f,0xe9,0xb3,0x74,0xe7,0xf5,0xbd,0x55,0x32,0xcb,0xe9,0x22,0x8a,0x76,0x1f,0xd6,0xf9,0x6a,0x7c,0xb6,0x58,0x65,0xb7,0xf3,0xbc,0xdd,0x3e,0xf1,0xa2,0x9b,0xbf,0x5f,0xaf,0x36,0xbb,0xed,0xa0,0x7a,0x1b,0xc5,0xdd,0x6c,0x95,0xde,0x2e,0xf2,0xe5,0x6e,0x90,0x50,0x33,0xad,0x5e,0x10,0x96,0xad,0x06,0xf7,0xc5,0xd8,0x6f,0x95,0x45,0x82,0xdd,0x74,0xb3,0xba,0x3b,0x5b,0xe6,0x77,0x67,0x9f,0x6f,0x36,0xab,0x8d,0xef,0xe9,0x31,0x6f,0xf2,0x9b,0xdb,0x62,0x93,0x6f,0xcf,0xe2,0xb3,0xbb,0x62,0x99,0x51,0x99,0xbb,0x62,0x37,0xa5,0x3b,0xf3,0xa5,0x17,0xf4,0x37,0xf9,0xee,0x76,0xb3,0x3c,0xa3,0x56,0x82,0x43,0xc8,0x7f,0x7d,0x8f,0x66,0x26,0x1f,0x17,0xcb,0x3c,0xf3,0x5a,0xa6,0xbb,0xf2,0xfd,0x40,0x7e,0xc2,0xdd,0xb4,0xd8,0xaa,0x07,0xa6,0xe1,0x5d,0x4c,0x73,0x19,0x0d,0x47,0x2a,0x73,0x46,0xa2,0xf2,0xe8,0x5b,0x9e,0x84,0xee,0x24,0xdf,0x7d,0xb7,0x59,0xed,0x56,0xa8,0xfb,0xdb,0xb1,0x1a,0x47,0x69,0x77,0x8b,0x09,0x56,0x13,0xba,0xa2,0x35,0x48,0xe3,0x9d,0x9a,0xd2,0xe5,0xfa,0x76,0x3b,0x55,0x05,0x5d,0x50,0xab,0xf9,0x7b,0x2a,0x39,0x8b,0xee,0x0f,0xea,0x3a,0x9a,0x75,0x77,0xab,0x37,0xd4,0xd4,0x72,0xa2,0xe6,0x74,0x33,0x8d,0xb7,0xdf,0xde,0x2d,0xa9,0xc6,0x75,0xbe,0xd9,0x7d,0x50,0x8b,0x68,0x5e,0xbe,0x5f,0x46,0x8b,0x6e,0x1a,0xcf,0xe7,0xbe,0x34,0x1d,0xa8,0x15,0x55,0xd1,0x37,0x5d,0x3f,0x5b,0x4b,0xe7,0x93,0x28,0xd9,0xef,0x33,0xdd,0xed,0xa4,0x9b,0x6e,0xf2,0x78,0x97,0x7f,0x3e,0xcf,0xd1,0x6d,0xdf,0xdb,0xa6,0x9b,0x62,0x8d,0xb9,0x4a,0xbb,0xbb,0xfc,0xfd,0x2e,0xa2,0x4f,0xba,0xd3,0x3c,0xce,0xba,0xf1,0x7a,0x9d,0x2f,0xb3,0x17,0xd3,0x62,0x9e,0x11,0x54,0x75,0xd7,0xf1,0x86,0xca,0x7f,0xb3,0xca,0xf2,0xee,0x26,0x5f,0xac,0xde,0xe5,0xe6,0xcd,0x01,0x15,0xdf,0x44,0x1e,0x83,0xa0,0xa7,0x36,0x51,0x75,0xea,0xf4,0x12,0x60,0xfd,0x36,0xdd,0xf1,0x92,0x46,0x5b,0xec,0xf8,0xcd,0x41,0x6d,0xa3,0x8b,0x5f,0x86,0x57,0xdb,0xab,0xdb,0x57,0x9f,0xbf,0x7a,0x75,0xf5,0xfe,0x79,0x6f,0xd4,0xd9,0xd7,0xee,0x1f,0x5d,0x4c,0xd4,0x8e,0x8a,0x9d,0x2f,0xb6,0xe7,0x17,0xea,0x36,0xba,0x38,0xf7,0x87,0xf1,0xf9,0x6f,0xa3,0x80,0x9e,0xbf,0x6b,0x6e,0x29,0xa1,0xf9,0xf9,0x81,0xfa,0xbe,0x79,0x11,0x6f,0x73,0x3f,0x38,0xf4,0xd1,0x6c,0xb4,0xe9,0xae,0xcd,0xa2,0x44,0xf7,0x02,0xfa,0xe1,0x8d,0xa2,0xe5,0xa0,0x55,0xbd,0x4d,0x69,0x4b,0x84,0x1b,0x35,0xcf,0x97,0x93,0xdd,0x34,0xec,0xa9,0xdd,0xea,0xf9,0x66,0x13,0x7f,0x28,0xa1,0xd2,0x56,0x3e,0x96,0xf9,0x06,0x88,0xd0,0x00,0x68,0xa9,0x2b,0x90,0x6b,0xc6,0x7a,0x3b,0x9f,0x47,0x51,0x3c,0x70,0x0b,0x87,0xf1,0xd3,0xde,0x00,0x57,0xc3,0xb8,0x83,0x9f,0xae,0x34,0x36,0x0a,0xe5,0xd9,0xe8,0xa0,0x00,0x0f,0x6f,0x76,0x71,0x7a,0x5d,0xa9,0x12,0x93,0x9b,0x50,0xef,0x17,0xf9,0x66,0x92,0x73,0x55,0x5d,0xa7,0xd3,0x7e,0xa0,0xe2,0x12,0xca,0x69,0x88,0xf9,0x3b,0x01,0x85,0x88,0x81,0x38,0x39,0xa8,0x3c,0x4e,0xa7,0x4d,0x7d,0xdc,0x74,0xf1,0x86,0x2b,0xa4,0x2a,0x0e,0x6a,0x11,0xaf,0x9b,0x8a,0x71,0x83,0xb6,0x67,0x3e,0xf5,0x23,0x5e,0xfb,0xd5,0x0d,0x92,0xa8,0xd4,0x16,0x8f,0x65,0xc4,0xf4,0x08,0x0b,0x1c,0x60,0x8d,0x01,0xfa,0x0d,0x13,0x59,0xab,0x78,0x0c,0x70,0x9b,0x7f,0xd0,0xfd,0xd9,0x4c,0x78,0x4f,0x6d,0x51,0xc1,0xb8,0xd8,0x6c,0x77,0xa7,0x2a,0xc8,0x6f,0xfc,0x1e,0x95,0x99,0xc7,0x0f,0x16,0x39,0xbf,0xa4,0x32,0xf9,0x4d,0xc3,0xbc,0x3a,0x2b,0xa1,0xd2,0xa8,0x13,0x77,0x7c,0x2c,0x53,0x12,0xf6,0xec,0xa4,0xd6,0xfa,0x99,0x3e,0x8b,0x7a,0xed,0x76,0xfa,0x34,0x19,0x0c,0x79,0xe1,0xd2,0xd1,0x28,0x1c,0x8e,0x50,0xfd,0x32,0x3b,0x39,0x4a,0xbb,0x2a,0xfb,0xfd,0xf1,0x02,0xca,0xc2,0x87,0x53,0xb5,0x25,0xdc,0x18,0x12,0xae,0xa0,0x1f,0xb5,0x5d,0xf3,0xb4,0xd1,0x1d,0x5f,0x1c,0x14,0x2d,0xd7,0xfb,0x1d,0xb5,0x11,0xf1,0x1e,0xd2,0xd7,0x4e,0x7b,0x18,0x0e,0x6d,0x02,0x9a,0xf7,0x4c,0xe5,0x6a,0x4c,0xb8,0xc6,0x4e,0xe2,0xb0,0x37,0xda,0xef,0x09,0xb3,0x4c,0xa3,0x4b,0x42,0x37,0xf6,0xb1,0x19,0xf6,0x2c,0x6a,0x5d,0xf6,0xc7,0xc0,0xab,0xc9,0x6a,0x35,0xcf,0xe3,0x65,0x89,0xc5,0x27,0xed,0xb6,0x3f,0x8b,0x26,0x95,0xca,0xa6,0xba,0xb2,0x4e,0x27,0x50,0x47,0x68,0x7f,0xb2,0xdf,0x6f,0xba,0xc5,0xf6,0x95,0xe9,0xd7,0x24,0xd8,0xef,0xfd,0x09,0xe1,0xa4,0x80,0x5a,0x8f,0xa2,0x82,0xea,0x9b,0x08,0x64,0x4e,0xcf,0xcf,0x83,0xfe,0xf4,0x69,0xd1,0x47,0x45,0x84,0xf0,0xb1,0x65,0x5a,0x91,0x1f,0x57,0x5a,0x0a,0x02,0xf4,0x2b,0x39,0x2b,0x08,0xb0,0x82,0x34,0x9a,0x0c,0x13,0xc6,0xb9,0xf8,0x99,0xb4,0xa2,0x28,0x43,0xf7,0xda,0x6d,0xfc,0xa0,0xd5,0xef,0xe6,0x71,0xb1,0x94,0x79,0xf6,0x33,0x34,0x9c,0x47,0xbc,
 0x8b,0xe9,0x15,0xff,0xd2,0xc3,0x20,0x18,0xf8,0x39,0xfd,0x47,0x43,0x06,0x5e,0x6e,0xb7,0xab,0x05,0xd2,0x60,0x90,0x62,0x35,0x43,0x7e,0x57,0xaf,0x93,0xdf,0xd2,0xd0,0xd1,0x8d,0xc8,0xac,0x87,0x3f,0xa3,0xc9,0xa6,0x8a,0xc3,0x77,0xab,0x22,0x3b,0xeb,0xe9,0x5e,0x71,0x11,0x7a,0x6a,0x80,0x68,0x52,0x2e,0xa0,0x7f,0x4f,0xa7,0x20,0x9d,0xc9,0xab,0x50,0x9f,0x63,0x5e,0xc7,0xbf,0xe9,0x7c,0x1d,0xef,0xa6,0xdd,0x0d,0x1e,0x2f,0xfc,0x20,0x20,0x04,0xbb,0x9e,0xc7,0x69,0xee,0x5f,0x5c,0xbd,0x24,0x3c,0xe7,0x79,0x81,0x2a,0xb6,0xdf,0x13,0x4e,0xfe,0x10,0xb6,0x7a,0x2a,0xc7,0x29,0x58,0x81,0xe5,0xfa,0x09,0x89,0xfd,0xbc,0x5c,0xad,0xd6,0x2e,0x40,0x1e,0x54,0xb9,0x2e,0x0d,0x1b,0xdd,0x33,0x8f,0x68,0x31,0x69,0x70,0x58,0x4f,0xae,0xa6,0xd8,0xfe,0x24,0x87,0xe2,0x09,0x34,0xd7,0x8a,0xe2,0x76,0x3b,0xa6,0x6f,0xe2,0xae,0x9c,0x9e,0xf8,0xe4,0x1b,0x5a,0x41,0x3a,0x2a,0x1b,0xf1,0x98,0xae,0x59,0xcf,0x8c,0xef,0x2d,0x6f,0x17,0x49,0xbe,0x41,0xab,0x74,0x48,0x79,0x5b,0x3e,0xd7,0xf8,0x2e,0x68,0xb7,0x5b,0x54,0x55,0xfc,0x8d,0x1f,0x9f,0xd3,0xd9,0xb3,0xcd,0x5f,0xcd,0x57,0x31,0x9d,0x1c,0x01,0xf7,0xca,0x59,0x98,0xe3,0x66,0x54,0xaa,0xab,0x6f,0x11,0x21,0x41,0xb5,0x0e,0x05,0x4e,0xcf,0xa4,0xfc,0x88,0xce,0xfd,0xe8,0x5a,0x10,0x15,0xd5,0x46,0xcb,0xd5,0xf2,0x93,0x08,0x9d,0x02,0xd0,0xa4,0x74,0xbe,0x6a,0x1c,0xe6,0x39,0xfb,0xd4,0xa3,0x72,0x89,0xbb,0x71,0x95,0x3b,0x63,0x1a,0xfc,0x09,0x68,0xf4,0x79,0x9c,0x06,0x34,0x84,0xa5,0x74,0xf5,0xf3,0xc5,0x7a,0xf7,0xe1,0x54,0x57,0xfb,0x0e,0x84,0xeb,0x3e,0x5f,0x9a,0xce,0xf7,0x0e,0x0a,0x15,0x3f,0x74,0xc2,0xc4,0x1d,0xcf,0x0b,0x8f,0xb6,0x21,0xc6,0x7c,0xdc,0xbb,0x78,0x30,0x1b,0xda,0x61,0xd3,0x2e,0x36,0x9f,0x85,0xe6,0x3d,0x81,0xf6,0x7c,0x95,0xc4,0xf3,0xcf,0xdf,0xc5,0xf3,0x4a,0xa3,0x6b,0x06,0x85,0x34,0x5e,0xe4,0x73,0x9c,0xa9,0x4d,0x1d,0x8a,0x2d,0xcc,0xee,0x94,0x47,0x67,0xb5,0x57,0x02,0xf1,0xad,0x7a,0x17,0x1c,0x9d,0x43,0x38,0xaf,0x99,0x20,0xa1,0x0d,0xdd,0xeb,0x13,0x02,0xb8,0xc3,0xfc,0xdf,0x63,0x36,0x52,0x82,0x25,0xc1,0x4d,0xfd,0xec,0x69,0xda,0xcf,0x04,0x41,0x24,0xba,0xe7,0xc3,0x8c,0x70,0x80,0xc2,0x0f,0xa6,0xb8,0x75,0x19,0x24,0x44,0xce,0x5c,0x1f,0xf2,0x39,0x11,0x68,0xf8,0x3a,0x93,0xb9,0xfc,0xdd,0x2f,0xcc,0xd6,0xa4,0x51,0x13,0xcc,0x2d,0x1e,0x9a,0x64,0x9a,0x62,0x1f,0x13,0x5d,0x0e,0x69,0x8b,0x3d,0x89,0x33,0xf3,0x3a,0xaf,0x11,0x0a,0xe5,0xc0,0x00,0xcf,0xc3,0x51,0xbf,0xbe,0x57,0x68,0xa0,0x1a,0x9f,0xd0,0x78,0x07,0xe6,0x5c,0x4f,0x55,0x09,0xfa,0x76,0xb9,0x88,0x2a,0x08,0xe3,0x20,0x9c,0x6a,0x90,0xa2,0x63,0x3a,0x50,0x29,0x41,0xd4,0xf2,0xb8,0x4d,0xe7,0x08,0x96,0x5e,0x27,0x83,0xf3,0xcb,0xb0,0x30,0x90,0x1c,0xd3,0x7b,0xea,0x2e,0x9a,0xaa,0x75,0x15,0x53,0x26,0xdd,0xed,0x24,0xe6,0x44,0xa0,0x15,0x21,0x6a,0xf6,0x68,0x11,0xe2,0x61,0xde,0xe9,0x8c,0xa2,0x84,0x26,0xd2,0x4e,0x9e,0x2e,0x13,0xe5,0x0a,0xd0,0x43,0xd3,0x73,0xd4,0x2b,0xd3,0x00,0x1d,0x4b,0x20,0x99,0xc7,0x54,0xf7,0xc4,0xd6,0x4d,0xa7,0x42,0x2b,0xed,0x8f,0x9f,0x4e,0xfa,0x63,0x6a,0x20,0x8b,0x5a,0x44,0xa2,0x0f,0xc7,0x54,0x2a,0x50,0x19,0x6d,0xd2,0x69,0xbb,0x9d,0xf3,0xd9,0xcb,0x4f,0x2d,0x36,0xcd,0xeb,0xd4,0x8a,0xb4,0xa4,0x5b,0xe1,0x26,0xa6,0xd4,0x96,0x85,0x2a,0x06,0x8b,0x72,0x3c,0xe3,0xa7,0x19,0x37,0x97,0x47,0xa6,0x35,0xfa,0x5a,0xc9,0x02,0x11,0x2f,0x33,0x95,0x16,0xf3,0xa0,0x6f,0x61,0x6a,0x2c,0x30,0xf5,0xbb,0x1f,0x18,0x6c,0xaf,0x69,0x19,0x1a,0xee,0x14,0x44,0xe2,0x6d,0x91,0x85,0x97,0x8a,0xc8,0xcf,0xf7,0x8d,0x80,0x82,0x13,0x1b,0x7d,0x3d,0x82,0x80,0x84,0xa0,0x25,0x95,0xe3,0x2e,0x21,0xb2,0x3c,0x8e,0xa8,0xd5,0xca,0xf1,0x4a,0x63,0xd3,0x4d,0x12,0x2d,0xa0,0xa1,0xdd,0x1c,0x9f,0xea,0x49,0x40,0x33,0x7e,0x4c,0x91,0xc4,0xba,0x73,0x89,0xd0,0x22,0x2a,0xd3,0x2c,0x89,0x5f,0xaf,0x20,0x00,0xf6,0xca,0xbb,0xe8,0x3d,0xcd,0x9d,0xf3,0x83,0x33,0x1e,0xbf,0x9d,0x8e,0xca,0x71,0xce,0xdc,0x85,0x2f,0x89,0x9f,0xe8,0xd2,0x85,0xda,0xde,0xae,0xc1,0xe1,0x85,0x2b,0x3a,0xf0,0x1b,0x30,0xd0,0x9b,0x0f,0x8b,0x64,0x35,0xe7,0xe3,0x7a,0xbc,0x1c,0xca,0x5d,0xb7,0xd8,0xe5,0x9b,0x98,0x10,0xea,0x28,0x4a,0x8f,0x1e,0x61,0xbc,0x4c,0xa6,0x7a,0x9f,0x09,0x6d,0x72,0xf6,0x0d,0x1f,0x17,0x67,0xc2,0xff,0x9c,0x99,0x99,0x38,0xe3,0x1d,0x71,0x86,0x7e,0x9c,0x7d,0x9f,0x4f,0x3e,0x7f,0xbf,0xd6,0xb8,0x5e,0x0e,0x44,0xdd,0xb0,0xc7,0xd4,0x14,0xb1,0x3c,0x67,0x74,0xa0,0x56,0x17,0x62,0x36,0xb4,0x87,0x84,0xd7,0x49,0x3a,0xde,0xc8,0x23,0x40,0x27,0x3e,0xe2,0xab,0xd5,0x9d,0xe5,0x23,0x82,0x92,0xb1,0xba,0x2b,0x4f,0xb4,0x56,0x8b,0x36,0xb5,0x27,0xa0,0xe5,0x01,0x4c,0xe8,0x38,0x2c,0x29,0xca,0xfa,0x79,0x57,0x4e,0x0a,0x81,0x37,0x1d,0x17,0x2d,0xac,0xa7,0x9c,0xb0,0x54,0x88,0x66,0xc6,0x8b,0x31,0x12,0x1c,0x80,0xe9,0x7e,0xdf,0xd3,0xa7,0xa2,0x3d,0x23,0x4b,0xc0,0x48,0x9e,0x11,0x19,0x9a,0x9c,0x5f,0x0a,0x64,0x32,0x0b,0xf6,0x3e,0x6a,0x38,0x08,0x0d,0x39,0xa8,0x88,0xd5,0x54,0x33,0x75,0xad,0xe6,0x6a,0xa1,0x96,0x6a,0xa5,0xd6,0xea,0x46,0x6d,0xd4,0x56,0xed,0x88,0xa9,0xf2,0xb6,0xc5,0x6f,0xbf,0xcd,0x73,0xaf,0x73,0xf9,0x18,0x44,0x04,0xa6,0x91,0x98,0x2b,0x87,0xb7,0xbd,0xa3,0x2d,0xf5,0x9e,0xfe,0xff,0x10,0x4d,0x63,0x62,0x39,0x7e,0x93,0x9f,0xe7,0xf2,0xf3,0x59,0x33,0x1b,0x06,0xa2,0x00,0x10,0x3c,0x8f,0x88,0xbf,0x57,0x74,0x96,0xbd,0x20,0x3a,0xb0,0xce,0xcd,0xbe,0x04,0x4e,0xf8,0x3c,0x7a,0xd9,0x5d,0xaf,0xd6,0xea,0x15,0x7e,0xc1,0x14,0x7f,0x61,0x2e,
@@ -1,4 +1,5 @@
 #define logo_png_gz_len 5203
+#define logo_png_gz_hash "6994b0c0dc25aabf"
 const uint8_t logo_png_gz[] PROGMEM = {
 0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x9d,0x58,0x09,0x38,0x94,0x6f,0xbb,0x1f,0x61,0x2c,0x25,0x24,0xfb,0x36,0x11,0xd9,0x67,0x8c,0x75,0xa6,0x26,0x61,0xac,0x65,0x2c,0x91,0x28,0xcb,0x98,0x19,0xbb,0x19,0x66,0x26,0x86,0xec,0x24,0x29,0xb2,0x66,0xcd,0x4e,0xc8,0x12,0x11,0x42,0x84,0x2c,0x45,0x11,0x2d,0x96,0xec,0x6b,0x28,0xa3,0x64,0xe7,0x4c,0xfd,0xff,0x75,0xce,0xf7,0x5d,0xe7,0x7c,0xe7,0x9c,0xef,0xbd,0xae,0xe7,0x9d,0xf7,0xb9,0xdf,0xdf,0xfd,0xbb,0xd7,0xe7,0xbe,0xe6,0x7a,0x6f,0x99,0xa0,0xf4,0xd8,0x58,0x05,0x58,0x01,0x00,0x00,0x9b,0x81,0x3e,0xd2,0x8c,0xf6,0xab,0x40,0x5b,0x72,0xcc,0x40,0xda,0x5d,0xc0,0x2b,0xea,0x0c,0x00,0x40,0x27,0xe9,0xa2,0xad,0x6d,0xa2,0x89,0x25,0x38,0xe0,0x40,0x66,0x7a,0x5a,0x20,0x29,0x45,0x18,0x4c,0x5d,0x1a,0x00,0x90,0x7a,0x83,0xb1,0xb7,0x87,0x7a,0x92,0xbd,0x88,0xb8,0x63,0xf6,0xf6,0x5d,0xbd,0xb2,0xd2,0xac,0x44,0x1f,0xb3,0xc8,0xc8,0x3b,0x66,0xf6,0x1a,0x6f,0x5a,0x3a,0x5a,0x7a,0x00,0xc0,0x5b,0xdd,0x2f,0x18,0x63,0xe8,0xe8,0xce,0x82,0xbc,0x6d,0x03,0x6d,0x65,0xe8,0x81,0x9b,0xde,0xd1,0x21,0x9c,0x48,0xbb,0xf7,0x8c,0xa9,0x2f,0xce,0x09,0x4c,0x18,0x2a,0x48,0xc9,0xd0,0xbd,0x0d,0x0a,0xfe,0x28,0x25,0x51,0xa3,0x9e,0x1a,0x12,0xd2,0x0f,0xe8,0x7a,0xad,0x00,0x96,0x06,0x44,0x29,0xbd,0xa6,0xab,0xd2,0x89,0xaf,0x7a,0xbe,0xcc,0x06,0xf2,0x36,0xd5,0x8f,0x55,0x8a,0x0d,0x60,0xe8,0x9a,0x3b,0x7f,0xf3,0x51,0x45,0xf0,0x47,0x03,0x8e,0x1f,0x5c,0x1c,0x0d,0xcc,0x0b,0x2c,0xa0,0x9d,0xc3,0xfa,0x01,0xf0,0x94,0xde,0x76,0x3a,0x55,0xa6,0xd6,0x7b,0x74,0x95,0xe7,0xcd,0x64,0xcf,0xfd,0x80,0xaa,0xcf,0xf3,0x9a,0xf3,0xe0,0x0a,0x9d,0x12,0xa5,0xf8,0xac,0xad,0xad,0x65,0xd4,0x0b,0x67,0x4e,0x15,0xc8,0x30,0x58,0xf2,0x24,0xe7,0xcf,0xf1,0xc8,0x52,0xe6,0x24,0xe6,0x79,0xb9,0x67,0x78,0x25,0xee,0xe5,0x17,0x02,0xde,0x69,0x8d,0x32,0x01,0x43,0x39,0x6e,0x64,0x73,0x0c,0x00,0x5c,0xab,0xfb,0xb0,0xd9,0x50,0xc0,0x0b,0xfa,0xf0,0x75,0x18,0x87,0xd0,0xb3,0x3b,0x0e,0x4e,0x1c,0x0e,0xcc,0xb1,0x57,0xad,0xcd,0x81,0x38,0x28,0x94,0x9f,0x6b,0x4e,0xbc,0x27,0x45,0xfc,0x79,0xcb,0x44,0x73,0x62,0x48,0xc8,0x2c,0xbb,0x56,0x4f,0x7e,0x72,0x08,0x3a,0xe4,0x28,0x3d,0xfd,0x81,0x79,0x78,0x4a,0xda,0x09,0xfa,0xb0,0xe0,0xb3,0xf4,0x6d,0xcf,0x60,0x80,0x96,0x0e,0xe3,0x3d,0x7e,0xb8,0xea,0x55,0x5a,0xe2,0x58,0x3c,0xf5,0xad,0x48,0x00,0xc0,0x61,0xae,0x9f,0x8b,0x0e,0x90,0x96,0xc1,0x07,0x00,0x30,0xac,0xb9,0x98,0x5f,0x26,0x5f,0x36,0xba,0x00,0xc7,0x10,0x3c,0x14,0xd0,0x3f,0xd3,0xa9,0x40,0xf1,0xf0,0x04,0xfc,0xbc,0xce,0x68,0x50,0x3c,0xd1,0x18,0x37,0x1c,0x19,0xe4,0x80,0x73,0x72,0xc1,0x23,0xc4,0xbe,0x36,0x34,0x8b,0x81,0x5c,0xb0,0x08,0x31,0x4b,0x15,0x23,0x88,0x91,0xa7,0x36,0xce,0xd9,0x45,0xdf,0x8f,0x88,0xbb,0xe8,0x87,0x32,0xc7,0xf8,0xb9,0x61,0x60,0x58,0x31,0x8d,0xb3,0xa0,0x33,0x14,0x38,0x8d,0xc0,0x03,0x47,0x46,0x83,0x28,0x1e,0xee,0x78,0x12,0x9c,0x82,0x10,0xfb,0xc5,0x0b,0xa7,0x3d,0xff,0x14,0x83,0xc5,0x40,0xbf,0x20,0x64,0x37,0x84,0xd8,0x5f,0xf5,0xbb,0x6c,0x64,0x02,0xd2,0x26,0x10,0x71,0x20,0x55,0x05,0x88,0x3c,0x06,0x02,0x51,0x05,0xa9,0xc1,0x14,0xb0,0x68,0x07,0x34,0xc6,0xc1,0x41,0x0e,0x04,0x85,0x40,0x15,0xc1,0x10,0x65,0xb0,0xa2,0xb2,0x3c,0x04,0x02,0x57,0x82,0xc1,0x95,0x95,0x41,0x7f,0x5f,0x62,0x34,0x73,0x44,0xac,0x23,0xdc,0x0c,0xa9,0xfb,0xb7,0x31,0xda,0x0e,0x21,0xe6,0x4c,0x26,0x7b,0xc2,0xc1,0x60,0x1f,0x1f,0x1f,0x05,0x1f,0x25,0x05,0x02,0xd1,0x09,0x4c,0x6b,0x0e,0x18,0x18,0x02,0x05,0x43,0xa1,0xf2,0x34,0x84,0x3c,0xc9,0x17,0x4f,0x46,0x53,0xe4,0xf1,0x24,0xf1,0xdf,0x0c,0x48,0x1c,0x09,0x43,0x74,0xf1,0x24,0xbb,0x10,0xf0,0xa0,0x9f,0x7b,0xb4,0x03,0xe1,0x1a,0x19,0x21,0x26,0xf6,0x3b,0x06,0x0f,0xcf,0x3f,0xb4,0x78,0xd2,0xdf,0x79,0xa2,0x65,0x0c,0x4c,0x41,0x7b,0x82,0x15,0x15,0x20,0xe0,0xdf,0x40,0x2c,0xe6,0x0f,0xce,0xf3,0x1a,0xd1,0xfd,0x97,0x71,0x2c,0x06,0x8c,0x73,0xc7,0x79,0xe0,0xf0,0x64,0x12,0x0d,0xab,0xf8,0x07,0xeb,0xe9,0x4c,0x20,0x13,0x48,0xce,0x84,0xff,0x81,0xfa,0xcf,0xeb,0x7f,0x30,0x40,0xf3,0xc4,0xc8,0xe8,0x5f,0xfb,0xe2,0xe1,0xf1,0x07,0x4d,0x22,0xeb,0x78,0x93,0xff,0x35,0x9a,0x64,0xee,0xeb,0x89,0x03,0x9b,0xe1,0x48,0x84,0x6b,0x44,0x0c,0x4e,0xc7,0x9b,0xe6,0xa6,0xf8,0x4f,0x75,0x4f,0xb8,0x36,0x11,0x87,0x26,0x13,0x88,0xe6,0x04,0x82,0xfb,0xef,0x4a,0x99,0xfc,0xf6,0x09,0x04,0x85,0x2a,0x28,0x83,0xa4,0x8c,0xd0,0x18,0x17,0xfc,0x4f,0x89,0xf4,0x7f,0x51,0xc1,0x21,0x69,0x0b,0x21,0xf6,0xb3,0x6e,0xf2,0x10,0x98,0x3c,0x44,0xd9,0x1c,0x4a,0xab,0x9b,0x32,0x5c,0x49,0x45,0x16,0xa2,0x04,0x87,0x40,0xfe,0x82,0x1a,0x11,0xb0,0x2e,0x8e,0xbe,0xff,0x2d,0x14,0x06,0x57,0xf9,0x47,0x28,0xad,0x6b,0xb0,0x68,0x32,0xfa,0x7f,0x05,0x63,0x31,0x70,0x47,0x02,0xd1,0x03,0x4d,0x0b,0xd9,0xc5,0x03,0xed,0x84,0x03,0x7b,0xe2,0x9d,0xc4,0x40,0x7f,0x12,0x09,0xd7,0x26,0xb8,0x13,0x88,0x34,0xc3,0x34,0x16,0xa5,0x5f,0xd4,0x46,0x46,0x70,0x03,0x3c,0x89,0x8c,0xc6,0x63,0x70,0x06,0x48,0x84,0x18,0x4d,0xa2,0xe0,0xe2,0x82,0x85,0xab,0xc3,0x60,0xca,0x4a,0x18,0x75,0x8c,0x3c,0xcc,0x41,0x5d,0x49,0x5e,0x59,0x45,0x15,0x27,0xef,0x00,0x73,0x54,0x93,0x57,0xc4,0x2a,0x42,0xd5,0xb0,0x50,0x55,0x25,0x75,0x25,0xc7,0xdf,0xfa,0x48,0x02,0xe6,0xda,0xcf,0xda,0xfe,0xd6,0xc7,0xfe,0x3f,0xf5,0x8d,0x89,0x2e,0xb4,0xc3,0x85,0x76,0xff,0xb7,0x79,0x7e,0x1e,0xb9,0x5f,0x4c,0xfa,0x2e,0x24,0x5a,0xb9,0x7c,0xff,0xee,0xe8,0x8b,
 0x38,0xaf,0xbf,0x9f,0xdc,0x5d,0x40,0xbf,0xfa,0x00,0x8e,0xc6,0xfc,0xec,0x6f,0x84,0x18,0xe6,0x57,0x95,0xb0,0x62,0x7f,0x8b,0x5d,0xfe,0xed,0x0c,0xfc,0xa5,0xef,0xe3,0x8c,0xc3,0xff,0xcb,0x72,0xff,0x05,0x23,0x11,0x1c,0xc9,0x3e,0x68,0x22,0x4e,0xd3,0x89,0x16,0xe5,0xff,0xa1,0xa1,0xc0,0x34,0xf7,0xc1,0xff,0x19,0x09,0xf8,0x9f,0x83,0x04,0xff,0xd3,0xb9,0xfd,0x2d,0xa2,0x0d,0x83,0x5f,0xf0,0xdf,0x63,0x88,0xb6,0xf9,0x33,0xc8,0x70,0x78,0xda,0xf4,0x22,0xd2,0xc6,0x94,0xbe,0xec,0x7c,0x2e,0x00,0xc0,0xfe,0xde,0x00,0xa9,0x69,0x7e,0xb9,0x6d,0xc5,0x8a,0x85,0x72,0x1c,0x97,0xb6,0x2f,0x64,0x8e,0xbd,0xf6,0x82,0x1f,0x7c,0x95,0x23,0x95,0xbb,0x9d,0xff,0x8d,0x30,0x7f,0x62,0x1c,0xc6,0x93,0x8f,0x09,0xc7,0xcd,0x6b,0xda,0xa2,0xc9,0x46,0xec,0x2a,0xed,0x9a,0xf4,0x64,0x61,0x0e,0x25,0x86,0xcf,0x1e,0x81,0x07,0x33,0x1f,0x3a,0x44,0x7f,0x12,0x14,0x0b,0x08,0xe1,0x38,0x72,0x62,0x43,0xf3,0x28,0x7c,0x51,0xe8,0x3e,0xca,0x67,0x5b,0x7f,0xfc,0x93,0x85,0x8d,0x8d,0x8f,0xc5,0xd7,0x2b,0xf7,0xdb,0xc3,0x92,0xac,0x7c,0x1c,0x7b,0xbe,0xf5,0x7c,0x73,0x47,0xbc,0x49,0x2f,0x2f,0x29,0xdf,0x3e,0xd8,0xd8,0xd9,0xdf,0x38,0xbd,0x7f,0xf4,0xc5,0xb4,0xd7,0xb6,0x1e,0x72,0xca,0xf8,0x6b,0x06,0xcf,0xd3,0xb3,0x03,0x86,0xd3,0xaf,0xac,0x17,0xd7,0x13,0x78,0xb6,0xd7,0xe7,0x93,0x6f,0xc5,0x1f,0x8e,0x54,0x3d,0x7e,0xcc,0x43,0xce,0xb5,0x0d,0x68,0x7f,0x4d,0xa4,0xb7,0xd9,0xfe,0x81,0xf8,0x1c,0x40,0xb8,0x9c,0xbd,0x8f,0xc5,0x2d,0x25,0x46,0x2d,0x62,0xa1,0xf1,0x7e,0x7d,0x77,0x47,0x64,0xdb,0x21,0xc5,0x59,0xf6,0xa8,0xc2,0x53,0x4b,0xd4,0xcd,0xa3,0x77,0x1a,0xce,0x0f,0xac,0xdf,0xa5,0x6e,0x15,0xd3,0x8d,0xda,0xf1,0x26,0x0d,0x5a,0x71,0x6a,0x6e,0xdd,0x87,0xb5,0x8c,0xdf,0xc3,0xb3,0x98,0xc6,0x9d,0x36,0x84,0x1d,0x8d,0x80,0x7a,0xee,0x8f,0xb4,0xd5,0x20,0x65,0x89,0xcd,0x99,0x15,0xf4,0x6e,0x87,0x17,0xd4,0x82,0xca,0x73,0xfa,0x5d,0xae,0x29,0x37,0x75,0xe9,0xd0,0xb3,0x5e,0x1d,0x44,0xbc,0xfa,0x11,0x74,0xea,0x19,0xa0,0x7d,0xe0,0x9c,0x7f,0x6d,0xb7,0x5e,0x67,0x7a,0x6b,0xe2,0x57,0x6c,0xd0,0x25,0xde,0x99,0x71,0xb4,0xc4,0x7a,0x64,0xfe,0xe7,0x9a,0xa7,0x22,0x77,0xdb,0x47,0xd8,0xf9,0x40,0x41,0xd7,0xca,0x3b,0x61,0xb1,0xb5,0x13,0xa9,0x09,0x22,0x28,0x5b,0xb3,0x85,0x98,0xfd,0xaa,0xd1,0x36,0x53,0x47,0x52,0x0a,0xaa,0x65,0xf3,0xc1,0xc5,0x20,0xfd,0x29,0xb7,0x35,0xe7,0xd7,0xc9,0xaa,0xc3,0x56,0x93,0x05,0x8f,0x7b,0xe3,0x4e,0x35,0x2a,0x6e,0x91,0x77,0x09,0xea,0x0c,0x3a,0xb2,0x87,0xb6,0xe6,0x63,0xde,0x33,0xb9,0xac,0xd2,0x71,0xf5,0x33,0xf1,0x06,0x01,0xa6,0xd2,0xa3,0x6e,0xdd,0xb3,0xcb,0x56,0x83,0xca,0x63,0xd9,0x0e,0x77,0x53,0x9b,0xa7,0x39,0x79,0x12,0xe9,0x9b,0x3f,0xda,0x18,0x55,0x4f,0x08,0x99,0x1a,0x52,0xed,0x8c,0xfd,0x53,0x34,0xfd,0xaf,0x9d,0xed,0xdf,0xf6,0x5e,0x8b,0xa8,0x4d,0xf0,0x6a,0x52,0x66,0x4a,0xc3,0xb2,0xb7,0x07,0x05,0xe7,0x55,0x27,0xc9,0xe6,0x27,0xad,0x6e,0xbe,0xbc,0x6d,0x57,0xb1,0xda,0xf1,0xc4,0x37,0x0b,0xbe,0x1a,0x10,0xe9,0xd4,0x32,0xbd,0xa3,0x30,0x50,0xb3,0xba,0x59,0xf3,0x30,0x64,0x46,0xeb,0xa9,0xb7,0x7c,0x57,0x33,0x29,0x86,0x67,0x1e,0xc6,0xd3,0x11,0xd4,0x32,0x6d,0x8f,0x59,0x00,0xc8,0x77,0xe1,0xaf,0x78,0x60,0x50,0x94,0x11,0xcf,0x89,0xd5,0xaf,0xd3,0x54,0x96,0x4e,0xc1,0x63,0xe7,0x95,0x9c,0x09,0x2a,0x6c,0xa1,0x74,0x61,0x3f,0xd2,0x9d,0xfb,0x62,0x58,0x05,0x02,0xf2,0xcb,0xf5,0x1a,0xb9,0x62,0x7c,0x88,0xcb,0x61,0x81,0xb5,0x8f,0xe3,0x75,0x0b,0xd3,0x5c,0x4e,0x42,0x7b,0xf5,0x29,0xd7,0x97,0x79,0xd7,0x95,0xa7,0xec,0xd9,0x8c,0xc0,0xcf,0x58,0xa9,0x96,0x2f,0x11,0xdf,0x97,0xd1,0x4a,0x4d,0x81,0xb9,0x21,0x63,0x67,0x07,0x90,0x84,0x2c,0x37,0x94,0x3d,0xd0,0x56,0xce,0x3d,0xba,0x90,0x0c,0xf4,0x62,0xd8,0xbd,0xc1,0x3d,0xa4,0xba,0x0d,0x19,0xa7,0x53,0x5f,0x6c,0x3b,0xc3,0x24,0xff,0xba,0x72,0x80,0x43,0x9d,0xda,0xfb,0xd0,0xd7,0xff,0x42,0x65,0xba,0xa4,0xa3,0xf2,0xdb,0xd6,0x52,0x47,0xeb,0x3b,0xcb,0x95,0x9b,0xe7,0x4f,0xcb,0x77,0x6c,0x5d,0xb7,0x1b,0x0e,0x3a,0x59,0x6c,0x7d,0x72,0xcc,0xa0,0x53,0x8f,0x3b,0x33,0xc8,0xea,0x56,0x75,0x43,0x55,0x1f,0x4b,0x9d,0xb3,0xc4,0x1d,0xca,0xd9,0xde,0x0b,0x06,0x9b,0xbb,0xa8,0x29,0xed,0xd5,0xfa,0xf2,0x76,0x23,0x95,0x67,0x7c,0xa9,0x47,0x36,0x43,0x2e,0xc5,0x94,0x72,0x52,0x2d,0xa9,0xa8,0x33,0x0a,0xbe,0x75,0xc5,0x2e,0x16,0xb6,0x86,0xda,0x71,0xe7,0xb3,0xdf,0x1b,0xdf,0xb6,0xef,0xda,0x3c,0x2c,0x3f,0xae,0xb9,0x5b,0x9d,0xa4,0x3b,0xf3,0xc4,0x84,0x75,0x26,0x3e,0x3a,0x37,0xd6,0xc3,0x69,0x38,0x78,0xca,0x9e,0xe5,0x70,0xd0,0xf2,0x85,0x29,0x29,0xc7,0xd3,0x3d,0x63,0x7c,0x39,0xad,0x4f,0x9e,0xbf,0x19,0x08,0x4c,0xc8,0xb2,0x8d,0xc0,0x8a,0x84,0xf9,0x3f,0xd3,0xd9,0xb5,0xe6,0x08,0x92,0x7c,0x63,0xc0,0x5f,0x14,0x91,0x6c,0x9d,0xc7,0xf0,0x70,0x64,0xc2,0xa1,0xbb,0xf3,0xd5,0x08,0x3c,0x41,0x5d,0xbc,0x64,0x48,0x42,0x5e,0x2e,0xa9,0xee,0x08,0x92,0x4b,0xbf,0x8c,0x3a,0x70,0x5c,0x7f,0x3e,0xae,0x51,0x36,0xd2,0x8e,0x54,0x75,0x4b,0x57,0xdb,0x98,0x3b,0x36,0x32,0x21,0xe9,0x19,0x50,0xfc,0x58,0x85,0xb3,0xde,0xd4,0xfd,0xeb,0xe6,0x36,0x43,0xe6,0x8c,0xb0,0x5b,0x73,0xb6,0x6b,0x26,0x1a,0x9e,0x7b,0x3c,0x5e,0x64,0xf8,0x77,0x51,0xe6,0xd7,0x29,0xb9,0x01,0x96,0x6a,0xde,0x55,0x4a,0x56,0x23,0x79,0x66,0x7b,0x4a,0x52,0xe1,0x2c,0xa0,0x1f,0x99,0x8a,0x58,0xff,0xc6,0xb8,0xfd,0xc7,0x83,0x7b,0x1a,0x05,0x6b,0xe2,0x94,0x5d,0x1d,0x0e,0x0d,0x46,0x9b,0xf9,0x5c,0xb7,0x57,0x3a,0x26,0x92,0x13,0x58,0x69,0x90,0xcc,
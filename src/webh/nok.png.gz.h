@@ -1,4 +1,5 @@
 #define nok_png_gz_len 610
+#define nok_png_gz_hash "7cffba208426b646"
 const uint8_t nok_png_gz[] PROGMEM = {
 0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x01,0x4b,0x02,0xb4,0xfd,0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,0x44,0x52,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x08,0x06,0x00,0x00,0x00,0x1f,0xf3,0xff,0x61,0x00,0x00,0x00,0x04,0x67,0x41,0x4d,0x41,0x00,0x00,0xaf,0xc8,0x37,0x05,0x8a,0xe9,0x00,0x00,0x00,0x19,0x74,0x45,0x58,0x74,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x00,0x41,0x64,0x6f,0x62,0x65,0x20,0x49,0x6d,0x61,0x67,0x65,0x52,0x65,0x61,0x64,0x79,0x71,0xc9,0x65,0x3c,0x00,0x00,0x01,0xdd,0x49,0x44,0x41,0x54,0x38,0xcb,0xa5,0x93,0x6b,0x6b,0x1a,0x41,0x14,0x86,0xf7,0x6b,0x48,0x20,0x21,0x29,0xa6,0x34,0x84,0x96,0x5e,0x63,0x9b,0xa0,0xa8,0xa1,0xc6,0x98,0x14,0x34,0x65,0x8d,0x4a,0x9b,0xda,0x4b,0xa4,0x69,0x28,0xbd,0xd1,0xcb,0xff,0xcc,0x87,0x5c,0x20,0x7f,0xa3,0xc4,0x95,0xa0,0xb2,0xce,0xae,0xbb,0x3b,0x4f,0x67,0x56,0x37,0x55,0x94,0x96,0xd2,0x0f,0x2f,0x0b,0xc3,0xbe,0xcf,0x99,0xf7,0x9c,0x33,0x06,0x60,0xfc,0x8f,0xc6,0x0f,0x0d,0xc3,0x0a,0x8f,0x07,0x0a,0x46,0x65,0xfd,0x19,0x60,0x18,0x0d,0x1e,0xdd,0x87,0xef,0xef,0xe0,0xdb,0x01,0xf2,0xeb,0x5b,0xe4,0x97,0x3a,0xf2,0xd3,0x1b,0xe4,0x87,0x57,0xf8,0x0f,0x6e,0xe3,0x19,0x46,0x7b,0x32,0x20,0x32,0xff,0x38,0x04,0xb3,0x88,0xcc,0x64,0x90,0xa9,0x14,0x41,0x32,0x49,0xb0,0xb6,0x86,0x9f,0xcf,0xe2,0x1f,0x3e,0xa7,0x77,0xef,0x26,0x42,0xff,0x3b,0x02,0x18,0x36,0x1f,0xd4,0xe1,0xfc,0x1c,0x59,0xab,0x11,0x24,0x12,0x04,0xab,0xab,0xf8,0x95,0x0a,0xf2,0xec,0x0c,0xaf,0x5a,0xc2,0xdb,0xdf,0xc5,0xbd,0xb3,0x8c,0x3d,0x80,0x44,0x80,0xfe,0x95,0x55,0x65,0x6d,0xa6,0xd3,0x81,0x66,0x13,0xbf,0x5a,0xc5,0x2f,0x97,0xc1,0x52,0xd1,0xdb,0x6d,0xe4,0xc9,0x09,0xbd,0xc4,0x43,0x7a,0x2f,0x0a,0x74,0x42,0xeb,0x10,0x20,0xcc,0x9b,0x4e,0x13,0xec,0xed,0x85,0xe6,0x08,0x12,0x4a,0x9b,0x15,0xa4,0xb7,0xbd,0x8d,0xb3,0xb8,0x88,0xfb,0xec,0x09,0xad,0x61,0x80,0xee,0xb0,0xfc,0xbc,0xff,0x3b,0xaf,0xba,0x72,0x64,0x0c,0xa5,0xcc,0xee,0xd6,0x16,0x4e,0x2c,0x86,0x58,0x58,0xc0,0xa9,0xe4,0x27,0x00,0x3e,0xbe,0xee,0xe7,0x8d,0xc7,0xf1,0x4b,0xa5,0x11,0x80,0xae,0xee,0xe6,0x72,0x88,0xf9,0x79,0xba,0xb3,0xb3,0x38,0xa5,0xec,0x38,0x20,0x78,0x5f,0xc3,0x5f,0x59,0xc1,0x37,0xcd,0xab,0xcc,0xfa,0xab,0xcd,0xb4,0x5a,0xc8,0x8b,0x0b,0x84,0x9a,0x8c,0x3d,0x3d,0x8d,0xf3,0x74,0x9d,0xcb,0x61,0x80,0xa7,0x01,0x6a,0x44,0xde,0xe3,0x14,0xf2,0xf4,0xb4,0x5f,0xb5,0xd1,0xc0,0xdd,0xdc,0xc4,0xd9,0xd8,0x08,0xcd,0x52,0x41,0x82,0xa3,0x23,0xba,0xcb,0xd7,0x11,0xc5,0xf4,0x28,0xc0,0x55,0x1b,0xa6,0xe7,0xeb,0xd5,0xcb,0x78,0x66,0x81,0xe0,0xf8,0x38,0x34,0xeb,0xbc,0xdd,0xb9,0x39,0x84,0x6e,0xae,0x32,0x8b,0xf5,0x24,0x62,0x27,0x43,0x7b,0xe9,0x1a,0x4d,0xc3,0xf8,0x39,0xb2,0x48,0x6a,0x39,0x2c,0x3d,0xdf,0xde,0xcb,0x1d,0xdc,0xf8,0xdd,0xab,0xbc,0xf6,0xcc,0x0c,0xf6,0xd4,0x14,0xf6,0x52,0x2c,0xac,0xdc,0x1a,0x32,0x8f,0xad,0xb2,0x5a,0x0e,0xcb,0xbe,0x75,0x03,0xb7,0x9a,0xc7,0xd9,0xcd,0xe1,0x98,0xd9,0x30,0xaf,0x28,0x66,0x10,0x85,0xd4,0x98,0x79,0xe2,0x63,0x52,0xdd,0xb5,0x74,0x87,0x23,0x5d,0x0e,0xd4,0xec,0xab,0xf9,0xf7,0xd7,0xf8,0x8f,0xfa,0x05,0xe7,0x95,0xb8,0x83,0xfd,0x9e,0xdd,0xbf,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82,0x2d,0xeb,0xf7,0x52,0x4b,0x02,0x00,0x00
 };
\ No newline at end of file
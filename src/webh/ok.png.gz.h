@@ -1,4 +1,5 @@
 #define ok_png_gz_len 804
+#define ok_png_gz_hash "61ca2331e26dd2dc"
 const uint8_t ok_png_gz[] PROGMEM = {
 0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x01,0x0d,0x03,0xf2,0xfc,0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,0x44,0x52,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x08,0x06,0x00,0x00,0x00,0x1f,0xf3,0xff,0x61,0x00,0x00,0x00,0x04,0x67,0x41,0x4d,0x41,0x00,0x00,0xaf,0xc8,0x37,0x05,0x8a,0xe9,0x00,0x00,0x00,0x19,0x74,0x45,0x58,0x74,0x53,0x6f,0x66,0x74,0x77,0x61,0x72,0x65,0x00,0x41,0x64,0x6f,0x62,0x65,0x20,0x49,0x6d,0x61,0x67,0x65,0x52,0x65,0x61,0x64,0x79,0x71,0xc9,0x65,0x3c,0x00,0x00,0x02,0x9f,0x49,0x44,0x41,0x54,0x38,0xcb,0xa5,0x93,0xeb,0x4b,0x53,0x61,0x1c,0xc7,0xfd,0x3b,0x76,0xce,0x76,0x6c,0x03,0x09,0x64,0x44,0x21,0x82,0x84,0x50,0x7b,0x15,0x24,0x12,0x3b,0x9a,0x0d,0xc5,0xbc,0x2c,0x4b,0xd3,0xdd,0xbd,0xd2,0x36,0x63,0xd8,0x4c,0x8b,0x32,0x72,0x5e,0xc6,0x48,0x29,0x2d,0xb3,0xd4,0x6a,0x73,0x4e,0x6d,0xea,0xd4,0xe6,0xd6,0x94,0x32,0x71,0xd9,0x51,0x42,0xcc,0xbd,0xe9,0x42,0xb5,0x61,0x74,0xb1,0x6f,0xe7,0xec,0xc5,0x4c,0x12,0x23,0x7a,0xe0,0x0b,0x0f,0x0f,0xcf,0xe7,0xf3,0x7b,0xae,0x71,0x00,0xe2,0xfe,0x27,0x7f,0x0c,0x14,0xf8,0x0e,0x89,0x72,0xa7,0x0f,0xea,0xb3,0x3d,0x29,0x4c,0xc6,0xe3,0xfd,0x61,0xe9,0x88,0x38,0x2c,0x75,0x25,0x32,0x52,0x67,0xa2,0x3e,0xdd,0xbe,0x57,0xb4,0xab,0x20,0xcf,0x9b,0x4a,0xcb,0x3c,0xc9,0x21,0x9d,0x47,0x86,0x9b,0x41,0x0b,0xfa,0x96,0xbb,0xa2,0xe9,0x5c,0x6c,0x46,0x89,0xeb,0x18,0x24,0xbd,0x54,0x48,0xd2,0x43,0xd1,0x3b,0x0a,0xd8,0xaa,0x74,0xe6,0x78,0x52,0xe4,0xea,0x9c,0x11,0xce,0xd5,0x7e,0xd8,0x5e,0x5e,0x83,0x69,0xae,0x32,0x1a,0xae,0xef,0x58,0xed,0x43,0xe3,0x4c,0x15,0x0e,0xd8,0xf8,0x91,0x64,0x1b,0x9f,0xde,0x26,0xc8,0xf1,0xa4,0x08,0x33,0xdd,0x49,0xeb,0x1c,0xcc,0x4d,0xac,0x09,0x94,0xa1,0xc2,0x5f,0x02,0xcd,0xcc,0x19,0xe8,0xd8,0x94,0xb3,0xa9,0xf6,0x9d,0x85,0xfd,0xf5,0x3d,0x5c,0x9c,0xaa,0x80,0xd8,0x42,0xae,0x8b,0xaf,0x93,0xc2,0x98,0x40,0xe6,0x4e,0x32,0xa8,0xc6,0xb2,0xa2,0x95,0x39,0x98,0x03,0x55,0xde,0x53,0x50,0x4c,0x17,0x42,0x31,0x55,0x00,0xf5,0x54,0x21,0xdc,0x6b,0x83,0x30,0x78,0x95,0x70,0xb0,0x92,0xdc,0x9e,0x23,0x48,0xb8,0x42,0x1a,0x62,0x82,0x8c,0x11,0x31,0xd3,0x19,0x6c,0x86,0x35,0xd8,0x84,0x0a,0x5f,0x31,0x94,0x4f,0xe4,0x2c,0x98,0x0f,0xe5,0x24,0x1b,0x4f,0x3e,0xc6,0xdf,0xb8,0xc0,0xb5,0x50,0x64,0x0d,0x6d,0xcf,0x1b,0x61,0x9b,0x6b,0x44,0x7c,0x3d,0xc9,0xc4,0x04,0x47,0xed,0x09,0x1b,0x0f,0x56,0x6e,0xa3,0x36,0xa0,0x81,0xd6,0x5b,0xc4,0xae,0x64,0x00,0x8b,0x1f,0xe6,0xa1,0x9a,0x28,0xc4,0xd8,0xda,0x50,0x14,0xfe,0xb1,0xf9,0x1d,0x6d,0xcf,0x2e,0xc1,0x30,0x51,0x8c,0xbe,0x60,0x27,0x04,0x46,0x62,0x23,0x26,0x90,0xdc,0xa7,0x36,0xfa,0x97,0xbb,0x61,0xf4,0xab,0x50,0xeb,0xd7,0xe2,0xd3,0xd7,0x8f,0x51,0xe8,0xfd,0x97,0xb7,0x31,0xd8,0x32,0x5b,0x0f,0xb5,0x2b,0x1b,0x7a,0xf7,0x69,0xf4,0x07,0x3b,0x20,0xa8,0xf9,0x5d,0xd0,0x43,0x31,0x37,0xe6,0x9b,0xd0,0xbe,0x70,0x19,0xba,0x49,0x39,0xcc,0xbe,0x6a,0x44,0xbe,0x7d,0x8e,0xc2,0x9b,0x3f,0x37,0x61,0x79,0x7a,0x01,0x65,0xce,0x2c,0x68,0x58,0x41,0x4b,0xa0,0x0e,0xed,0x5e,0x33,0xa8,0x2a,0x62,0x6b,0x0b,0xa9,0xb7,0x04,0x06,0xf9,0x40,0x1a,0xec,0x2b,0x77,0x51,0x3d,0x21,0x87,0xda,0x7d,0x12,0x75,0xd3,0xe5,0x58,0x7a,0xb7,0x80,0xb6,0xd9,0x06,0x94,0x0e,0x1e,0x87,0xc2,0x71,0x02,0x3a,0x67,0x0e,0xec,0xaf,0xba,0x91,0x6e,0x3d,0x0c,0xaa,0x92,0xd8,0x3a,0xc4,0x64,0x2b,0x5f,0xb8,0x8f,0xbd,0x1a,0xb3,0x47,0x83,0x87,0xcc,0x1d,0x54,0x8e,0xe6,0x41,0x3b,0x9c,0x03,0xd5,0x90,0x0c,0x4a,0x07,0x17,0x0e,0xce,0xc6,0xa3,0xa5,0x2e,0x18,0x87,0x8a,0x21,0x50,0xf3,0xd6,0x29,0x35,0x21,0xdc,0xf6,0x90,0x12,0x9b,0x48,0x3a,0xbe,0x81,0x88,0x98,0xdc,0x65,0x70,0xb0,0x92,0xd6,0x80,0x19,0xfa,0xd1,0x22,0x9c,0x1b,0x96,0xa3,0x95,0xdd,0x82,0x9d,0x85,0xf5,0xce,0x22,0xf0,0x4b,0x79,0x11,0x16,0xa6,0x77,0x7c,0xca,0x7b,0x1a,0x48,0x9a,0x32,0x11,0x21,0x69,0x87,0x04,0xed,0x7e,0x33,0x7a,0x5f,0x58,0xd1,0x3b,0x6f,0x85,0xc5,0x6b,0x42,0x5a,0x4b,0x2a,0x04,0x0a,0x5e,0x88,0x52,0x11,0xf4,0xae,0x9f,0x89,0x3a,0x4f,0x8a,0x28,0x03,0xa1,0xa7,0x6a,0x08,0x46,0xa0,0xe5,0x85,0x05,0x2a,0x5e,0x98,0xad,0xc8,0xb0,0xd1,0x53,0xa5,0x84,0xe8,0xaf,0xbf,0xf1,0x5f,0xf3,0x0b,0x67,0xd0,0xac,0xe5,0x79,0xba,0xd4,0x63,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82,0xc5,0xa0,0x11,0xc9,0x0d,0x03,0x00,0x00
 };
\ No newline at end of file
@@ -1,4 +1,5 @@
 #define required_css_gz_len 27456
+#define required_css_gz_hash "3c014d943a8f33b3"
 const uint8_t required_css_gz[] PROGMEM = {
 0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xed,0xbd,0x6d,0x93,0xe3,0xb8,0x91,0x20,0xfc,0x7d,0x7e,0x05,0xb7,0x3b,0x3a,0xba,0xcb,0x23,0xa9,0x49,0xea,0xbd,0x2a,0x66,0xc2,0x2f,0xb1,0x7b,0xbb,0x11,0x63,0x7f,0x58,0xdf,0x45,0x5c,0xc4,0x5c,0x9f,0x83,0x12,0x29,0x89,0x6e,0x4a,0xa4,0x49,0xa9,0x8b,0x35,0x15,0x75,0xbf,0xfd,0xc1,0x2b,0x89,0x97,0x4c,0x90,0x54,0xa9,0xc6,0xf6,0x3e,0xeb,0xf1,0x4c,0x51,0x60,0x22,0x91,0xc8,0x4c,0x24,0x32,0x41,0x20,0xf1,0xf9,0x37,0xde,0x29,0xfa,0xb6,0x89,0xca,0xf1,0x2e,0xad,0x93,0x78,0x9c,0x25,0xbb,0xb3,0xf7,0x9b,0xcf,0xdf,0xfd,0xf6,0x98,0xc4,0x69,0xe4,0x7d,0x3a,0x46,0xf5,0xf8,0x31,0x8d,0xcf,0x87,0x7b,0x6f,0xb9,0x58,0x16,0xf5,0x9d,0xf7,0xfc,0x9d,0xe7,0x4d,0x44,0x9d,0x73,0x52,0x9f,0x59,0x81,0xe7,0x1d,0xa3,0x72,0x9f,0x9e,0xc6,0xe7,0xbc,0xb8,0xf7,0x82,0x79,0x51,0x3f,0xa8,0xa5,0x9b,0xfc,0x7c,0xce,0x8f,0xea,0x8b,0x22,0x8a,0xe3,0xf4,0xb4,0x1f,0x97,0xe9,0xfe,0x70,0x86,0x5e,0x50,0x42,0xda,0xf2,0x97,0xef,0x5e,0xbe,0xfb,0x6e,0x62,0x53,0x4a,0xdb,0x96,0x35,0x78,0xd3,0x3e,0xaf,0x20,0x68,0x0e,0xe7,0xe2,0x77,0x91,0x57,0xe9,0x39,0xcd,0x4f,0xf7,0x1e,0xab,0x4d,0x8b,0x36,0x79,0x19,0x27,0xe5,0xb8,0x8c,0xe2,0xf4,0x52,0xdd,0x7b,0x3e,0x2d,0xfb,0x65,0x9c,0x9e,0xe2,0xa4,0xa6,0x78,0xc2,0xb5,0x0a,0x24,0xc8,0x2c,0x6a,0x2f,0x8e,0xaa,0x43,0x12,0x7b,0xfb,0x32,0x7a,0xa2,0x00,0x9f,0x7f,0xc3,0xc8,0xde,0xe5,0xa7,0xf3,0x78,0x17,0x1d,0xd3,0xec,0xe9,0xde,0xfb,0x96,0x94,0x71,0x74,0x8a,0x1e,0xda,0x37,0x55,0xfa,0x4b,0x42,0xaa,0x87,0xb2,0x97,0xac,0xf0,0x31,0xe1,0x58,0x43,0xdf,0xe7,0xa5,0x84,0xef,0x70,0x37,0x65,0x11,0xf9,0xc3,0xba,0xbc,0xcb,0xf2,0x88,0x54,0xa4,0xef,0x68,0x4d,0xce,0x65,0xd6,0x85,0xce,0xfa,0x3f,0x66,0xa9,0x8a,0xe2,0x94,0x9f,0x12,0xde,0x0d,0xef,0x0f,0xd1,0x69,0x9b,0x64,0x5e,0x9c,0xec,0xa2,0x4b,0x76,0xf6,0x08,0x9c,0xd2,0x0c,0xa5,0xcd,0xe4,0x6a,0x9f,0xb6,0x7e,0x8c,0x70,0x19,0xc9,0xc2,0x46,0x3b,0x44,0x79,0x96,0x9e,0x92,0xf1,0xa1,0x61,0x4e,0xef,0xa6,0x26,0x71,0x99,0x17,0x71,0xfe,0x78,0x1a,0x1f,0x93,0xd3,0x85,0xb5,0xab,0x6a,0xe5,0x78,0x2a,0xf0,0x8b,0x42,0xa9,0x61,0xfd,0x1a,0xf0,0x26,0x79,0x91,0x9c,0x3c,0xa0,0x8d,0x56,0xb5,0xa2,0x4d,0x95,0x67,0x97,0x33,0x63,0xa8,0x21,0xa2,0x4d,0xb4,0xfd,0xba,0x2f,0xf3,0xcb,0x29,0x1e,0x6f,0xf3,0x2c,0x2f,0xef,0xbd,0xf7,0xbb,0xdd,0x8e,0x51,0x43,0x48,0x11,0x7c,0x0d,0x16,0x82,0x42,0xa1,0x54,0x82,0x41,0xf7,0x1e,0x19,0x05,0x9e,0xaf,0x8e,0x28,0xc2,0x17,0x5a,0xe4,0xb5,0x8a,0x23,0x55,0x95,0x2b,0x29,0xa1,0x23,0x8d,0xbd,0xf7,0xdb,0xed,0xf6,0x01,0x7c,0x53,0xee,0x37,0xd1,0x27,0x7f,0xe4,0xf1,0xff,0x4f,0x82,0xf9,0x9d,0xa2,0xec,0x82,0x1a,0x9f,0xc1,0x07,0x9c,0x22,0x73,0xb0,0x90,0x7f,0x66,0xe4,0xed,0x8c,0xbf,0x25,0xaa,0xbc,0xf9,0x9a,0x9e,0x89,0x24,0xeb,0x71,0x75,0x88,0x08,0x7f,0x28,0xc8,0x82,0x56,0xa7,0x74,0x9a,0xad,0x2d,0x65,0x73,0xfd,0xa1,0x89,0x7c,0x88,0x8a,0x56,0xc9,0xb9,0xd1,0x4f,0xc1,0x1c,0x6f,0x4b,0x86,0x52,0x44,0x34,0xa6,0xa4,0x5c,0xb0,0x65,0xf8,0xfd,0xa4,0x01,0x18,0xb9,0x5f,0x8f,0x77,0xd9,0x85,0xb0,0x46,0x55,0x57,0xae,0x22,0xe1,0xaa,0x51,0x91,0xa8,0x28,0xc6,0x47,0x02,0x3d,0xa6,0xb5,0x92,0x13,0x60,0x80,0x24,0x68,0x3f,0x03,0x6a,0x98,0xb2,0x66,0x84,0x49,0x45,0x20,0x88,0x20,0x60,0xad,0x53,0x1d,0x00,0x4a,0xb7,0xcc,0x8e,0xad,0xdc,0xad,0x40,0x66,0xa3,0xa1,0x70,0xbe,0x1e,0x52,0x17,0x1a,0x9b,0xc8,0xe8,0x34,0xc6,0xe7,0xdc,0x57,0x66,0x80,0xcf,0xfa,0x6c,0xe5,0x49,0xa4,0xfd,0x67,0xac,0x01,0x83,0xbb,0xb5,0x5e,0x9e,0x27,0xc7,0xec,0x74,0x3a,0xed,0xd9,0x69,0x1c,0xe5,0xfd,0x21,0xff,0x86,0xc9,0xad,0x27,0x86,0x5d,0xbe,0xbd,0x54,0x06,0x69,0xe1,0x82,0xfe,0xc3,0x39,0x08,0x59,0x9b,0x39,0xfd,0xe7,0x55,0xc4,0x4f,0xa2,0xed,0x39,0xfd,0x96,0xfc,0x18,0x5d,0x4b,0x7b,0x83,0xe0,0x75,0x2c,0x68,0xd1,0x40,0x7c,0x10,0x66,0x15,0x64,0xc2,0x74,0xba,0x8c,0x36,0xcb,0xd7,0x31,0x21,0x4e,0xab,0x68,0x93,0x25,0xf1,0x2b,0xd8,0xd0,0xa2,0x78,0x25,0x23,0x14,0x44,0x10,0x2b,0x96,0xcb,0xa5,0x3a,0x74,0x2e,0x45,0x1c,0x9d,0x13,0x2f,0xa9,0x0a,0x62,0x07,0xf6,0xc9,0x77,0xef,0x77,0x69,0x96,0x10,0x87,0xa7,0xb8,0x9c,0x47,0x1e,0xfb,0xc3,0xea,0xcb,0xc9,0xc8,0xf7,0x3f,0xd0,0xda,0x72,0x22,0x9e,0xcd,0xc0,0x99,0x60,0xa6,0xce,0xa9,0x7c,0x0e,0xf7,0xa2,0xcb,0x39,0x67,0x73,0xa0,0xe2,0xfa,0x90,0x29,0xec,0xbb,0x17,0x32,0x4c,0xdb,0x76,0x5a,0xf9,0x50,0xa9,0x05,0xf4,0x1f,0x75,0xb2,0xf2,0x15,0x17,0x81,0x4d,0x46,0x0c,0xc3,0x77,0x2a,0xd5,0xaa,0xf5,0x15,0x15,0x80,0x49,0x30,0x8e,0x63,0xcb,0xab,0x90,0x9d,0xa1,0x0e,0xec,0x38,0xca,0xd2,0xfd,0xa9,0x9d,0xaa,0x09,0x53,0x8b,0x2c,0x22,0x6e,0xdc,0x26,0xcb,0xb7,0x5f,0x69,0xc9,0xf6,0x52,0x56,0x94,0xa1,0x45,0x9e,0x12,0xab,0x5f,0x3e,0xbc,0x2d,0x93,0x48,0x17,0x89,0xd4,0x47,0xde,0xfb,0x82,0xce,0x84,0xa5,0xc1,0xab,0x76,0x40,0x1b,0x1c,0x6b,0x1a,0xa3,0xd8,0x25,0x16,0xac,0x72,0xb0,0x8c,0xc2,0xcd,0x4a,0xe9,0x88,0xde,0x0d,0x89,0x62,0x97,0x97,0xc7,0xf7,0x97,0x82,0xb8,0x32,0xf1,0x5f,0xe8,0x33,0x20,0x37,0xe1,0xc4,0xb4,0x46,0x77,0xe6,0xaf,0xf4,0xde,0x2e,0xe7,0x4a,0x6f,0x1b,0x69,0x49,0x73,0x6f,0x10,0x3f,0xb7,0xe5,0xb2,0x4d,0x28,0xd3,0x29,0x39,0x87,0x90,0x11,0x00,0xbf,0x4c,0x8f,0xfb,0xf7,0xc5,0x21,0x3f,0xe7,0x62,0x10,0xc8,0xbe,0xc8,0x96,0x35,0x22,0x17,0xf3,0x0f,0xbc,0xcc,0x16,0xb6,0x31,0xff,0xa8,0xd5,0x59,0x71,0xd9,0xa2,0xa5,0xcd,0xc6,0xe9,0xb7,0xf7,0x7c,
 0x60,0xfd,0x25,0x3d,0xed,0x72,0xe1,0x75,0x36,0x0d,0xcd,0x79,0x43,0x92,0x17,0x12,0x9b,0x11,0x17,0x85,0x73,0xe1,0x35,0x50,0x6c,0x87,0x24,0x2b,0xfe,0xb2,0x39,0x9f,0x2a,0x13,0xd7,0xda,0xd7,0x70,0x85,0x2a,0x5f,0x6d,0x9e,0x3c,0x50,0x9a,0x55,0x75,0xde,0x65,0x09,0xe3,0xed,0x5f,0x2f,0xd5,0x39,0xdd,0x3d,0x49,0x17,0xe6,0xde,0xab,0x8a,0x68,0x9b,0x8c,0x37,0xc9,0xf9,0x31,0x49,0x4e,0x0d,0x19,0xd4,0xcd,0x51,0x7d,0x68,0x9d,0x1d,0x36,0x33,0x68,0x45,0xe6,0xb7,0xfe,0x8f,0xec,0xa9,0x38,0xa4,0x04,0x7b,0xf5,0x1d,0x19,0xef,0xdf,0xfd,0x56,0x84,0x46,0xdb,0x84,0xc7,0x1d,0x6a,0xa0,0xf4,0xb1,0x85,0xf5,0xfe,0x3d,0xca,0x76,0x64,0x8c,0xee,0xab,0x8f,0x14,0x7f,0x55,0x6e,0xef,0xbd,0x4b,0x99,0x7d,0x9a,0x4c,0x3e,0xd3,0x2a,0xd5,0xe7,0x7d,0x03,0x3a,0x79,0xcc,0x77,0xbb,0x3b,0x8f,0x2a,0x64,0x74,0xfe,0xf4,0x91,0xfe,0xfa,0xc8,0x5d,0xc4,0x49,0x03,0x64,0x78,0xe6,0x65,0x92,0x45,0x74,0xce,0x60,0xac,0x62,0x31,0x88,0x08,0x35,0x58,0xa7,0xc6,0x42,0xeb,0x1a,0x56,0xa5,0x27,0x66,0x2d,0x1a,0x9d,0xe8,0x49,0x34,0x1f,0xca,0xe7,0xa7,0x2c,0xa1,0x81,0x15,0xa1,0x2e,0x6b,0x4a,0x65,0xac,0x37,0xe3,0xb1,0x9e,0x66,0x8c,0x02,0xd5,0x85,0xe6,0x38,0x8e,0x79,0x7e,0x3e,0xb0,0x71,0x12,0x9d,0xce,0x29,0x91,0x6b,0x54,0xf1,0xa0,0x75,0x7c,0xcc,0x7f,0x19,0xe7,0x55,0x6d,0xc1,0xd1,0x78,0xb4,0xda,0x46,0x59,0xa2,0xf3,0x61,0x1c,0x55,0x44,0x17,0xd2,0xea,0xeb,0xfd,0x26,0x21,0x0c,0xe3,0x32,0x68,0x24,0xff,0xee,0xff,0xf8,0x7e,0x18,0xbd,0x33,0xaa,0x14,0x19,0x19,0x89,0x28,0xf8,0xc6,0x04,0x4f,0x2e,0xa5,0x80,0x26,0xde,0xba,0x56,0x9c,0x23,0x58,0x42,0x3f,0xda,0x9a,0x58,0x48,0x18,0x84,0xb6,0x1a,0x86,0x41,0x68,0xc2,0x6f,0xb3,0xfc,0x12,0x63,0xf0,0x0b,0x3f,0xb0,0xa8,0x3c,0x7d,0x4b,0x32,0x32,0x89,0x62,0x55,0x96,0xfe,0xda,0xe2,0x43,0x72,0xda,0xa6,0x19,0x5e,0x61,0x67,0x56,0xd8,0x67,0x51,0x85,0xf5,0x21,0xf1,0x6d,0x9a,0x8e,0x97,0x2a,0xdd,0xe2,0xf0,0x56,0x9f,0xab,0x24,0x2a,0xb7,0x07,0xbc,0xc2,0xd4,0xac,0x70,0x20,0x15,0xce,0x38,0xfc,0xdc,0x6a,0xe0,0x1c,0x95,0x38,0xf8,0x02,0x02,0x1f,0x27,0xc7,0xe2,0xfc,0x84,0x57,0x5a,0x9a,0x95,0x2e,0x55,0xe2,0x68,0x63,0x65,0x82,0x93,0xd9,0xfe,0x88,0x83,0x5b,0x32,0x3b,0x1f,0xc6,0x19,0x31,0x4d,0x98,0x98,0x13,0x3f,0xf0,0xed,0x2a,0x38,0xb0,0x25,0x32,0x8a,0x3f,0xad,0x70,0x9e,0xda,0x8a,0x9a,0x63,0x43,0x8f,0x00,0x5b,0x02,0x2b,0x93,0x23,0x71,0x08,0xf1,0x0a,0x33,0xb3,0xc2,0x2f,0x79,0x7e,0x24,0xce,0x10,0x5e,0xc3,0x92,0x31,0xab,0x91,0x5f,0x1c,0x5d,0xb0,0xe4,0x4c,0x0c,0x2c,0x0e,0x6d,0x09,0xb8,0x22,0x93,0x50,0x84,0x0d,0x1b,0x52,0xc1,0x12,0xf1,0x36,0xdf,0xe3,0xd0,0xb6,0x84,0xcb,0xa8,0xc2,0x25,0x16,0x5a,0xe2,0x3d,0xe4,0x47,0x9c,0xa1,0xa1,0x25,0x60,0xea,0x5d,0xe2,0xe0,0x96,0x74,0xcf,0xa9,0x0b,0xbb,0x2d,0x5f,0xe2,0x49,0xe1,0xe0,0x96,0x74,0xa9,0xab,0x4f,0x9d,0x2f,0x32,0xb3,0xe3,0xf2,0x0a,0x2d,0x11,0xcb,0x6a,0x78,0x15,0x4b,0xc4,0xdc,0xc9,0xc3,0x2b,0x58,0x52,0x4e,0x4f,0x9b,0xbc,0xc6,0xe1,0x2d,0x21,0xd3,0x89,0x75,0xbc,0x4d,0xcb,0xad,0x8b,0xbd,0x96,0xb0,0xcb,0xa4,0x48,0x22,0xbc,0xeb,0x53,0x4b,0xda,0x65,0xb2,0x2b,0x13,0x87,0x7e,0x4c,0x2d,0x81,0xd3,0xe1,0xec,0xe4,0xef,0xd4,0x12,0x3a,0x75,0x0b,0x70,0x70,0x4b,0xe8,0xbb,0x2c,0xc2,0x15,0x7c,0x6a,0x09,0x9d,0x18,0xed,0x98,0x38,0xb2,0xa7,0x04,0x9f,0x4a,0xa6,0x96,0xc8,0xbf,0xe5,0xd9,0xe5,0x98,0x38,0x47,0xea,0xd4,0x12,0xba,0xa8,0x44,0xd5,0x05,0xaf,0x65,0x49,0x5e,0xd4,0xba,0x14,0x78,0x1d,0x4b,0xfa,0x7f,0x2b,0xb7,0x79,0x8c,0x0b,0x7e,0x6a,0x09,0x9e,0xc4,0x2e,0xce,0x1a,0x33,0xdb,0x8c,0x3b,0x98,0x3c,0xb3,0xed,0x78,0xb4,0xc7,0xd9,0x3b,0xb3,0x24,0xbe,0xc9,0x1d,0x66,0x7c,0x66,0x49,0x9c,0x82,0x13,0x0f,0xd9,0x51,0xc5,0x92,0x7a,0x51,0x92,0xd8,0x12,0x87,0xb7,0x04,0xbe,0x8d,0x8e,0x49,0x19,0xe1,0x15,0x2c,0x61,0x53,0x87,0x11,0x07,0xb7,0xa4,0xbc,0xc9,0x33,0xdc,0x1c,0xcc,0x2c,0x01,0xa7,0x67,0xe2,0xa4,0xe2,0xbe,0xcc,0xcc,0x36,0xe3,0x34,0x60,0x11,0x1e,0x30,0x56,0x6b,0x6e,0x0b,0x99,0xd6,0xe2,0xe1,0x10,0x5a,0xc9,0x92,0x35,0x0b,0x8b,0x78,0xfc,0x82,0x56,0xb2,0x24,0xce,0x2b,0xf1,0x50,0x0a,0xaf,0x66,0x49,0x9e,0x57,0x2b,0xdd,0xdd,0xb2,0x84,0xcf,0x6b,0x89,0xc0,0x0c,0xaf,0x67,0x29,0x81,0xd3,0x15,0x99,0x5b,0x2a,0x40,0xbf,0x6d,0x91,0xa8,0xc1,0xcd,0x09,0xc0,0xd2,0xb3,0x5a,0x1d,0x7d,0xb2,0x1d,0x37,0x12,0xf1,0xd1,0xd9,0x71,0xfc,0x2d,0x8d,0x13,0x2c,0x12,0x20,0x15,0x6d,0xb7,0x3b,0xdd,0x9e,0x2f,0x25,0x3e,0xf4,0x17,0x96,0x56,0x1c,0x23,0xba,0x2a,0x5f,0x7e,0x75,0x48,0x6a,0x61,0x0b,0x38,0xa6,0xfc,0xc6,0x2b,0x58,0xa2,0x3d,0xbb,0x06,0xe8,0xc2,0x92,0x69,0x12,0xa7,0x0e,0x70,0xdb,0xf5,0x3e,0x44,0xae,0x3e,0x5b,0xb2,0xdc,0x1e,0x12,0xc7,0x24,0xb4,0xb0,0xa4,0xe8,0xf4,0x2b,0x17,0x96,0xf4,0x48,0xd4,0x58,0x8c,0xe9,0x4a,0xcf,0x63,0x54,0xe2,0x76,0x60,0x61,0x09,0x6f,0x47,0xe2,0xcd,0xee,0x7a,0x4b,0x4b,0x84,0xdd,0x55,0xac,0x61,0xcd,0x42,0x75,0x14,0xdc,0x92,0x77,0x11,0x91,0xc8,0x03,0x87,0xb7,0xc4,0x5d,0xd1,0x75,0x02,0x14,0xdc,0x12,0x37,0x81,0x73,0xd3,0x6f,0x49,0x9c,0xb1,0xaa,0xb3,0x1a,0x10,0x74,0x11,0xc9,0x74,0x56,0xb3,0xe4,0x9f,0xfc,0x35,0xd9,0xe2,0xfa,0xb8,0xb4,0x9d,0xf2,0x43,0xf2,0xad,0xcc,0x3b,0xcc,0xe6,0xd2,0x92,0xbf,0xac,0xe6,0xb6,0x16,0x2b,0x4b,0xfe,0x74,0xcd,0x81,0x45,0x0e,0x78,0x1d,0x3b,0x7c,0xa6,0x4b,0x06,0x1d,0x95,0x2c,0x35,0xe0,0x11,0x56,0x47,0x2d,0x4b,0x19,0xf2,0xaf,0x1d,0x35,0x2c,0x7d,0xf8,0xdb,0x25,0xa9,
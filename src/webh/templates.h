@@ -0,0 +1,858 @@
+// generated by tools/webfilesbuilder from src/websrc/html, do not edit
+#ifndef WEBH_TEMPLATES_H_
+#define WEBH_TEMPLATES_H_
+
+#include "../page.h"
+
+// console.html
+enum class ConsoleField : uint8_t
+{
+  refreshLogs
+};
+const char HTML_CONSOLE_TEXT[] PROGMEM =
+    "<div id='main' class='col-sm-12'>"
+    "<div id='help_btns' class='col-sm-8'>"
+    "<button type='button' onclick='cmd(\"ClearConsole\");document.getElementById(\"console\").value=\"\";' class='btn btn-secondary'>Clear Console</button> "
+    "<button type='button' onclick='cmd(\"ZigRST\");' class='btn btn-primary'>Zigbee Restart</button> "
+    "<button type='button' onclick='cmd(\"ZigBSL\");' class='btn btn-warning'>Zigbee BSL</button> "
+    "<div class='form-check form-check-inline'><input class='form-check-input' id='decode' type='checkbox' onchange='logDecode(this.checked);'>"
+    "<label class='form-check-label' for='decode'>Decode ZNP</label></div>"
+    "</div></div>"
+    "<div id='main' class='col-sm-8'>"
+    "<div class='col-md-12'>Raw data :</div>"
+    "<textarea class='col-md-12' id='console' rows='16' ></textarea>"
+    "</div>"
+    "<script language='javascript'>"
+    "logStream("
+    ");"
+    "</script>";
+constexpr PageSegment HTML_CONSOLE_SEGMENTS[] PROGMEM = {
+    {0, 801, (uint8_t)ConsoleField::refreshLogs},
+    {801, 11, PAGE_NO_FIELD}};
+constexpr PageTemplate<ConsoleField> HTML_CONSOLE = {HTML_CONSOLE_TEXT, HTML_CONSOLE_SEGMENTS, 2};
+
+// error.html
+const char HTML_ERROR_TEXT[] PROGMEM =
+    "<div id='main' class='col-sm-9'>"
+    "</div>";
+constexpr PageSegment HTML_ERROR_SEGMENTS[] PROGMEM = {
+    {0, 38, PAGE_NO_FIELD}};
+constexpr PageTemplate<PageNoField> HTML_ERROR = {HTML_ERROR_TEXT, HTML_ERROR_SEGMENTS, 1};
+
+// ethernet.html
+enum class EthernetField : uint8_t
+{
+  modeEther,
+  ipEther,
+  maskEther,
+  GWEther,
+  disablePingCtrl
+};
+const char HTML_ETHERNET_TEXT[] PROGMEM =
+    "<div id='main' class='col-sm-12'>"
+    "<div id='main' class='col-sm-6'><form method='POST' action='saveEther'>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='dhcp' type='checkbox' name='dhcp' "
+    ">"
+    "<label class='form-check-label' for='dhcp'>DHCP</label>"
+    "</div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='ip'>IP</label>"
+    "<input class='form-control' id='ip' type='text' name='ipAddress' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='mask'>Mask</label>"
+    "<input class='form-control' id='mask' type='text' name='ipMask' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='gateway'>Gateway</label>"
+    "<input type='text' class='form-control' id='gateway' name='ipGW' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='disablePingCtrl' type='checkbox' name='disablePingCtrl' "
+    ">"
+    "<label class='form-check-label' for='disablePingCtrl'><b>Disable</b> gateway ping check</label>"
+    "</div>"
+    "</div>"
+    "<button type='submit' class='btn btn-primary mb-2'name='save'>Save</button>"
+    "</form>";
+constexpr PageSegment HTML_ETHERNET_SEGMENTS[] PROGMEM = {
+    {0, 222, (uint8_t)EthernetField::modeEther},
+    {222, 190, (uint8_t)EthernetField::ipEther},
+    {412, 133, (uint8_t)EthernetField::maskEther},
+    {545, 140, (uint8_t)EthernetField::GWEther},
+    {685, 148, (uint8_t)EthernetField::disablePingCtrl},
+    {833, 190, PAGE_NO_FIELD}};
+constexpr PageTemplate<EthernetField> HTML_ETHERNET = {HTML_ETHERNET_TEXT, HTML_ETHERNET_SEGMENTS, 6};
+
+// fsbrowser.html
+enum class FsbrowserField : uint8_t
+{
+  files
+};
+const char HTML_FSBROWSER_TEXT[] PROGMEM =
+    "<div id='main' class='col-sm-12'>"
+    "<div id='help_btns' class='col-md-11'>"
+    "</div>"
+    "<div id='main' class='col-md-9'>"
+    "<div class='app-main-content'>"
+    "<form method='POST' action='saveFile'>"
+    "<div class='form-group'>"
+    "<div><label for='file'>File : <span id='title'></span></label>"
+    "<input type='hidden' name='filename' id='filename' value=''></div>"
+    "<textarea class='form-control' id='file' name='file' rows='10'>"
+    "</textarea>"
+    "</div>"
+    "<button type='submit' class='btn btn-primary mb-2'>Save</button>"
+    "</form>"
+    "</div>"
+    "</div>"
+    "</div>";
+constexpr PageSegment HTML_FSBROWSER_SEGMENTS[] PROGMEM = {
+    {0, 71, (uint8_t)FsbrowserField::files},
+    {71, 427, PAGE_NO_FIELD}};
+constexpr PageTemplate<FsbrowserField> HTML_FSBROWSER = {HTML_FSBROWSER_TEXT, HTML_FSBROWSER_SEGMENTS, 2};
+
+// general.html
+enum class GeneralField : uint8_t
+{
+  hostname,
+  refreshLogs,
+  webAuth,
+  webUser,
+  webPass,
+  syslogEnable,
+  syslogServer,
+  syslogPort
+};
+const char HTML_GENERAL_TEXT[] PROGMEM =
+    "<div id='main' class='col-sm-12'>"
+    "<div id='main' class='col-sm-6'><form method='POST' action='saveGeneral'>"
+    "<div class='form-group'>"
+    "<label for='hostname'>Hostname</label>"
+    "<input class='form-control' id='hostname' type='text' name='hostname' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='refreshLogs'>Refresh console log</label>"
+    "<input class='form-control' id='refreshLogs' type='text' name='refreshLogs' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='webAuth' type='checkbox' name='webAuth' "
+    ">"
+    "<label class='form-check-label' for='webAuth'>Enable web server authentication</label>"
+    "<br>"
+    "</div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='webUser'>Username</label>"
+    "<input class='form-control' id='webUser' type='text' name='webUser' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='webPass'>Password</label>"
+    "<input class='form-control' id='webPass' type='password' name='webPass' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='syslogEnable' type='checkbox' name='syslogEnable' "
+    ">"
+    "<label class='form-check-label' for='syslogEnable'>Send log to syslog server</label>"
+    "</div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='syslogServer'>Syslog server</label>"
+    "<input class='form-control' id='syslogServer' type='text' name='syslogServer' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='syslogPort'>Syslog port</label>"
+    "<input class='form-control' id='syslogPort' type='number' name='syslogPort' min='1' max='65535' value='"
+    "'>"
+    "</div>"
+    "<button type='submit' class='btn btn-primary mb-2' name='save'>Save</button>"
+    "</form></div>"
+    "</div>";
+constexpr PageSegment HTML_GENERAL_SEGMENTS[] PROGMEM = {
+    {0, 245, (uint8_t)GeneralField::hostname},
+    {245, 167, (uint8_t)GeneralField::refreshLogs},
+    {412, 132, (uint8_t)GeneralField::webAuth},
+    {544, 239, (uint8_t)GeneralField::webUser},
+    {783, 148, (uint8_t)GeneralField::webPass},
+    {931, 142, (uint8_t)GeneralField::syslogEnable},
+    {1073, 253, (uint8_t)GeneralField::syslogServer},
+    {1326, 178, (uint8_t)GeneralField::syslogPort},
+    {1504, 103, PAGE_NO_FIELD}};
+constexpr PageTemplate<GeneralField> HTML_GENERAL = {HTML_GENERAL_TEXT, HTML_GENERAL_SEGMENTS, 9};
+
+// header.html
+enum class HeaderField : uint8_t
+{
+  jqueryHash,
+  bootstrapHash,
+  functionsHash,
+  toastHash,
+  cssHash,
+  logoHash,
+  pageName,
+  logoutLink
+};
+const char HTML_HEADER_TEXT[] PROGMEM =
+    "<head>"
+    "<script type='text/javascript' src='/js/jquery-min.js?v="
+    "'></script>"
+    "<script type='text/javascript' src='/js/bootstrap.min.js?v="
+    "'></script>"
+    "<script type='text/javascript' src='/js/functions.js?v="
+    "'></script>"
+    "<script type='text/javascript' src='/js/toast.js?v="
+    "'></script>"
+    "<script>function logoutButton() {"
+    "var xhr = new XMLHttpRequest();"
+    "xhr.open('GET', '/logout', true);"
+    "xhr.send();"
+    "setTimeout(function(){ window.open('/logged-out','_self'); }, 500);"
+    "}</script>"
+    "<link href='css/required.css?v="
+    "' rel='stylesheet' type='text/css' />"
+    "<link rel='icon' href='img/logo.png?v="
+    "'>"
+    "<title>"
+    " - ZigStar GW</title>"
+    "</head>"
+    "<body>"
+    "<nav class='navbar navbar-expand-lg navbar-light bg-info rounded' style='margin: 10px;'><a class='navbar-brand' href='/'><img src='img/logo.png?v="
+    "'/> <strong>ZigStar GW</strong>"
+    "</a>"
+    "<a class='navbar-brand' href='https://stand-with-ukraine.pp.ua'><img src='https://raw.githubusercontent.com/vshymanskyy/StandWithUkraine/main/badges/StandWithUkraine.svg'> </a>"
+    "<a class='navbar-brand' href='https://stand-with-ukraine.pp.ua'><img src='https://raw.githubusercontent.com/vshymanskyy/StandWithUkraine/main/badges/RussianWarship.svg'> </a>"
+    "<button class='navbar-toggler' type='button' data-toggle='collapse' data-target='#navbarNavDropdown' aria-controls='navbarNavDropdown' aria-expanded='false' aria-label='Toggle navigation'>"
+    "<span class='navbar-toggler-icon'></span>"
+    "</button>"
+    "<div id='navbarNavDropdown' class='collapse navbar-collapse justify-content-md-end'>"
+    "<ul class='navbar-nav'>"
+    "<li class='nav-item'>"
+    "<a class='nav-link' href='/'><i class='glyphicon glyphicon-home'></i>Status</a>"
+    "</li>"
+    "<li class='nav-item dropdown'>"
+    "<a class='nav-link dropdown-toggle' href='#' id='navbarDropdown' role='button' data-toggle='dropdown' aria-haspopup='true' aria-expanded='false'><i  class='glyphicon glyphicon-cog'></i>Config</a>"
+    "<div class='dropdown-menu' aria-labelledby='navbarDropdown'>"
+    "<a class='dropdown-item' href='/general'><i class='glyphicon glyphicon-list-alt'></i>General</a>"
+    "<a class='dropdown-item' href='/serial'><i class='glyphicon glyphicon-wrench'></i>Serial</a>"
+    "<a class='dropdown-item' href='/ethernet'><i class='glyphicon glyphicon-globe'></i>Ethernet</a>"
+    "<a class='dropdown-item' href='/wifi'><i class='glyphicon glyphicon-signal'></i>WiFi</a>"
+    "<a class='dropdown-item' href='/mqtt'><i class='glyphicon glyphicon-screenshot'></i>MQTT</a>"
+    "</div>"
+    "</li>"
+    "<li class='nav-item dropdown'>"
+    "<a class='nav-link dropdown-toggle' href='#' id='navbarDropdown' role='button' data-toggle='dropdown' aria-haspopup='true' aria-expanded='false'><i  class='glyphicon glyphicon-wrench'></i>Tools</a>"
+    "<div class='dropdown-menu' aria-labelledby='navbarDropdown'>"
+    "<a class='dropdown-item' href='/logs'><i  class='glyphicon glyphicon-transfer'></i>Console</a>"
+    "<a class='dropdown-item' href='/fsbrowser'><i class='glyphicon glyphicon-floppy-disk'></i>FSbrowser</a>"
+    "<a class='dropdown-item' href='/esp_update'><i class='glyphicon glyphicon-open'></i>Update ESP32</a>"
+    "<a class='dropdown-item' href='/reboot'><i class='glyphicon glyphicon-repeat'></i>Reboot ESP32</a>"
+    "</div>"
+    "</li>"
+    "<li class='nav-item'>"
+    "<a class='nav-link' href='/help'><i class='glyphicon glyphicon-info-sign'></i>Help</a>"
+    "</li>"
+    "</ul></div>"
+    "</nav>"
+    "<h2>"
+    "</h2>";
+constexpr PageSegment HTML_HEADER_SEGMENTS[] PROGMEM = {
+    {0, 62, (uint8_t)HeaderField::jqueryHash},
+    {62, 70, (uint8_t)HeaderField::bootstrapHash},
+    {132, 66, (uint8_t)HeaderField::functionsHash},
+    {198, 62, (uint8_t)HeaderField::toastHash},
+    {260, 227, (uint8_t)HeaderField::cssHash},
+    {487, 75, (uint8_t)HeaderField::logoHash},
+    {562, 9, (uint8_t)HeaderField::pageName},
+    {571, 180, (uint8_t)HeaderField::logoHash},
+    {751, 2399, (uint8_t)HeaderField::logoutLink},
+    {3150, 21, (uint8_t)HeaderField::pageName},
+    {3171, 5, PAGE_NO_FIELD}};
+constexpr PageTemplate<HeaderField> HTML_HEADER = {HTML_HEADER_TEXT, HTML_HEADER_SEGMENTS, 11};
+
+// help.html
+const char HTML_HELP_TEXT[] PROGMEM =
+    "<div id='main' class='col-sm-9'>"
+    "<script src='https://cdn.jsdelivr.net/npm/@webcomponents/webcomponentsjs@2/webcomponents-loader.min.js'></script>"
+    "<script type='module' src='https://cdn.jsdelivr.net/gh/zerodevx/zero-md@1/src/zero-md.min.js'></script>"
+    "<zero-md src='https://raw.githubusercontent.com/xyzroe/ZigStarGW-FW/main/README.md'></zero-md>"
+    "</div>";
+constexpr PageSegment HTML_HELP_SEGMENTS[] PROGMEM = {
+    {0, 348, PAGE_NO_FIELD}};
+constexpr PageTemplate<PageNoField> HTML_HELP = {HTML_HELP_TEXT, HTML_HELP_SEGMENTS, 1};
+
+// logout.html
+const char HTML_LOGOUT_TEXT[] PROGMEM =
+    "<li class='nav-item'>"
+    "<a class='nav-link' href='javascript:logoutButton();'><i class='glyphicon glyphicon glyphicon-log-out'></i>Logout</a>"
+    "</li>";
+constexpr PageSegment HTML_LOGOUT_SEGMENTS[] PROGMEM = {
+    {0, 143, PAGE_NO_FIELD}};
+constexpr PageTemplate<PageNoField> HTML_LOGOUT = {HTML_LOGOUT_TEXT, HTML_LOGOUT_SEGMENTS, 1};
+
+// mqtt.html
+enum class MqttField : uint8_t
+{
+  mqttEnable,
+  mqttServer,
+  mqttPort,
+  mqttUser,
+  mqttPass,
+  mqttTopic,
+  mqttInterval,
+  mqttDiscovery,
+  mqttMetrics
+};
+const char HTML_MQTT_TEXT[] PROGMEM =
+    "<div id='main' class='col-sm-12'>"
+    "<div id='main' class='col-sm-6'><form method='POST' action='saveMqtt'>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='enb' type='checkbox' name='enable' "
+    ">"
+    "<label class='form-check-label' for='enb'>Enable</label>"
+    "</div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='ip'>Server IP</label>"
+    "<input class='form-control' id='ip' type='text' name='server' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='port'>Port</label>"
+    "<input class='form-control' id='port' type='number' name='port' min='100' max='65000' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='user'>Username</label>"
+    "<input class='form-control' id='user' type='text' name='user' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='pass'>Password</label>"
+    "<input class='form-control' id='pass' type='password' name='pass' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='topic'>Topic</label>"
+    "<input class='form-control' id='topic' type='text' name='topic' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='port'>Refresh interval</label>"
+    "<input class='form-control' id='interval' type='number' name='interval' min='0' max='3600' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='discovery' type='checkbox' name='discovery' "
+    ">"
+    "<label class='form-check-label' for='discovery'>Auto Discovery</label>"
+    "</div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='metrics' type='checkbox' name='metrics' "
+    ">"
+    "<label class='form-check-label' for='metrics'>Publish latency metrics</label>"
+    "</div>"
+    "</div>"
+    "<button type='submit' class='btn btn-primary mb-2'name='save'>Save</button>"
+    "</form>";
+constexpr PageSegment HTML_MQTT_SEGMENTS[] PROGMEM = {
+    {0, 222, (uint8_t)MqttField::mqttEnable},
+    {222, 195, (uint8_t)MqttField::mqttServer},
+    {417, 155, (uint8_t)MqttField::mqttPort},
+    {572, 135, (uint8_t)MqttField::mqttUser},
+    {707, 139, (uint8_t)MqttField::mqttPass},
+    {846, 135, (uint8_t)MqttField::mqttTopic},
+    {981, 172, (uint8_t)MqttField::mqttInterval},
+    {1153, 136, (uint8_t)MqttField::mqttDiscovery},
+    {1289, 207, (uint8_t)MqttField::mqttMetrics},
+    {1496, 172, PAGE_NO_FIELD}};
+constexpr PageTemplate<MqttField> HTML_MQTT = {HTML_MQTT_TEXT, HTML_MQTT_SEGMENTS, 10};
+
+// reboot.html
+const char HTML_REBOOT_TEXT[] PROGMEM =
+    "<meta http-equiv='refresh' content='1; URL=/'>";
+constexpr PageSegment HTML_REBOOT_SEGMENTS[] PROGMEM = {
+    {0, 46, PAGE_NO_FIELD}};
+constexpr PageTemplate<PageNoField> HTML_REBOOT = {HTML_REBOOT_TEXT, HTML_REBOOT_SEGMENTS, 1};
+
+// root.html
+enum class RootField : uint8_t
+{
+  connectedSocket,
+  uptime,
+  deviceTemp,
+  dsTemp,
+  version,
+  debug,
+  hwRev,
+  espModel,
+  espCores,
+  espFreq,
+  espFlashSize,
+  espFlashType,
+  espHeapFree,
+  espHeapSize,
+  stateEther,
+  stateWifi,
+  stateMqtt
+};
+const char HTML_ROOT_TEXT[] PROGMEM =
+    "<script language='javascript'>checkLatestRelease();</script>"
+    "<div id='main' class='col-sm-12'>"
+    "<div id='main' class='col-sm-6'>"
+    "<div class='card'>"
+    "<div class='card-header'>General</div>"
+    "<div class='card-body'>"
+    "<div id='genConfig'>"
+    "<strong>Socket : </strong>"
+    "<br><strong>Uptime : </strong>"
+    "<br><strong>ESP temperature : </strong>"
+    " &deg;C"
+    "<br><strong id='ver' v="
+    ">FW version : </strong>"
+    "<br><strong>Hardware : </strong>"
+    "<br><strong>ESP32 model : </strong>"
+    "<br><strong>CPU : </strong>"
+    " cores @ "
+    " MHz"
+    "<br><strong>Flash : </strong>"
+    " Mb, "
+    "<br><strong>Free heap : </strong>"
+    " / "
+    " KiB"
+    "</div>"
+    "</div>"
+    "</div><br>"
+    "<div class='card'>"
+    "<div class='card-header'>Ethernet</div>"
+    "<div class='card-body'>"
+    "<div id='ethConfig'>"
+    "</div>"
+    "</div>"
+    "</div><br>"
+    "<div class='card'>"
+    "<div class='card-header'>Wifi</div>"
+    "<div class='card-body'>"
+    "<div id='wifiConfig'>"
+    "</div>"
+    "</div>"
+    "</div><br>"
+    "<div class='card'>"
+    "<div class='card-header'>MQTT</div>"
+    "<div class='card-body'>"
+    "<div id='mqttConfig'>"
+    "</div>"
+    "</div>"
+    "</div><br>"
+    "</div>"
+    "</div>";
+constexpr PageSegment HTML_ROOT_SEGMENTS[] PROGMEM = {
+    {0, 250, (uint8_t)RootField::connectedSocket},
+    {250, 30, (uint8_t)RootField::uptime},
+    {280, 39, (uint8_t)RootField::deviceTemp},
+    {319, 7, (uint8_t)RootField::dsTemp},
+    {326, 23, (uint8_t)RootField::version},
+    {349, 23, (uint8_t)RootField::version},
+    {372, 0, (uint8_t)RootField::debug},
+    {372, 32, (uint8_t)RootField::hwRev},
+    {404, 35, (uint8_t)RootField::espModel},
+    {439, 27, (uint8_t)RootField::espCores},
+    {466, 9, (uint8_t)RootField::espFreq},
+    {475, 33, (uint8_t)RootField::espFlashSize},
+    {508, 5, (uint8_t)RootField::espFlashType},
+    {513, 33, (uint8_t)RootField::espHeapFree},
+    {546, 3, (uint8_t)RootField::espHeapSize},
+    {549, 126, (uint8_t)RootField::stateEther},
+    {675, 119, (uint8_t)RootField::stateWifi},
+    {794, 119, (uint8_t)RootField::stateMqtt},
+    {913, 34, PAGE_NO_FIELD}};
+constexpr PageTemplate<RootField> HTML_ROOT = {HTML_ROOT_TEXT, HTML_ROOT_SEGMENTS, 19};
+
+// saved.html
+enum class SavedField : uint8_t
+{
+  msg
+};
+const char HTML_SAVED_TEXT[] PROGMEM =
+    "<div id='main' class='col-sm-12'>"
+    "<div id='main' class='col-sm-6'>"
+    "<form method='GET' action='reboot' id='upload_form'>"
+    "<label>Save "
+    " OK !</label><br><br><br>"
+    "<button type='submit' class='btn btn-warning mb-2'>Reboot</button>"
+    "</form></div></div>";
+constexpr PageSegment HTML_SAVED_SEGMENTS[] PROGMEM = {
+    {0, 129, (uint8_t)SavedField::msg},
+    {129, 110, PAGE_NO_FIELD}};
+constexpr PageTemplate<SavedField> HTML_SAVED = {HTML_SAVED_TEXT, HTML_SAVED_SEGMENTS, 2};
+
+// serial.html
+enum class SerialField : uint8_t
+{
+  selected9600,
+  selected19200,
+  selected38400,
+  selected57600,
+  selected115200,
+  selected230400,
+  selected460800,
+  flowControl,
+  rtsPin,
+  ctsPin,
+  uartRxBuffer,
+  uartRxFifoFull,
+  uartRxTimeout,
+  socketPort,
+  serialRing,
+  netRing,
+  znpFramer,
+  framerTimeout,
+  srspRouting,
+  clientLag,
+  slowClientDrop,
+  writerBudget,
+  clientRoles,
+  primaryIp,
+  observerRefuse
+};
+const char HTML_SERIAL_TEXT[] PROGMEM =
+    "<div id='main' class='col-sm-12'>"
+    "<div id='main' class='col-sm-6'><form method='POST' action='saveSerial'>"
+    "<div class='form-group'>"
+    "<label for='baud'>Serial Speed</label>"
+    "<select class='form-control' id='baud' name='baud'>"
+    "<option value='9600' "
+    ">9600 bauds</option>"
+    "<option value='19200' "
+    ">19200 bauds</option>"
+    "<option value='38400' "
+    ">38400 bauds</option>"
+    "<option value='57600' "
+    ">57600 bauds</option>"
+    "<option value='115200' "
+    ">115200 bauds</option>"
+    "<option value='230400' "
+    ">230400 bauds</option>"
+    "<option value='460800' "
+    ">460800 bauds</option>"
+    "</select>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='flowControl' type='checkbox' name='flowControl' "
+    ">"
+    "<label class='form-check-label' for='flowControl'>RTS/CTS flow control (needs both pins)</label>"
+    "</div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='rtsPin'>RTS pin (-1 - the board's, if wired)</label>"
+    "<input class='form-control' id='rtsPin' type='number' name='rtsPin' min='-1' max='39' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='ctsPin'>CTS pin (-1 - the board's, if wired)</label>"
+    "<input class='form-control' id='ctsPin' type='number' name='ctsPin' min='-1' max='39' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='uartRxBuffer'>UART RX buffer (bytes)</label>"
+    "<input class='form-control' id='uartRxBuffer' type='number' name='uartRxBuffer' min='256' max='16384' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='uartRxFifoFull'>UART RX FIFO-full threshold (bytes)</label>"
+    "<input class='form-control' id='uartRxFifoFull' type='number' name='uartRxFifoFull' min='1' max='127' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='uartRxTimeout'>UART RX timeout (symbols)</label>"
+    "<input class='form-control' id='uartRxTimeout' type='number' name='uartRxTimeout' min='1' max='126' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='port'>Socket Port</label>"
+    "<input class='form-control' id='port' type='number' name='port' min='100' max='65000' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='serialRing'>Serial to network buffer (bytes)</label>"
+    "<input class='form-control' id='serialRing' type='number' name='serialRing' min='256' max='32768' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='netRing'>Network to serial buffer (bytes)</label>"
+    "<input class='form-control' id='netRing' type='number' name='netRing' min='256' max='32768' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='znpFramer' type='checkbox' name='znpFramer' "
+    ">"
+    "<label class='form-check-label' for='znpFramer'>Send whole ZNP frames per TCP write</label>"
+    "</div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='framerTimeout'>Frame timeout (ms)</label>"
+    "<input class='form-control' id='framerTimeout' type='number' name='framerTimeout' min='1' max='100' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='srspRouting' type='checkbox' name='srspRouting' "
+    ">"
+    "<label class='form-check-label' for='srspRouting'>Send ZNP responses only to the requesting client (needs whole frames)</label>"
+    "</div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='clientLag'>Max client lag (bytes)</label>"
+    "<input class='form-control' id='clientLag' type='number' name='clientLag' min='256' max='32000' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='slowClientDrop' type='checkbox' name='slowClientDrop' "
+    ">"
+    "<label class='form-check-label' for='slowClientDrop'>Disconnect slow clients (otherwise skip them ahead)</label>"
+    "</div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='writerBudget'>Client write budget per round (bytes)</label>"
+    "<input class='form-control' id='writerBudget' type='number' name='writerBudget' min='255' max='8192' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='clientRoles' type='checkbox' name='clientRoles' "
+    ">"
+    "<label class='form-check-label' for='clientRoles'>One primary writer, other clients are read-only observers</label>"
+    "</div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='primaryIp'>Primary client IP (empty - first connected)</label>"
+    "<input class='form-control' id='primaryIp' type='text' name='primaryIp' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='observerRefuse' type='checkbox' name='observerRefuse' "
+    ">"
+    "<label class='form-check-label' for='observerRefuse'>Disconnect observers that write (otherwise drop their data)</label>"
+    "</div>"
+    "</div>"
+    "<br><br>"
+    "<button type='submit' class='btn btn-primary mb-2'name='save'>Save</button>"
+    "</form>";
+constexpr PageSegment HTML_SERIAL_SEGMENTS[] PROGMEM = {
+    {0, 239, (uint8_t)SerialField::selected9600},
+    {239, 42, (uint8_t)SerialField::selected19200},
+    {281, 43, (uint8_t)SerialField::selected38400},
+    {324, 43, (uint8_t)SerialField::selected57600},
+    {367, 44, (uint8_t)SerialField::selected115200},
+    {411, 45, (uint8_t)SerialField::selected230400},
+    {456, 45, (uint8_t)SerialField::selected460800},
+    {501, 169, (uint8_t)SerialField::flowControl},
+    {670, 290, (uint8_t)SerialField::rtsPin},
+    {960, 189, (uint8_t)SerialField::ctsPin},
+    {1149, 197, (uint8_t)SerialField::uartRxBuffer},
+    {1346, 212, (uint8_t)SerialField::uartRxFifoFull},
+    {1558, 199, (uint8_t)SerialField::uartRxTimeout},
+    {1757, 162, (uint8_t)SerialField::socketPort},
+    {1919, 201, (uint8_t)SerialField::serialRing},
+    {2120, 192, (uint8_t)SerialField::netRing},
+    {2312, 136, (uint8_t)SerialField::znpFramer},
+    {2448, 288, (uint8_t)SerialField::framerTimeout},
+    {2736, 140, (uint8_t)SerialField::srspRouting},
+    {2876, 320, (uint8_t)SerialField::clientLag},
+    {3196, 146, (uint8_t)SerialField::slowClientDrop},
+    {3342, 328, (uint8_t)SerialField::writerBudget},
+    {3670, 140, (uint8_t)SerialField::clientRoles},
+    {3810, 305, (uint8_t)SerialField::primaryIp},
+    {4115, 146, (uint8_t)SerialField::observerRefuse},
+    {4261, 223, PAGE_NO_FIELD}};
+constexpr PageTemplate<SerialField> HTML_SERIAL = {HTML_SERIAL_TEXT, HTML_SERIAL_SEGMENTS, 26};
+
+// update.html
+const char HTML_UPDATE_TEXT[] PROGMEM =
+    "<form method='POST' action='#' enctype='multipart/form-data' id='upload_form'>"
+    "<input type='file' name='update' id='file' onchange='sub(this)' style=display:none accept='.bin'>"
+    "<label id='file-input' for='file'>   Choose file...</label>"
+    "<input type='submit' class='btn btn-danger mb-2' value='Update'>"
+    "<br><br>"
+    "<div id='prg'></div>"
+    "<br><div id='prgbar'><div id='bar'></div></div><br></form>"
+    "<div id='update_info'>"
+    "<h4>Latest version on GitHub</h4>"
+    "<div id='onlineupdate'>"
+    "<h5 id=releasehead></h5>"
+    "<div style='clear:both;'>"
+    "<br>"
+    "</div>"
+    "<pre id=releasebody>Getting update information from GitHub...</pre>"
+    "<div class='pull-right' style='text-align: center;'>"
+    "<a class='pull-right' id='webupdate' href='/web_update'>"
+    "<button type='button' class='btn btn-warning'>Online update</button>"
+    "</a>"
+    "<a style='margin-left: 40px;' class='pull-right' id='downloadupdate'>"
+    "<button type='button' class='btn btn-success'>Download</button>"
+    "</a>"
+    "</div>"
+    "</div>"
+    "</div>"
+    "<div id='update_info'>"
+    "<h5>Clicking the Online update button will start the update process directly from GitHub.</h5>"
+    "<h6>At the moment, the progress of the online update is not displayed - you need to wait until the device restarts."
+    "</h6>"
+    "</div>"
+    "<div style='clear:both;'>"
+    "<br>"
+    "</div>"
+    "<script language='javascript'>getLatestReleaseInfo();</script>"
+    "<script>"
+    "function sub(obj){"
+    "var fileName = obj.value.split('\\\\');"
+    "document.getElementById('file-input').innerHTML = '   '+ fileName[fileName.length-1];"
+    "};"
+    "$('form').submit(function(e){"
+    "e.preventDefault();"
+    "var form = $('#upload_form')[0];"
+    "var data = new FormData(form);"
+    "$.ajax({"
+    "url: '/update',"
+    "type: 'POST',"
+    "data: data,"
+    "contentType: false,"
+    "processData:false,"
+    "xhr: function() {"
+    "var xhr = new window.XMLHttpRequest();"
+    "xhr.upload.addEventListener('progress', function(evt) {"
+    "if (evt.lengthComputable) {"
+    "var per = evt.loaded / evt.total;"
+    "$('#prg').html('progress: ' + Math.round(per*100) + '%');"
+    "$('#bar').css('width',Math.round(per*100) + '%');"
+    "}"
+    "}, false);"
+    "return xhr;"
+    "},"
+    "success:function(d, s) {"
+    "console.log('success!');"
+    "$('#prg').html('Update completed!<br>Rebooting!');"
+    "window.location.href='/';"
+    "},"
+    "error: function (a, b, c) {"
+    "}"
+    "});"
+    "});"
+    "</script>";
+constexpr PageSegment HTML_UPDATE_SEGMENTS[] PROGMEM = {
+    {0, 2073, PAGE_NO_FIELD}};
+constexpr PageTemplate<PageNoField> HTML_UPDATE = {HTML_UPDATE_TEXT, HTML_UPDATE_SEGMENTS, 1};
+
+// wifi.html
+enum class WifiField : uint8_t
+{
+  checkedWiFi,
+  ssid,
+  passWifi,
+  dchp,
+  ip,
+  mask,
+  gw,
+  checkedDisEmerg
+};
+const char HTML_WIFI_TEXT[] PROGMEM =
+    "<div id='main' class='col-sm-12'>"
+    "<div id='main' class='col-sm-6'><form method='POST' action='saveWifi'>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='wifiEnable' type='checkbox' name='wifiEnable' "
+    ">"
+    "<label class='form-check-label' for='wifiEnable'>Enable Wi-Fi client mode</label>"
+    "</div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='ssid'>SSID</label>"
+    "<input class='form-control' id='ssid' type='text' name='WIFISSID' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<a onclick='scanNetwork();' class='btn btn-warning mb-2'>Scan</a>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div id='networks'></div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='pass'>Password</label>"
+    "<input class='form-control' id='pass' type='password' name='WIFIpassword' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='dhcpWiFi' type='checkbox' name='dhcpWiFi' "
+    ">"
+    "<label class='form-check-label' for='dhcpWiFi'>DHCP</label>"
+    "</div>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='ip'>IP</label>"
+    "<input class='form-control' id='ip' type='text' name='ipAddress' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='mask'>Mask</label>"
+    "<input class='form-control' id='mask' type='text' name='ipMask' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<label for='gateway'>Gateway</label>"
+    "<input type='text' class='form-control' id='gateway' name='ipGW' value='"
+    "'>"
+    "</div>"
+    "<div class='form-group'>"
+    "<div class='form-check'>"
+    "<input class='form-check-input' id='disableEmerg' type='checkbox' name='disableEmerg' "
+    ">"
+    "<label class='form-check-label' for='disableEmerg'><b>Disable</b> emergency mode (AP)</label>"
+    "</div>"
+    "</div>"
+    "<button type='submit' class='btn btn-primary mb-2' name='save'>Save</button>"
+    "</form>";
+constexpr PageSegment HTML_WIFI_SEGMENTS[] PROGMEM = {
+    {0, 233, (uint8_t)WifiField::checkedWiFi},
+    {233, 221, (uint8_t)WifiField::ssid},
+    {454, 297, (uint8_t)WifiField::passWifi},
+    {751, 134, (uint8_t)WifiField::dchp},
+    {885, 194, (uint8_t)WifiField::ip},
+    {1079, 133, (uint8_t)WifiField::mask},
+    {1212, 140, (uint8_t)WifiField::gw},
+    {1352, 142, (uint8_t)WifiField::checkedDisEmerg},
+    {1494, 189, PAGE_NO_FIELD}};
+constexpr PageTemplate<WifiField> HTML_WIFI = {HTML_WIFI_TEXT, HTML_WIFI_SEGMENTS, 9};
+
+// zigbee_update.html
+const char HTML_ZIGBEE_UPDATE_TEXT[] PROGMEM =
+    "<div class='btn-group-vertical'>"
+    "<a href='/setchipid' class='btn btn-primary mb-2'>setChipId</button>"
+    "<a href='/setmodeprod' class='btn btn-primary mb-2'>setModeProd</button>"
+    "</div>";
+constexpr PageSegment HTML_ZIGBEE_UPDATE_SEGMENTS[] PROGMEM = {
+    {0, 178, PAGE_NO_FIELD}};
+constexpr PageTemplate<PageNoField> HTML_ZIGBEE_UPDATE = {HTML_ZIGBEE_UPDATE_TEXT, HTML_ZIGBEE_UPDATE_SEGMENTS, 1};
+
+#endif
@@ -1,4 +1,5 @@
 #define toast_js_gz_len 1336
+#define toast_js_gz_hash "2caac8fc43add101"
 const uint8_t toast_js_gz[] PROGMEM = {
 0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xad,0x56,0x6d,0x6f,0xdb,0x36,0x10,0xfe,0x1c,0xff,0x8a,0xab,0x50,0x54,0x72,0x5e,0x24,0xb7,0xc3,0xbe,0xb8,0x71,0x86,0x2e,0x4b,0xd3,0x0c,0x69,0x36,0x2c,0xd9,0x0a,0xac,0x28,0x12,0x5a,0x3a,0xdb,0x5c,0x28,0x51,0x13,0x29,0x27,0x59,0xea,0xff,0xbe,0x23,0x45,0xca,0x52,0x12,0x0f,0x1d,0xda,0x2f,0x96,0xc9,0x7b,0x7f,0xee,0xe1,0x91,0xc9,0xf6,0xf6,0x00,0xb6,0xe1,0x42,0x32,0xa5,0x21,0x5a,0x68,0x5d,0xaa,0x71,0x92,0xcc,0xb9,0x5e,0xd4,0xd3,0x38,0x95,0x79,0xc2,0x75,0xba,0xe0,0x38,0x4b,0x6a,0xbe,0x47,0xcb,0x52,0x16,0x58,0x68,0x95,0xe8,0x0a,0x31,0xc9,0xc9,0x06,0xab,0x44,0x1b,0xdb,0xa1,0xf1,0x72,0x28,0xcb,0xbb,0x8a,0xcf,0x17,0x1a,0x5e,0x8d,0x5e,0x8d,0x60,0xcf,0x7c,0x5e,0xc2,0x1b,0x81,0xb7,0xac,0xc8,0xb0,0x82,0xf7,0x4c,0x68,0x85,0x4b,0xa3,0x7a,0xca,0x53,0x2c,0x14,0x66,0x50,0x37,0x92,0x93,0x8b,0xff,0x11,0x7d,0x2a,0xe4,0xd4,0x47,0x3f,0x3d,0x39,0x3c,0x3a,0x3b,0x3f,0x1a,0x0e,0xb6,0xb7,0x93,0xc1,0x20,0x15,0x4c,0x29,0x57,0xcd,0xfd,0x00,0x20,0x95,0x85,0xd2,0x55,0x9d,0x6a,0x59,0x45,0x25,0xab,0x58,0xae,0x86,0x76,0x1f,0x40,0x2f,0xb8,0x8a,0x2f,0x35,0xd7,0x02,0x61,0x02,0x8d,0xec,0x63,0x68,0xd7,0xe1,0x27,0x98,0x4c,0x26,0x30,0x63,0x42,0x21,0xfc,0xe0,0xbe,0xe3,0x47,0x3a,0x9f,0x3f,0x43,0x78,0x61,0xff,0xbf,0xee,0x7a,0xc4,0x5b,0xdd,0x75,0x48,0x4b,0xa7,0xfb,0x1e,0x95,0x62,0x73,0x8c,0xe3,0xb8,0x6f,0xb0,0xc0,0xbc,0x97,0x82,0x59,0x3b,0x93,0x0c,0x67,0xac,0x16,0xba,0xa7,0xcf,0x6a,0x2d,0x17,0x3c,0xeb,0x9a,0xf8,0x2d,0xb2,0x7a,0xf1,0x02,0xa8,0x5e,0xec,0x1a,0xf0,0x82,0x70,0x5a,0x32,0x41,0x06,0x3b,0xde,0xc2,0xef,0x35,0x71,0xbe,0x1f,0x8d,0x46,0x5d,0x8b,0xb4,0x42,0xa6,0x31,0x1a,0x76,0xf7,0x50,0xc4,0x2c,0xcb,0x8e,0x96,0xd4,0x80,0x53,0x4e,0xc8,0x17,0x58,0x45,0x61,0x2a,0x78,0x7a,0x1d,0xee,0x42,0x84,0x43,0x98,0x1c,0x38,0x64,0x01,0xf8,0x8c,0x76,0x62,0xcd,0xaa,0x39,0xea,0xd8,0xb6,0xc4,0x98,0x50,0x43,0x0b,0xcd,0x78,0xa1,0xa2,0xd0,0x52,0xe6,0xf2,0x32,0x15,0x52,0x61,0x38,0x1c,0xb6,0x86,0x3e,0x98,0x29,0xc6,0x87,0x07,0x58,0xd9,0xef,0xaa,0x97,0x8e,0x5a,0xc8,0x9b,0x46,0xc3,0x48,0xdd,0xb2,0xd7,0x5a,0x4a,0x78,0x1d,0x9a,0x52,0xf7,0x51,0x8d,0x2a,0x2f,0xe6,0xe1,0xc3,0xea,0x36,0x2a,0x7b,0x4d,0xb2,0xca,0xe4,0x4d,0xac,0x50,0x5f,0xf0,0x1c,0x65,0xad,0xa3,0xa8,0x57,0xf5,0x13,0x9e,0x2a,0xcc,0xe5,0x12,0x37,0x44,0xf6,0x05,0x19,0xb4,0xfa,0xad,0x5d,0x03,0xb2,0x31,0xd8,0x06,0xa4,0x76,0x1f,0xf4,0xdc,0x87,0xf2,0x38,0x35,0xea,0x5f,0x85,0xd3,0x63,0x16,0xe8,0x8a,0x15,0x8a,0x6b,0x6e,0x4e,0x67,0x66,0xd8,0xf0,0x55,0xb0,0x7c,0xa1,0xc5,0x13,0xea,0x4e,0xc9,0xd7,0xbc,0x0b,0xf7,0xb2,0x48,0xcd,0xc9,0x35,0x27,0xc2,0xa3,0x6d,0x27,0x02,0xa0,0xa9,0x80,0x0e,0x44,0x81,0x37,0x70,0x58,0x2b,0x2d,0x73,0x5b,0x53,0x14,0x1a,0x80,0x62,0x1b,0x85,0x0a,0xb9,0x87,0x0c,0x89,0xb1,0x62,0x4c,0xff,0x1a,0x36,0x8f,0xdb,0x68,0xb0,0x6a,0x1b,0x98,0xc9,0xb4,0xce,0xc9,0x3a,0xce,0xb8,0x2a,0x19,0x4d,0xac,0xc6,0x97,0x8d,0xb1,0xa6,0xa8,0x3f,0x54,0x0e,0x18,0x97,0x87,0x39,0x95,0xad,0x7d,0xa3,0x72,0x24,0x30,0xb7,0xb9,0x64,0x7c,0xe9,0xab,0xdc,0xd0,0xa4,0x8d,0xe2,0xab,0x06,0xa8,0xe7,0xf7,0x9d,0x19,0xb3,0xba,0x72,0xda,0x02,0x35,0x2c,0x74,0x6e,0x42,0x5f,0xdd,0x2f,0x90,0xd1,0x00,0x5e,0xed,0x53,0x30,0xb0,0x3e,0x26,0x81,0x3b,0x9d,0x53,0x99,0xdd,0x05,0x07,0xfb,0x09,0x49,0x0e,0xf6,0xa7,0xb5,0xd6,0xb2,0x78,0xa0,0x61,0xcf,0x6f,0x00,0xfa,0xae,0xc4,0x49,0xd0,0x68,0x18,0x83,0xe6,0xdf,0xc1,0x55,0x17,0x70,0x13,0xef,0x9d,0x0d,0x45,0x51,0x7b,0xb3,0xb7,0x33,0x69,0xc3,0x90,0x9a,0x15,0x3e,0x91,0x4a,0x93,0xa4,0x4f,0xc6,0x8d,0x43,0x57,0x82,0xf9,0x50,0xeb,0x4b,0xc1,0x52,0x22,0x88,0xaf,0x87,0xba,0xb7,0x0e,0xb9,0x46,0x89,0x17,0xc4,0xd8,0x77,0x17,0xef,0x4f,0x9d,0xe1,0xc3,0x13,0x68,0x73,0x5a,0x1f,0x3f,0xb2,0xf8,0xbb,0xc6,0xea,0xee,0x1c,0x05,0xda,0x3b,0x24,0x8c,0x7b,0x19,0x85,0xc3,0xd8,0x0c,0xf8,0x43,0x1a,0x6c,0x0d,0x9f,0x3a,0x5e,0x1c,0x0b,0xc9,0x07,0xd5,0xd6,0x71,0xf8,0xe4,0x61,0xcb,0x9b,0xbb,0x21,0xec,0x9c,0xd7,0xff,0x8a,0x6e,0x5a,0xb3,0x29,0x36,0xed,0xf5,0x4f,0x2c,0x89,0xb0,0x53,0xe8,0xb3,0x96,0x6e,0x4f,0x3a,0xdf,0x73,0x53,0xda,0x14,0xb7,0x06,0xa2,0x69,0x62,0x2b,0xfa,0x32,0xd2,0xc2,0xda,0xe0,0xc9,0xaa,0xbb,0xa1,0xbc,0x45,0xeb,0xd6,0x94,0x18,0xb3,0xb2,0xa4,0x91,0x12,0xb5,0x7a,0x3d,0x78,0xbe,0xbc,0x0e,0xef,0xc7,0x23,0xe2,0x0e,0xe5,0x6a,0x30,0x18,0xcc,0xea,0x22,0x35,0x93,0x0b,0xd2,0x05,0xa6,0xd7,0xa7,0x54,0x89,0xd2,0xbf,0x91,0x2b,0xa6,0xfc,0x51,0x6d,0xc3,0x3c,0x1e,0x7c,0xbd,0x61,0xd1,0xbb,0x03,0x0d,0x5e,0x52,0x60,0x2c,0xe4,0x9c,0x6e,0xc2,0x66,0x8a,0xb8,0x0b,0xb1,0x09,0x4e,0xbf,0x5b,0xcf,0x63,0x5a,0xfe,0x7c,0xfe,0xcb,0x59,0x14,0xf8,0xa7,0x0f,0x2b,0x79,0xdc,0x79,0xfe,0x10,0xad,0xa5,0x4a,0x6e,0xef,0xfe,0xa9,0x24,0x26,0x7f,0xf2,0xf9,0x39,0xb9,0x38,0xfe,0xb0,0xf7,0xf6,0x03,0x49,0x6c,0x8e,0x2a,0x11,0x36,0xe5,0x60,0x18,0x67,0x34,0x7e,0x23,0x5f,0x4e,0xe4,0xe4,0xa6,0x84,0x2d,0x80,0x25,0xab,0x80,0xf0,0x47,0x43,0x13,0x27,0x89,0xed,0x5a,0x7d,0x1c,0x7d,0x7a,0xed,0x35,0xe8,0x76,0x2b,0x84,0x64,0xd9,0xa1,0xac,0x2d,0xa1,0x46,0x56,0x32,0x93,0x15,0x44,0x46,0xcc,0xed,0x16,0x7d,0xf6,0x1f,0xf8,0x88,0x05,0x16,0x73,0xbd,0x20,0xd1,0xce,0x8e,0x0d,0xb8,0xd5,0xf7,0xb4,0xf3,0x28,0x28,0xff,0x14,0x7b,0x95,0xcb,0xd4,0xe8,0xd8,0x48,0xd4,0x0f,0xfa,0xb5,
 0xf8,0xd9,0x74,0xf8,0xf2,0x65,0x97,0x68,0x04,0x96,0x63,0xd9,0x8f,0x77,0x27,0xc4,0xa1,0x65,0xc3,0x9b,0xee,0x34,0xbd,0x65,0x79,0x29,0xf0,0x8d,0xd6,0xd5,0xc4,0x9a,0x1b,0x1b,0xb3,0xe2,0x34,0x92,0x68,0x38,0x2c,0x5b,0x7d,0xe3,0x9f,0x70,0xfe,0xc3,0x52,0xf9,0xac,0xce,0xa7,0xd4,0x4e,0x9f,0x63,0xc1,0x72,0x8c,0x55,0x29,0x38,0xb1,0x39,0x26,0xf2,0xfc,0x25,0x79,0x11,0x05,0xc1,0xd0,0x91,0xcf,0x98,0x0a,0x99,0x32,0xd1,0x33,0xee,0x84,0xde,0x60,0xdb,0x1a,0xbb,0x38,0x27,0xc5,0x4c,0x92,0x7d,0x70,0x46,0x57,0xd0,0x8c,0x57,0xf9,0x0d,0xab,0x10,0xa8,0x26,0x65,0xd8,0x18,0x05,0xb0,0xe3,0x13,0xdc,0x81,0x60,0x08,0x37,0x4c,0x51,0x27,0xe8,0xb1,0x0c,0x24,0x3d,0xe6,0xfa,0x1d,0x31,0x04,0x4e,0xb4,0xdd,0xf7,0x50,0xd2,0x6b,0xda,0x98,0xf5,0xc0,0x27,0x7a,0x9e,0x9a,0x64,0xf1,0x9c,0x50,0x28,0xe6,0xc4,0x69,0x72,0x07,0x9a,0xde,0x14,0x2a,0x86,0x63,0x09,0x7b,0x07,0xf4,0x5a,0x96,0x42,0x99,0x3f,0xbf,0x97,0x19,0x91,0x09,0x8e,0xce,0x7f,0xfd,0xee,0x15,0xbd,0x2d,0xe7,0x08,0x5a,0x02,0x21,0x08,0xb9,0xa4,0xd4,0x38,0xe5,0x1b,0x07,0x9d,0x3a,0xa6,0xc4,0x6a,0x5f,0xc4,0xc5,0x82,0x15,0xd7,0xca,0x72,0xc5,0xd0,0x91,0x22,0xd9,0xab,0xd5,0x95,0xf3,0x0c,0x7e,0x92,0x45,0xa8,0x8d,0xd8,0xb8,0x33,0x5e,0xf9,0x12,0x61,0x86,0x98,0x4d,0x59,0x7a,0x0d,0xaf,0x87,0xc6,0x6f,0x3b,0xa1,0x5c,0xdd,0x07,0x2d,0xcc,0xeb,0x39,0x64,0x9c,0xda,0xd7,0x7d,0xd4,0x79,0x08,0x99,0x69,0x3b,0x6e,0x2e,0x91,0xdd,0xf5,0x2e,0xcd,0xc1,0x71,0x17,0xeb,0x8e,0xc8,0xdc,0x86,0x63,0x08,0x08,0xf1,0x82,0x32,0x0d,0xd6,0x12,0xff,0x00,0x7b,0xe4,0xcd,0xbf,0xa7,0x9c,0xc0,0x3f,0xb7,0x1e,0x8c,0x6b,0x1a,0xf4,0x9d,0xfc,0xf7,0xbf,0x41,0xfe,0x1e,0xe3,0xc7,0xc9,0xab,0x3a,0x4d,0xe9,0xd2,0xf8,0x16,0xc9,0x0f,0xb6,0x56,0x6e,0x22,0xfe,0x0b,0xa2,0xa7,0xd1,0x5d,0x0e,0x0e,0x00,0x00
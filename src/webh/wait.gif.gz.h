@@ -1,4 +1,5 @@
 #define wait_gif_gz_len 1563
+#define wait_gif_gz_hash "70ff34cd96de2ce0"
 const uint8_t wait_gif_gz[] PROGMEM = {
 0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x95,0xd5,0x7b,0x50,0x53,0x57,0x1e,0x07,0xf0,0xeb,0xbd,0xe7,0xe6,0xde,0xdc,0x47,0x72,0x88,0x91,0x86,0x48,0x9d,0x10,0x82,0x26,0x21,0x31,0xe1,0x15,0xa2,0x58,0xf7,0x26,0x3c,0x05,0xca,0x02,0x55,0xa0,0x3c,0x4a,0x22,0x86,0x12,0x0a,0x35,0x50,0x11,0x96,0x22,0x92,0x07,0x42,0x22,0x4f,0x65,0x75,0xb1,0x58,0x75,0x97,0x6d,0x51,0xb0,0x05,0x7c,0x4c,0x5f,0x44,0x8c,0xcc,0x68,0xdb,0xb1,0x95,0xa9,0xd3,0x4e,0x5f,0x33,0xd8,0xa1,0x1d,0x6d,0x6d,0x0b,0x7d,0x4c,0x75,0xa6,0xad,0x4b,0xfa,0x87,0x7f,0x65,0xda,0xd9,0xf3,0xe7,0x77,0xce,0x6f,0xe6,0x33,0xdf,0x33,0x67,0x7e,0x99,0xdb,0x32,0x8c,0x9b,0xac,0x10,0x81,0xc8,0x4f,0x08,0xf2,0xe0,0xc1,0x03,0x04,0x41,0x96,0x96,0x96,0x7c,0x3e,0xdf,0xc2,0xc2,0x42,0x46,0x46,0x46,0x6b,0x6b,0xeb,0x4a,0x52,0x52,0x52,0xa2,0x50,0x28,0x26,0x26,0x26,0xfc,0x7e,0xbf,0x58,0x2c,0x1e,0x19,0x19,0x01,0x00,0x18,0x0c,0x86,0x9a,0x9a,0x1a,0xe4,0xff,0x39,0x51,0x0f,0xe8,0xbc,0xf4,0xed,0x4f,0xa4,0x9a,0xf2,0xd3,0xe3,0x37,0xea,0xb1,0x55,0xc1,0xe8,0x77,0x69,0x6a,0xa3,0xcd,0xba,0xc7,0xb6,0x4b,0xd6,0x6c,0xdf,0x53,0x23,0xb3,0xd6,0x5a,0x5b,0xea,0x76,0x5b,0x77,0x6d,0xb4,0x3f,0x5b,0xbd,0x1b,0x89,0xba,0x0f,0xf8,0xd4,0xca,0x2d,0x4d,0x70,0x3a,0x88,0x44,0xf0,0x66,0x99,0x0c,0x45,0xf9,0x51,0x5f,0x8e,0xa1,0x69,0x66,0xf2,0xaa,0x69,0x60,0x3c,0x2b,0xd2,0xbb,0x70,0x2d,0x30,0x21,0x3a,0x77,0xd9,0x3a,0x89,0xbd,0x94,0xe6,0x0a,0xc0,0xaf,0x38,0xd9,0x53,0x17,0xc5,0xa6,0x3b,0x25,0xf7,0x06,0xf2,0x47,0xb9,0xe5,0xd7,0xe4,0x3b,0xdc,0xae,0x73,0x05,0xd1,0xfc,0xf7,0x6e,0x99,0x9d,0xe5,0x29,0x27,0xae,0xd3,0x57,0xe2,0xce,0x88,0x18,0x09,0xbe,0xfb,0xfd,0xcd,0xf1,0x0a,0xe9,0x5e,0x8c,0x03,0x94,0xa2,0x4d,0x93,0x00,0x84,0x34,0xc5,0x02,0x57,0x65,0x34,0x4a,0xf2,0x10,0x76,0x17,0xe8,0x48,0x02,0xbc,0x84,0xa3,0x72,0xfa,0xb9,0x24,0x9a,0xb6,0x45,0x85,0xb2,0xec,0x0d,0x5a,0xec,0x9c,0x6d,0x53,0x5f,0x9a,0x89,0x7c,0xdb,0x04,0x7b,0xa6,0x7d,0x73,0xcb,0xb3,0x82,0x30,0xdd,0x78,0x84,0xc5,0x51,0xa3,0x90,0xf4,0xa6,0x5a,0x63,0x38,0x19,0xde,0x73,0xf5,0x8e,0x23,0xeb,0x34,0x49,0x1e,0x87,0x93,0x2d,0x33,0x19,0xa8,0x33,0xd0,0xf4,0x84,0x57,0x0c,0xdd,0xab,0x5a,0xa2,0x3b,0x71,0x16,0x80,0xc0,0xc6,0x4b,0x9f,0x7b,0x0e,0x3c,0x29,0xae,0xee,0x0b,0x03,0xb9,0x68,0xa5,0x1c,0xc3,0x29,0x07,0x95,0x60,0x76,0x17,0x3b,0x01,0x04,0x74,0x77,0x45,0x5b,0x2e,0x8f,0x2d,0x37,0x1c,0x7a,0xbe,0xad,0xf5,0x98,0xf1,0x78,0x72,0x59,0x72,0x48,0x4a,0x4b,0x90,0xf2,0x31,0xb3,0x42,0x01,0x69,0x64,0xba,0x9c,0xec,0x9f,0xf6,0x79,0xdc,0xb3,0xf1,0x8d,0x9a,0xf1,0x47,0x4e,0x36,0xe4,0xcf,0x89,0xbb,0xd0,0x0e,0x44,0x2c,0xa9,0x3d,0x1f,0xb0,0x2c,0x19,0x21,0x8f,0xf8,0x46,0x14,0xe0,0x20,0x69,0xdc,0x19,0x9e,0x25,0xd2,0xc8,0xd4,0xf3,0x5f,0xe8,0x25,0xda,0x97,0xd8,0xa5,0xfa,0x8c,0x62,0xc9,0x77,0x8b,0x9b,0x66,0x72,0xf3,0x47,0xd3,0x13,0x62,0x51,0x0a,0x2a,0x5d,0xa8,0x59,0xce,0xf2,0xe8,0xea,0xde,0xe7,0xbb,0xd5,0xe6,0xe2,0x4a,0x9d,0x77,0x3f,0xca,0x72,0x95,0x0a,0xaf,0xab,0x3d,0xa7,0xd1,0x99,0x6c,0x6a,0x0c,0x8d,0xf9,0xa3,0x97,0x8f,0x13,0x57,0x30,0x9e,0x28,0x32,0x6b,0x59,0xfe,0xae,0x5a,0xd4,0xbf,0x96,0xbe,0x51,0xd0,0xaf,0xe3,0xdc,0x53,0xdd,0x5a,0x01,0x14,0x39,0x13,0x3b,0x20,0xc0,0xaf,0x9c,0x76,0xc0,0x44,0x41,0x4f,0x61,0xec,0x2f,0x6f,0x69,0x45,0xc4,0x89,0xdb,0x17,0x1c,0x67,0xc9,0x6b,0x2f,0x5b,0xe6,0xf3,0x95,0x47,0x0c,0xa4,0xfb,0xd6,0xc9,0xe3,0xd2,0xa5,0x1d,0xba,0x5f,0x65,0x7c,0x92,0x56,0x6b,0x80,0x47,0x05,0x30,0x65,0xac,0xae,0x42,0x5e,0xf7,0xf7,0x4e,0xdd,0x01,0xb5,0xe9,0x99,0xc1,0xfd,0x87,0x7d,0x74,0xce,0x50,0x8f,0xaf,0xc2,0xd4,0x6e,0x30,0x9c,0x34,0x84,0xa4,0xd4,0xfd,0xf1,0x44,0x92,0x60,0x2f,0x72,0xf2,0xea,0xf2,0xba,0x15,0x4a,0xd7,0x5a,0x9a,0x99,0xf1,0x23,0x98,0xf6,0x43,0xa3,0x3e,0x0b,0x88,0x5c,0x53,0x1d,0x8f,0xe5,0xa5,0x9c,0x62,0x6e,0xbc,0x13,0xb6,0xdd,0x93,0x7e,0xf7,0x06,0x9c,0x09,0x7f,0x65,0xcd,0x77,0x0d,0x6b,0xa0,0xf4,0xf6,0xe8,0xb7,0x53,0xb6,0x17,0x99,0xaf,0x77,0xec,0xce,0x89,0xaf,0x2c,0x2e,0xfd,0xe1,0xf3,0x9e,0x22,0xef,0xf9,0xb8,0xda,0xa7,0x8b,0x81,0x8d,0xdb,0xd3,0x94,0xa5,0xd3,0x35,0x5b,0xfe,0xd6,0xe9,0xad,0x6e,0x8f,0x3e,0xe4,0x3d,0x62,0x18,0x3a,0x1c,0x1d,0x12,0xd0,0x1e,0x04,0xbc,0xae,0x59,0x01,0xb8,0xe4,0xa4,0x7b,0x59,0x3a,0xa7,0xa6,0x0e,0xa4,0x30,0x8e,0xc2,0x73,0x31,0xa8,0x67,0x32,0x5a,0xcf,0x1b,0x3d,0x66,0x39,0x25,0x9b,0x95,0x6e,0xb8,0x52,0x35,0xac,0x1c,0x0d,0xc7,0x86,0xb2,0x39,0x2e,0x72,0xdd,0xa5,0x47,0x2e,0x5f,0x10,0x89,0xa5,0xba,0xb8,0xcb,0x76,0x2c,0x11,0x76,0x07,0x2c,0x33,0x45,0x67,0xa5,0x5e,0x80,0x99,0xbf,0xf0,0x17,0x01,0x21,0xdb,0xb4,0xcf,0x23,0xaf,0x22,0x08,0xdc,0x9a,0x67,0xd7,0x31,0x44,0x05,0xc1,0xa8,0x54,0xbd,0x5a,0x82,0x44,0x72,0x6d,0x75,0xfb,0xf9,0x04,0x5d,0x6f,0xdf,0x87,0x00,0x82,0xad,0xb7,0x95,0xc5,0x86,0x24,0xfd,0x23,0x48,0xda,0x06,0x57,0x48,0x01,0x39,0xf9,0xf8,0x8f,0x86,0x39,0x75,0x60,0x4c,0x9e,0x9c,0x7e,0xfd,0x88,0xc7,0xc9,0x65,0x2a,0x95,0xb9,0xeb,0x6f,0x3a,0x1a,0x6a,0xb9,0xd2,0xce,0x97,0xbd,0xf7,0xdf,0x08,0x93,0x31,0x9e,0xef,0x63,0xb8,0xb3,0x00,0xe2,0xcd,0x13,0xa5,0x2a,0x19,0xf4,0x38,0xea,0x30,0x25,0xd5,0xdf,0xe5,0xbc,0x79,0xb6,0x8f,0x24,0x1b,0x7e,0x6e,0x52,0xaf,0x0e,0x27,0x88,0xc2,0xf5,0x55,0x3c,0xc8,0x27,0x2c,0x84,0x50,0xa5,0x52,0x32,0x04,0x46,0x3c,0xb7,0xbf,0x32,0x7b,0x00,0x74,0x6f,
 0xad,0x2c,0x17,0x10,0x1b,0x04,0x99,0xf5,0xc9,0x64,0x8f,0x22,0xb4,0xa6,0xf9,0xa1,0x06,0x55,0x6b,0x0e,0xca,0x94,0x73,0x6a,0xbf,0xf2,0x57,0x73,0x52,0x99,0x28,0x4e,0xb2,0x6a,0x5a,0xf6,0xdf,0xd2,0xe9,0x0f,0xb6,0x59,0x6b,0xa2,0x78,0x99,0x47,0xcf,0xd8,0x5a,0x24,0xad,0xd3,0x77,0xb3,0xf5,0xdd,0xb6,0x4b,0x86,0xd9,0x00,0x57,0xd4,0xb6,0x63,0x1c,0x07,0xcb,0x89,0x6f,0x5c,0x4c,0xab,0x9f,0xee,0x8c,0x51,0x08,0xae,0xbf,0xf0,0x8d,0x43,0xc2,0x50,0xfc,0x72,0x02,0xcf,0x44,0xb0,0x16,0x3e,0x9f,0xdd,0x87,0x70,0xb1,0xa0,0x0d,0x30,0x0c,0x2a,0x24,0x1e,0x8b,0xa5,0x88,0xb8,0xc3,0x5a,0x7e,0xba,0x35,0x09,0xad,0x53,0xfd,0x49,0x33,0xaa,0x91,0xc5,0xb1,0x17,0x37,0x98,0x46,0x72,0x4e,0x1f,0x7a,0x75,0xe1,0x93,0x5e,0xcd,0xbf,0x2f,0xfe,0x26,0x00,0x87,0xbd,0xe9,0xe5,0xca,0x3a,0xf7,0xc8,0xe9,0xf5,0x29,0x49,0xb2,0xde,0x05,0x98,0x24,0x4a,0xf3,0xce,0x45,0x74,0xe8,0x6f,0xaf,0x3b,0x97,0xe0,0xb2,0x4e,0xe8,0xb5,0xa2,0x83,0x6b,0x06,0x2e,0x68,0x23,0x05,0xf3,0x8f,0x9e,0x9a,0x95,0x0c,0x81,0xbe,0x2b,0x6e,0x47,0x56,0xa2,0x18,0xe2,0x45,0x7c,0x18,0xc3,0xda,0x31,0x02,0x13,0x0a,0x29,0x47,0x59,0xa1,0xbc,0x8d,0x8f,0xf6,0xa0,0xa4,0x60,0x30,0x9a,0x1a,0x46,0xf9,0x42,0x03,0x6e,0x2f,0x6d,0xae,0x6a,0x56,0xff,0x85,0x46,0x93,0x33,0xa4,0xbe,0x7f,0x71,0x0e,0x3d,0x38,0xa6,0x3f,0x41,0x5b,0x8f,0xa5,0x7c,0x74,0xf0,0xc6,0xe4,0xaa,0x27,0x8d,0xce,0x9d,0x96,0xc4,0x3b,0xcf,0x8e,0xae,0xa3,0x03,0x63,0xe6,0x9d,0x88,0x6b,0xe7,0x9b,0x2d,0x91,0x7e,0x5c,0x33,0x75,0xf9,0x66,0x58,0x84,0x7f,0xf0,0xe4,0xd4,0xbb,0xe1,0xfe,0xeb,0xab,0x17,0xe7,0x95,0x7c,0x11,0x71,0x6d,0x66,0xf2,0x51,0x19,0xa0,0x49,0x5e,0x0c,0xb5,0x15,0x23,0x58,0x12,0xa7,0x19,0x2a,0x5e,0x0d,0x08,0x21,0xea,0x43,0x79,0x42,0xbb,0x9a,0xe6,0xeb,0x70,0x7c,0x33,0x1c,0x8e,0x55,0x60,0xd8,0xde,0xd0,0x9a,0xa6,0x87,0x9a,0xba,0xb2,0x33,0x8a,0x5b,0xd4,0x74,0x36,0x6c,0x28,0xfb,0x4f,0xa0,0x81,0x49,0x18,0xb6,0x14,0x94,0xdd,0x13,0x24,0xad,0x76,0xde,0xdb,0x1c,0x21,0xf0,0xfd,0x73,0x09,0x6c,0x2b,0x89,0xd2,0xcf,0x36,0x9a,0xd2,0x8c,0x12,0x26,0x75,0xef,0xf8,0xc0,0xdb,0x62,0xfc,0xb3,0xac,0xfc,0x6a,0x7b,0x98,0x7f,0xd1,0x8e,0x14,0x0c,0x81,0x7e,0xb7,0x29,0x9f,0x73,0xac,0x85,0xa9,0x3c,0x36,0x26,0x0d,0x61,0xf3,0x79,0x10,0x08,0x0b,0x12,0x0d,0x0c,0xbe,0x82,0x61,0xed,0x55,0x76,0x14,0x92,0x79,0xb5,0xfa,0x66,0xd6,0xa3,0x0a,0xfd,0xa5,0x1e,0xf6,0xb2,0x91,0x69,0xf0,0x8f,0x51,0x9a,0x4c,0x94,0x7e,0x25,0x1b,0x22,0x8d,0xca,0x57,0x23,0xb3,0x07,0x8c,0x0c,0xd9,0x95,0xba,0xb4,0xa8,0x0e,0xf3,0x75,0x1d,0x30,0x9f,0xd7,0x0c,0x4b,0xfb,0x3a,0xbf,0x5e,0x2f,0xd9,0x42,0x75,0x3a,0x7b,0xce,0x7f,0x1a,0x21,0xaa,0x99,0x62,0x8a,0xdb,0xb5,0xf0,0xad,0x41,0xcb,0xbc,0x86,0xcf,0x74,0x1d,0xf9,0x79,0x54,0xa2,0xb9,0xbb,0x15,0x43,0x21,0x2f,0x85,0x62,0x8d,0x85,0x79,0x5b,0x34,0x34,0xd6,0x09,0xb7,0xc4,0x6d,0x17,0xc2,0x0a,0x1e,0x4a,0xfd,0xab,0x0a,0x0c,0x1e,0xdd,0xc0,0x36,0x3c,0xa3,0xa0,0xb8,0xa0,0x26,0xe5,0xe1,0x2e,0xfb,0x1f,0x16,0x5b,0xe1,0x20,0x39,0x07,0x00,0x00
@@ -89,17 +89,74 @@ function readfile(file)
 	xhr.send();
 }
 
+var logSeq = null;
+var logDecoded = false;
+var logEvents = null;
+
+function logAppend(text, replace)
+{
+	var area = document.getElementById("console");
+	area.value = replace ? text : area.value + text;
+	if(area.value.length > 65536){
+		area.value = area.value.substr(area.value.indexOf("\n", area.value.length - 65536) + 1);
+	}
+}
+
+// pushed by the gateway, polling if the browser or the gateway can't
+function logStream(ms)
+{
+	if(!window.EventSource){
+		logRefresh(ms);
+		return;
+	}
+	var events = new EventSource("events?decode=" + (logDecoded ? 1 : 0) + (logSeq == null ? "" : "&seq=" + logSeq));
+	logEvents = events;
+	events.ms = ms;
+	events.onmessage = function(e){
+		logSeq = e.lastEventId;
+		logAppend(e.data + "\n", false);
+	};
+	events.addEventListener("lost", function(e){
+		logAppend("-- lines lost --\n", false);
+	});
+	events.onerror = function(e){
+		if(events.readyState == EventSource.CLOSED && logEvents == events){
+			logEvents = null;
+			logRefresh(ms);
+		}
+	};
+}
+
+// new lines come decoded from now on
+function logDecode(on)
+{
+	logDecoded = on;
+	if(logEvents){
+		logEvents.close();
+		logStream(logEvents.ms);
+	}
+}
+
 function logRefresh(ms)
 {
 	var xhr = getXhr();
 	xhr.onreadystatechange = function(){
 		if(xhr.readyState == 4 ){
-			leselect = xhr.responseText;
-			document.getElementById("console").value=leselect;
-			setTimeout(function(){ logRefresh(); }, ms);
+			if(xhr.status == 200){
+				// only new lines come back, unless some were lost in between
+				if(logSeq == null || xhr.getResponseHeader("X-Log-Overrun")){
+					logAppend((logSeq == null ? "" : "-- lines lost --\n") + xhr.responseText, true);
+				}else{
+					logAppend(xhr.responseText, false);
+				}
+			}
+			if(xhr.getResponseHeader("X-Log-Seq") != null){
+				logSeq = xhr.getResponseHeader("X-Log-Seq");
+			}
+			setTimeout(function(){ logRefresh(ms); }, ms);
 		}
 	}
-	xhr.open("GET","getLogBuffer",true);
+	xhr.open("GET","getLogBuffer?decode=" + (logDecoded ? 1 : 0) + (logSeq == null ? "" : "&seq=" + logSeq),true);
 	xhr.setRequestHeader('Content-Type','application/html');
 	xhr.send();
 }
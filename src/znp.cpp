@@ -0,0 +1,187 @@
+#include "znp.h"
+
+uint8_t znpFcs(const uint8_t *data, size_t len)
+{
+  uint8_t fcs = 0;
+  for (size_t i = 0; i < len; i++)
+  {
+    fcs ^= data[i];
+  }
+  return fcs;
+}
+
+void ZnpFramer::finish(UnitType type)
+{
+  unitType = type;
+  isReady = true;
+  switch (type)
+  {
+  case UNIT_FRAME:
+    counters.frames++;
+    break;
+  case UNIT_BAD_FCS:
+    counters.fcsErrors++;
+    break;
+  case UNIT_RAW:
+    counters.rawUnits++;
+    break;
+  }
+}
+
+void ZnpFramer::release()
+{
+  len = 0;
+  inFrame = false;
+  isReady = false;
+}
+
+size_t ZnpFramer::push(const uint8_t *data, size_t count, uint32_t nowUs)
+{
+  size_t used = 0;
+  while (used < count && !isReady)
+  {
+    uint8_t b = data[used];
+
+    if (!inFrame)
+    {
+      if (b == ZNP_SOF)
+      {
+        if (len > 0)
+        { // flush the raw run first, SOF starts the next unit
+          finish(UNIT_RAW);
+          break;
+        }
+        inFrame = true;
+      }
+      buf[len++] = b;
+      used++;
+      if (!inFrame && len == sizeof(buf))
+      {
+        finish(UNIT_RAW);
+      }
+      continue;
+    }
+
+    buf[len++] = b;
+    used++;
+    if (len == 2 && b > ZNP_MAX_DATA)
+    { // not a valid length, keep it as plain data
+      inFrame = false;
+      continue;
+    }
+    if (len >= ZNP_HEADER_LEN + 1 && len == (size_t)buf[1] + ZNP_HEADER_LEN + 1)
+    {
+      bool fcsOk = znpFcs(buf + 1, len - 2) == buf[len - 1];
+      finish(fcsOk ? UNIT_FRAME : UNIT_BAD_FCS);
+    }
+  }
+  if (used > 0)
+  {
+    lastByteUs = nowUs;
+  }
+  return used;
+}
+
+bool ZnpFramer::poll(uint32_t nowUs)
+{
+  if (pending() && (uint32_t)(nowUs - lastByteUs) >= timeoutUs)
+  {
+    if (inFrame)
+    {
+      counters.timeouts++;
+    }
+    finish(UNIT_RAW);
+  }
+  return isReady;
+}
+
+void ZnpSreqTracker::remove(int index)
+{
+  for (int i = index + 1; i < count; i++)
+  {
+    pending[i - 1] = pending[i];
+  }
+  count--;
+}
+
+void ZnpSreqTracker::request(int client, const uint8_t *frame, size_t len, uint32_t nowMs)
+{
+  if (len < ZNP_HEADER_LEN + 1 || ZNP_TYPE(frame[2]) != ZNP_SREQ)
+    return;
+  // a full table means requests went unanswered, the oldest is stale
+  if (count == MAX_PENDING)
+  {
+    remove(0);
+  }
+  Pending &p = pending[count++];
+  p.client = client;
+  p.subsystem = ZNP_SUBSYSTEM(frame[2]);
+  p.cmd1 = frame[3];
+  p.sentMs = nowMs;
+}
+
+int ZnpSreqTracker::response(const uint8_t *frame, size_t len, uint32_t nowMs)
+{
+  if (len < ZNP_HEADER_LEN + 1 || ZNP_TYPE(frame[2]) != ZNP_SRSP)
+    return -1;
+
+  while (count > 0 && (uint32_t)(nowMs - pending[0].sentMs) >= timeoutMs)
+  {
+    remove(0);
+  }
+
+  uint8_t subsystem = ZNP_SUBSYSTEM(frame[2]);
+  uint8_t cmd1 = frame[3];
+  if (subsystem == 0 && cmd1 == ZNP_RPC_ERROR_CMD1 && frame[1] >= 3)
+  { // the error names the request it rejects
+    subsystem = ZNP_SUBSYSTEM(frame[ZNP_HEADER_LEN + 1]);
+    cmd1 = frame[ZNP_HEADER_LEN + 2];
+  }
+
+  for (int i = 0; i < count; i++)
+  {
+    if (pending[i].subsystem == subsystem && pending[i].cmd1 == cmd1)
+    {
+      int client = pending[i].client;
+      remove(i);
+      return client;
+    }
+  }
+  return -1;
+}
+
+void ZnpSreqTracker::forget(int client)
+{
+  for (int i = count - 1; i >= 0; i--)
+  {
+    if (pending[i].client == client)
+    {
+      remove(i);
+    }
+  }
+}
+
+bool ZnpFilter::set(const uint8_t *data, size_t len)
+{
+  if (len % 2 != 0 || len / 2 > MAX_ENTRIES)
+    return false;
+  entries = len / 2;
+  for (int i = 0; i < entries; i++)
+  {
+    subsystem[i] = ZNP_SUBSYSTEM(data[i * 2]);
+    cmd1[i] = data[i * 2 + 1];
+  }
+  return true;
+}
+
+bool ZnpFilter::accepts(uint8_t cmd0, uint8_t cmd) const
+{
+  if (entries == 0 || ZNP_TYPE(cmd0) != ZNP_AREQ)
+    return true;
+  for (int i = 0; i < entries; i++)
+  {
+    if (subsystem[i] == ZNP_SUBSYSTEM(cmd0) && (cmd1[i] == 0xFF || cmd1[i] == cmd))
+      return true;
+  }
+  return false;
+}
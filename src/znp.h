@@ -0,0 +1,141 @@
+#ifndef ZNP_H_
+#define ZNP_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ZNP (Z-Stack Monitor and Test) UART framing:
+// SOF(0xFE) LEN CMD0 CMD1 DATA[LEN] FCS, FCS = XOR of LEN..DATA
+#define ZNP_SOF 0xFE
+#define ZNP_HEADER_LEN 4
+#define ZNP_MAX_DATA 250
+#define ZNP_MAX_FRAME (ZNP_MAX_DATA + ZNP_HEADER_LEN + 1)
+
+// CMD0: type in bits 7-5, subsystem in bits 4-0
+#define ZNP_TYPE(cmd0) ((cmd0) & 0xE0)
+#define ZNP_SUBSYSTEM(cmd0) ((cmd0) & 0x1F)
+#define ZNP_SREQ 0x20
+#define ZNP_AREQ 0x40
+#define ZNP_SRSP 0x60
+// RPC_SYS_RES0 error SRSP, DATA = ErrCode ReqCmd0 ReqCmd1
+#define ZNP_RPC_ERROR_CMD1 0x00
+
+// SREQs on this subsystem are answered by the bridge, never sent to the ZNP
+#define ZNP_BRIDGE_SUBSYSTEM 0x1F
+// DATA = pairs of subsystem, CMD1 (0xFF any), none to receive all AREQs
+#define ZNP_BRIDGE_SET_FILTER 0x00
+
+uint8_t znpFcs(const uint8_t *data, size_t len);
+
+// dissector for the console (znp_dissect.cpp), names are NULL if unknown
+const char *znpSubsystemName(uint8_t cmd0);
+const char *znpCommandName(uint8_t cmd0, uint8_t cmd1);
+// one whole frame as "SREQ SYS_PING len 0", plus " FCS bad"
+size_t znpDescribe(const uint8_t *frame, size_t len, char *out, size_t max);
+// every whole frame found in data, comma separated
+size_t znpDissect(const uint8_t *data, size_t len, char *out, size_t max);
+
+// Splits a byte stream into units that are forwarded with one write each:
+// complete MT frames, or runs of non-frame bytes flushed on an inter-byte
+// timeout. Pure C++ with time passed in, so recorded streams can be fed
+// through it on the host.
+class ZnpFramer
+{
+public:
+  enum UnitType
+  {
+    UNIT_FRAME,
+    UNIT_BAD_FCS,
+    UNIT_RAW
+  };
+
+  struct Stats
+  {
+    uint32_t frames;
+    uint32_t fcsErrors;
+    uint32_t rawUnits;
+    uint32_t timeouts;
+  };
+
+  void setTimeout(uint32_t us) { timeoutUs = us; }
+  uint32_t timeout() const { return timeoutUs; }
+
+  // feeds bytes until a unit is complete, returns how many were consumed
+  size_t push(const uint8_t *data, size_t len, uint32_t nowUs);
+  // flushes a partial unit once the line has been idle for the timeout
+  bool poll(uint32_t nowUs);
+
+  bool ready() const { return isReady; }
+  bool pending() const { return len > 0 && !isReady; }
+  const uint8_t *data() const { return buf; }
+  size_t length() const { return len; }
+  UnitType type() const { return unitType; }
+  void release();
+
+  const Stats &stats() const { return counters; }
+
+private:
+  void finish(UnitType type);
+
+  uint8_t buf[ZNP_MAX_FRAME];
+  size_t len = 0;
+  bool inFrame = false;
+  bool isReady = false;
+  UnitType unitType = UNIT_RAW;
+  uint32_t lastByteUs = 0;
+  uint32_t timeoutUs = 2000;
+  Stats counters = {};
+};
+
+// AREQ subscription of one client. SREQ/SRSP and non-frame data always
+// pass, AREQs only if a (subsystem, CMD1) entry matches.
+class ZnpFilter
+{
+public:
+  static const int MAX_ENTRIES = 16;
+
+  // DATA of a set filter request, false if it is malformed
+  bool set(const uint8_t *data, size_t len);
+  void clear() { entries = 0; }
+  int count() const { return entries; }
+  bool accepts(uint8_t cmd0, uint8_t cmd1) const;
+
+private:
+  uint8_t subsystem[MAX_ENTRIES];
+  uint8_t cmd1[MAX_ENTRIES];
+  int entries = 0;
+};
+
+// Remembers which client sent each outstanding SREQ so the matching SRSP
+// (same subsystem and CMD1) goes back to that client only. The ZNP answers
+// SREQs in order, so the oldest match wins. Takes whole frames as stored by
+// ZnpFramer (SOF included).
+class ZnpSreqTracker
+{
+public:
+  static const int MAX_PENDING = 16;
+
+  void setTimeout(uint32_t ms) { timeoutMs = ms; }
+
+  void request(int client, const uint8_t *frame, size_t len, uint32_t nowMs);
+  // client waiting for this SRSP, or -1 if it is not a tracked response
+  int response(const uint8_t *frame, size_t len, uint32_t nowMs);
+  void forget(int client);
+
+private:
+  struct Pending
+  {
+    int client;
+    uint8_t subsystem;
+    uint8_t cmd1;
+    uint32_t sentMs;
+  };
+
+  void remove(int index);
+
+  Pending pending[MAX_PENDING];
+  int count = 0;
+  uint32_t timeoutMs = 6000;
+};
+
+#endif
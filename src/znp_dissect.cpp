@@ -0,0 +1,285 @@
+#include <stdio.h>
+#include <string.h>
+#include "znp.h"
+
+// Name tables for the console, const so they stay in flash. Only read when
+// somebody asks for decoded output, the bridge never touches them.
+
+struct ZnpName
+{
+  uint16_t key; // subsystem << 8 | CMD1
+  const char *name;
+};
+
+#define ZNP_KEY(subsystem, cmd1) (uint16_t)((subsystem) << 8 | (cmd1))
+
+static const char *const subsystemNames[32] = {
+    "RPC", "SYS", "MAC", "NWK", "AF", "ZDO", "SAPI", "UTIL",
+    "DEBUG", "APP", "OTA", "ZNP", NULL, "UBL", NULL, "APP_CNF",
+    NULL, NULL, "PROTOBUF", NULL, NULL, "ZGP", NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, "BRIDGE"};
+
+// sorted by key, SREQ/SRSP and AREQ commands share one CMD1 space
+static constexpr ZnpName commandNames[] = {
+    {ZNP_KEY(0x00, 0x00), "ERROR"},
+
+    {ZNP_KEY(0x01, 0x00), "RESET_REQ"},
+    {ZNP_KEY(0x01, 0x01), "PING"},
+    {ZNP_KEY(0x01, 0x02), "VERSION"},
+    {ZNP_KEY(0x01, 0x03), "SET_EXTADDR"},
+    {ZNP_KEY(0x01, 0x04), "GET_EXTADDR"},
+    {ZNP_KEY(0x01, 0x05), "RAM_READ"},
+    {ZNP_KEY(0x01, 0x06), "RAM_WRITE"},
+    {ZNP_KEY(0x01, 0x07), "OSAL_NV_ITEM_INIT"},
+    {ZNP_KEY(0x01, 0x08), "OSAL_NV_READ"},
+    {ZNP_KEY(0x01, 0x09), "OSAL_NV_WRITE"},
+    {ZNP_KEY(0x01, 0x0A), "OSAL_START_TIMER"},
+    {ZNP_KEY(0x01, 0x0B), "OSAL_STOP_TIMER"},
+    {ZNP_KEY(0x01, 0x0C), "RANDOM"},
+    {ZNP_KEY(0x01, 0x0D), "ADC_READ"},
+    {ZNP_KEY(0x01, 0x0E), "GPIO"},
+    {ZNP_KEY(0x01, 0x0F), "STACK_TUNE"},
+    {ZNP_KEY(0x01, 0x10), "SET_TIME"},
+    {ZNP_KEY(0x01, 0x11), "GET_TIME"},
+    {ZNP_KEY(0x01, 0x12), "OSAL_NV_DELETE"},
+    {ZNP_KEY(0x01, 0x13), "OSAL_NV_LENGTH"},
+    {ZNP_KEY(0x01, 0x14), "SET_TX_POWER"},
+    {ZNP_KEY(0x01, 0x1C), "OSAL_NV_READ_EXT"},
+    {ZNP_KEY(0x01, 0x1D), "OSAL_NV_WRITE_EXT"},
+    {ZNP_KEY(0x01, 0x30), "NV_CREATE"},
+    {ZNP_KEY(0x01, 0x31), "NV_DELETE"},
+    {ZNP_KEY(0x01, 0x32), "NV_LENGTH"},
+    {ZNP_KEY(0x01, 0x33), "NV_READ"},
+    {ZNP_KEY(0x01, 0x34), "NV_WRITE"},
+    {ZNP_KEY(0x01, 0x35), "NV_UPDATE"},
+    {ZNP_KEY(0x01, 0x36), "NV_COMPACT"},
+    {ZNP_KEY(0x01, 0x80), "RESET_IND"},
+    {ZNP_KEY(0x01, 0x81), "OSAL_TIMER_EXPIRED"},
+
+    {ZNP_KEY(0x04, 0x00), "REGISTER"},
+    {ZNP_KEY(0x04, 0x01), "DATA_REQUEST"},
+    {ZNP_KEY(0x04, 0x02), "DATA_REQUEST_EXT"},
+    {ZNP_KEY(0x04, 0x03), "DATA_REQUEST_SRC_RTG"},
+    {ZNP_KEY(0x04, 0x04), "DELETE"},
+    {ZNP_KEY(0x04, 0x10), "INTER_PAN_CTL"},
+    {ZNP_KEY(0x04, 0x11), "DATA_STORE"},
+    {ZNP_KEY(0x04, 0x12), "DATA_RETRIEVE"},
+    {ZNP_KEY(0x04, 0x13), "APSF_CONFIG_SET"},
+    {ZNP_KEY(0x04, 0x14), "APSF_CONFIG_GET"},
+    {ZNP_KEY(0x04, 0x80), "DATA_CONFIRM"},
+    {ZNP_KEY(0x04, 0x81), "INCOMING_MSG"},
+    {ZNP_KEY(0x04, 0x82), "INCOMING_MSG_EXT"},
+    {ZNP_KEY(0x04, 0x83), "REFLECT_ERROR"},
+
+    {ZNP_KEY(0x05, 0x00), "NWK_ADDR_REQ"},
+    {ZNP_KEY(0x05, 0x01), "IEEE_ADDR_REQ"},
+    {ZNP_KEY(0x05, 0x02), "NODE_DESC_REQ"},
+    {ZNP_KEY(0x05, 0x03), "POWER_DESC_REQ"},
+    {ZNP_KEY(0x05, 0x04), "SIMPLE_DESC_REQ"},
+    {ZNP_KEY(0x05, 0x05), "ACTIVE_EP_REQ"},
+    {ZNP_KEY(0x05, 0x06), "MATCH_DESC_REQ"},
+    {ZNP_KEY(0x05, 0x07), "COMPLEX_DESC_REQ"},
+    {ZNP_KEY(0x05, 0x08), "USER_DESC_REQ"},
+    {ZNP_KEY(0x05, 0x0A), "END_DEVICE_ANNCE"},
+    {ZNP_KEY(0x05, 0x0B), "USER_DESC_SET"},
+    {ZNP_KEY(0x05, 0x0C), "SERVER_DISC_REQ"},
+    {ZNP_KEY(0x05, 0x20), "END_DEVICE_BIND_REQ"},
+    {ZNP_KEY(0x05, 0x21), "BIND_REQ"},
+    {ZNP_KEY(0x05, 0x22), "UNBIND_REQ"},
+    {ZNP_KEY(0x05, 0x23), "SET_LINK_KEY"},
+    {ZNP_KEY(0x05, 0x24), "REMOVE_LINK_KEY"},
+    {ZNP_KEY(0x05, 0x25), "GET_LINK_KEY"},
+    {ZNP_KEY(0x05, 0x26), "NWK_DISCOVERY_REQ"},
+    {ZNP_KEY(0x05, 0x27), "JOIN_REQ"},
+    {ZNP_KEY(0x05, 0x30), "MGMT_NWK_DISC_REQ"},
+    {ZNP_KEY(0x05, 0x31), "MGMT_LQI_REQ"},
+    {ZNP_KEY(0x05, 0x32), "MGMT_RTG_REQ"},
+    {ZNP_KEY(0x05, 0x33), "MGMT_BIND_REQ"},
+    {ZNP_KEY(0x05, 0x34), "MGMT_LEAVE_REQ"},
+    {ZNP_KEY(0x05, 0x35), "MGMT_DIRECT_JOIN_REQ"},
+    {ZNP_KEY(0x05, 0x36), "MGMT_PERMIT_JOIN_REQ"},
+    {ZNP_KEY(0x05, 0x37), "MGMT_NWK_UPDATE_REQ"},
+    {ZNP_KEY(0x05, 0x3E), "MSG_CB_REGISTER"},
+    {ZNP_KEY(0x05, 0x3F), "MSG_CB_REMOVE"},
+    {ZNP_KEY(0x05, 0x40), "STARTUP_FROM_APP"},
+    {ZNP_KEY(0x05, 0x41), "AUTO_FIND_DESTINATION"},
+    {ZNP_KEY(0x05, 0x80), "NWK_ADDR_RSP"},
+    {ZNP_KEY(0x05, 0x81), "IEEE_ADDR_RSP"},
+    {ZNP_KEY(0x05, 0x82), "NODE_DESC_RSP"},
+    {ZNP_KEY(0x05, 0x83), "POWER_DESC_RSP"},
+    {ZNP_KEY(0x05, 0x84), "SIMPLE_DESC_RSP"},
+    {ZNP_KEY(0x05, 0x85), "ACTIVE_EP_RSP"},
+    {ZNP_KEY(0x05, 0x86), "MATCH_DESC_RSP"},
+    {ZNP_KEY(0x05, 0x87), "COMPLEX_DESC_RSP"},
+    {ZNP_KEY(0x05, 0x88), "USER_DESC_RSP"},
+    {ZNP_KEY(0x05, 0x89), "USER_DESC_CONF"},
+    {ZNP_KEY(0x05, 0x8A), "SERVER_DISC_RSP"},
+    {ZNP_KEY(0x05, 0xA0), "END_DEVICE_BIND_RSP"},
+    {ZNP_KEY(0x05, 0xA1), "BIND_RSP"},
+    {ZNP_KEY(0x05, 0xA2), "UNBIND_RSP"},
+    {ZNP_KEY(0x05, 0xB0), "MGMT_NWK_DISC_RSP"},
+    {ZNP_KEY(0x05, 0xB1), "MGMT_LQI_RSP"},
+    {ZNP_KEY(0x05, 0xB2), "MGMT_RTG_RSP"},
+    {ZNP_KEY(0x05, 0xB3), "MGMT_BIND_RSP"},
+    {ZNP_KEY(0x05, 0xB4), "MGMT_LEAVE_RSP"},
+    {ZNP_KEY(0x05, 0xB5), "MGMT_DIRECT_JOIN_RSP"},
+    {ZNP_KEY(0x05, 0xB6), "MGMT_PERMIT_JOIN_RSP"},
+    {ZNP_KEY(0x05, 0xB8), "MGMT_NWK_UPDATE_NOTIFY"},
+    {ZNP_KEY(0x05, 0xC0), "STATE_CHANGE_IND"},
+    {ZNP_KEY(0x05, 0xC1), "END_DEVICE_ANNCE_IND"},
+    {ZNP_KEY(0x05, 0xC2), "MATCH_DESC_RSP_SENT"},
+    {ZNP_KEY(0x05, 0xC3), "STATUS_ERROR_RSP"},
+    {ZNP_KEY(0x05, 0xC4), "SRC_RTG_IND"},
+    {ZNP_KEY(0x05, 0xC5), "BEACON_NOTIFY_IND"},
+    {ZNP_KEY(0x05, 0xC6), "JOIN_CNF"},
+    {ZNP_KEY(0x05, 0xC7), "NWK_DISCOVERY_CNF"},
+    {ZNP_KEY(0x05, 0xC8), "CONCENTRATOR_IND"},
+    {ZNP_KEY(0x05, 0xC9), "LEAVE_IND"},
+    {ZNP_KEY(0x05, 0xCA), "TC_DEV_IND"},
+    {ZNP_KEY(0x05, 0xCB), "PERMIT_JOIN_IND"},
+    {ZNP_KEY(0x05, 0xFF), "MSG_CB_INCOMING"},
+
+    {ZNP_KEY(0x07, 0x00), "GET_DEVICE_INFO"},
+    {ZNP_KEY(0x07, 0x01), "GET_NV_INFO"},
+    {ZNP_KEY(0x07, 0x02), "SET_PANID"},
+    {ZNP_KEY(0x07, 0x03), "SET_CHANNELS"},
+    {ZNP_KEY(0x07, 0x04), "SET_SECLEVEL"},
+    {ZNP_KEY(0x07, 0x05), "SET_PRECFGKEY"},
+    {ZNP_KEY(0x07, 0x06), "CALLBACK_SUB_CMD"},
+    {ZNP_KEY(0x07, 0x07), "KEY_EVENT"},
+    {ZNP_KEY(0x07, 0x09), "TIME_ALIVE"},
+    {ZNP_KEY(0x07, 0x0A), "LED_CONTROL"},
+    {ZNP_KEY(0x07, 0x10), "LOOPBACK"},
+    {ZNP_KEY(0x07, 0x11), "DATA_REQ"},
+    {ZNP_KEY(0x07, 0x40), "ADDRMGR_EXT_ADDR_LOOKUP"},
+    {ZNP_KEY(0x07, 0x41), "ADDRMGR_NWK_ADDR_LOOKUP"},
+    {ZNP_KEY(0x07, 0x44), "APSME_LINK_KEY_DATA_GET"},
+    {ZNP_KEY(0x07, 0x45), "APSME_LINK_KEY_NV_ID_GET"},
+    {ZNP_KEY(0x07, 0x48), "ASSOC_COUNT"},
+    {ZNP_KEY(0x07, 0x49), "ASSOC_FIND_DEVICE"},
+    {ZNP_KEY(0x07, 0x4A), "ASSOC_GET_WITH_ADDRESS"},
+    {ZNP_KEY(0x07, 0x4B), "APSME_REQUEST_KEY_CMD"},
+    {ZNP_KEY(0x07, 0x4D), "BIND_ADD_ENTRY"},
+    {ZNP_KEY(0x07, 0xE0), "SYNC_REQ"},
+
+    {ZNP_KEY(0x09, 0x00), "MSG"},
+    {ZNP_KEY(0x09, 0x01), "USER_TEST"},
+    {ZNP_KEY(0x09, 0x80), "ZLL_TL_IND"},
+
+    {ZNP_KEY(0x0F, 0x03), "SET_ALLOWREJOIN_TC_POLICY"},
+    {ZNP_KEY(0x0F, 0x04), "BDB_ADD_INSTALLCODE"},
+    {ZNP_KEY(0x0F, 0x05), "BDB_START_COMMISSIONING"},
+    {ZNP_KEY(0x0F, 0x06), "BDB_SET_JOINUSESINSTALLCODEKEY"},
+    {ZNP_KEY(0x0F, 0x07), "BDB_SET_ACTIVE_DEFAULT_CENTRALIZED_KEY"},
+    {ZNP_KEY(0x0F, 0x08), "BDB_SET_CHANNEL"},
+    {ZNP_KEY(0x0F, 0x09), "BDB_SET_TC_REQUIRE_KEY_EXCHANGE"},
+    {ZNP_KEY(0x0F, 0x80), "BDB_COMMISSIONING_NOTIFICATION"},
+
+    {ZNP_KEY(ZNP_BRIDGE_SUBSYSTEM, ZNP_BRIDGE_SET_FILTER), "SET_FILTER"},
+};
+
+static constexpr size_t commandCount = sizeof(commandNames) / sizeof(commandNames[0]);
+
+static constexpr bool commandsSorted(size_t i)
+{
+  return i + 1 >= commandCount || (commandNames[i].key < commandNames[i + 1].key && commandsSorted(i + 1));
+}
+static_assert(commandsSorted(0), "commandNames must be sorted by key");
+
+const char *znpSubsystemName(uint8_t cmd0)
+{
+  return subsystemNames[ZNP_SUBSYSTEM(cmd0)];
+}
+
+const char *znpCommandName(uint8_t cmd0, uint8_t cmd1)
+{
+  uint16_t key = ZNP_KEY(ZNP_SUBSYSTEM(cmd0), cmd1);
+  size_t low = 0;
+  size_t high = commandCount;
+  while (low < high)
+  {
+    size_t mid = (low + high) / 2;
+    if (commandNames[mid].key < key)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  if (low < commandCount && commandNames[low].key == key)
+    return commandNames[low].name;
+  return NULL;
+}
+
+size_t znpDescribe(const uint8_t *frame, size_t len, char *out, size_t max)
+{
+  if (max == 0)
+    return 0;
+  if (len < ZNP_HEADER_LEN + 1 || frame[0] != ZNP_SOF || len != (size_t)frame[1] + ZNP_HEADER_LEN + 1)
+  {
+    out[0] = 0;
+    return 0;
+  }
+
+  uint8_t cmd0 = frame[2];
+  uint8_t cmd1 = frame[3];
+  const char *type;
+  switch (ZNP_TYPE(cmd0))
+  {
+  case ZNP_SREQ:
+    type = "SREQ";
+    break;
+  case ZNP_AREQ:
+    type = "AREQ";
+    break;
+  case ZNP_SRSP:
+    type = "SRSP";
+    break;
+  default:
+    type = "POLL";
+    break;
+  }
+
+  char subsystem[8];
+  const char *name = znpSubsystemName(cmd0);
+  if (!name)
+  {
+    snprintf(subsystem, sizeof(subsystem), "0x%02x", ZNP_SUBSYSTEM(cmd0));
+    name = subsystem;
+  }
+  char command[8];
+  const char *commandName = znpCommandName(cmd0, cmd1);
+  if (!commandName)
+  {
+    snprintf(command, sizeof(command), "0x%02x", cmd1);
+    commandName = command;
+  }
+  bool fcsOk = znpFcs(frame + 1, len - 2) == frame[len - 1];
+
+  int n = snprintf(out, max, "%s %s_%s len %u%s", type, name, commandName, frame[1], fcsOk ? "" : " FCS bad");
+  return n < 0 ? 0 : ((size_t)n < max ? n : max - 1);
+}
+
+size_t znpDissect(const uint8_t *data, size_t len, char *out, size_t max)
+{
+  size_t done = 0;
+  size_t pos = 0;
+  if (max > 0)
+    out[0] = 0;
+  while (pos + ZNP_HEADER_LEN + 1 <= len && done + 1 < max)
+  {
+    size_t frameLen = (size_t)data[pos + 1] + ZNP_HEADER_LEN + 1;
+    if (data[pos] != ZNP_SOF || pos + frameLen > len)
+    {
+      pos++;
+      continue;
+    }
+    if (done > 0)
+    {
+      done += snprintf(out + done, max - done, ", ");
+      if (done >= max)
+        return max - 1;
+    }
+    done += znpDescribe(data + pos, frameLen, out + done, max - done);
+    pos += frameLen;
+  }
+  return done;
+}
@@ -0,0 +1,114 @@
+// BroadcastRing positions wrapping around SIZE_MAX: pio test -e native
+#include <stdint.h>
+#include <string.h>
+#include <unity.h>
+#include "ring.h"
+
+static BroadcastRing ring;
+
+// what reader would send from cursor on, up to the next range it skips
+static size_t readable(size_t cursor, int reader, uint8_t *out)
+{
+  const uint8_t *ptr[2];
+  size_t span[2];
+  size_t len = 0;
+  int count = ring.spans(cursor, reader, ptr, span);
+  for (int i = 0; i < count; i++)
+  {
+    memcpy(out + len, ptr[i], span[i]);
+    len += span[i];
+  }
+  return len;
+}
+
+void setUp()
+{
+  ring.begin(ByteRing::RING_MIN_SIZE);
+}
+
+void tearDown()
+{
+}
+
+void test_limited_write_across_wrap()
+{
+  const uint8_t before[4] = {1, 2, 3, 4};
+  const uint8_t limited[8] = {10, 11, 12, 13, 14, 15, 16, 17};
+  const uint8_t after[4] = {5, 6, 7, 8};
+  size_t start = SIZE_MAX - 9;
+  ring.restart(start);
+  ring.write(before, sizeof(before), BroadcastRing::ALL_READERS);
+  // from SIZE_MAX - 5 to 2, for reader 1 only
+  ring.write(limited, sizeof(limited), 1 << 1);
+  ring.write(after, sizeof(after), BroadcastRing::ALL_READERS);
+  TEST_ASSERT_EQUAL(6, ring.head());
+
+  // reader 0 stops in front of the range, skips it and reads on
+  uint8_t out[32];
+  size_t cursor = ring.skip(start, 0);
+  TEST_ASSERT_EQUAL(start, cursor);
+  TEST_ASSERT_EQUAL(sizeof(before), readable(cursor, 0, out));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(before, out, sizeof(before));
+  cursor += sizeof(before);
+  TEST_ASSERT_EQUAL(0, readable(cursor, 0, out));
+  cursor = ring.skip(cursor, 0);
+  TEST_ASSERT_EQUAL(2, cursor);
+  TEST_ASSERT_EQUAL(sizeof(after), readable(cursor, 0, out));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(after, out, sizeof(after));
+
+  // reader 1 gets everything
+  TEST_ASSERT_EQUAL(start, ring.skip(start, 1));
+  TEST_ASSERT_EQUAL(16, readable(start, 1, out));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(limited, out + sizeof(before), sizeof(limited));
+}
+
+void test_release_across_wrap()
+{
+  const uint8_t data[8] = {};
+  size_t start = SIZE_MAX - 3;
+  ring.restart(start);
+  ring.write(data, sizeof(data), 1 << 1);
+
+  // the range ends at 4, past the wrap
+  TEST_ASSERT_EQUAL(4, ring.skip(start, 0));
+  ring.release(3);
+  TEST_ASSERT_EQUAL(4, ring.skip(start, 0));
+  ring.release(4);
+  TEST_ASSERT_EQUAL(start, ring.skip(start, 0));
+}
+
+void test_overwritten_range_dropped_across_wrap()
+{
+  uint8_t data[200] = {};
+  size_t start = SIZE_MAX - 309;
+  ring.restart(start);
+  ring.write(data, 10, 1 << 1);
+  TEST_ASSERT_EQUAL(start + 10, ring.skip(start, 0));
+
+  // the range's bytes are overwritten by a write that wraps the position
+  ring.write(data, sizeof(data), BroadcastRing::ALL_READERS);
+  TEST_ASSERT_EQUAL(start + 10, ring.skip(start, 0));
+  ring.write(data, sizeof(data), BroadcastRing::ALL_READERS);
+  TEST_ASSERT_EQUAL(100, ring.head());
+  TEST_ASSERT_EQUAL(start, ring.skip(start, 0));
+}
+
+void test_lag_across_wrap()
+{
+  const uint8_t data[16] = {};
+  size_t start = SIZE_MAX - 7;
+  ring.restart(start);
+  ring.write(data, sizeof(data));
+  TEST_ASSERT_EQUAL(sizeof(data), ring.lag(start));
+  TEST_ASSERT_EQUAL(0, ring.lag(ring.head()));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_limited_write_across_wrap);
+  RUN_TEST(test_release_across_wrap);
+  RUN_TEST(test_overwritten_range_dropped_across_wrap);
+  RUN_TEST(test_lag_across_wrap);
+  return UNITY_END();
+}
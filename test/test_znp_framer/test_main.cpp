@@ -0,0 +1,192 @@
+// ZnpFramer on the host: pio test -e native
+#include <string.h>
+#include <unity.h>
+#include "znp.h"
+
+// SOF LEN CMD0 CMD1 DATA FCS into out, returns the frame length
+static size_t frame(uint8_t *out, uint8_t cmd0, uint8_t cmd1, const uint8_t *data, uint8_t len)
+{
+  out[0] = ZNP_SOF;
+  out[1] = len;
+  out[2] = cmd0;
+  out[3] = cmd1;
+  memcpy(out + ZNP_HEADER_LEN, data, len);
+  out[ZNP_HEADER_LEN + len] = znpFcs(out + 1, len + ZNP_HEADER_LEN - 1);
+  return len + ZNP_HEADER_LEN + 1;
+}
+
+static const uint8_t payload[] = {0x01, 0x02, 0x03, 0xFE, 0x05};
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_whole_frame()
+{
+  ZnpFramer framer;
+  uint8_t buf[ZNP_MAX_FRAME];
+  size_t len = frame(buf, 0x21, 0x02, payload, sizeof(payload));
+
+  TEST_ASSERT_EQUAL(len, framer.push(buf, len, 0));
+  TEST_ASSERT_TRUE(framer.ready());
+  TEST_ASSERT_EQUAL(ZnpFramer::UNIT_FRAME, framer.type());
+  TEST_ASSERT_EQUAL(len, framer.length());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(buf, framer.data(), len);
+  TEST_ASSERT_EQUAL(1, framer.stats().frames);
+}
+
+void test_split_frame()
+{
+  ZnpFramer framer;
+  uint8_t buf[ZNP_MAX_FRAME];
+  size_t len = frame(buf, 0x61, 0x02, payload, sizeof(payload));
+
+  // a byte at a time, as a slow UART delivers it
+  for (size_t i = 0; i < len; i++)
+  {
+    TEST_ASSERT_FALSE(framer.ready());
+    TEST_ASSERT_EQUAL(1, framer.push(buf + i, 1, i * 100));
+  }
+  TEST_ASSERT_TRUE(framer.ready());
+  TEST_ASSERT_EQUAL(ZnpFramer::UNIT_FRAME, framer.type());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(buf, framer.data(), len);
+
+  // the idle gap is below the timeout, so no partial unit was flushed
+  TEST_ASSERT_EQUAL(0, framer.stats().rawUnits);
+  TEST_ASSERT_EQUAL(0, framer.stats().timeouts);
+}
+
+void test_concatenated_frames()
+{
+  ZnpFramer framer;
+  uint8_t buf[2 * ZNP_MAX_FRAME];
+  size_t first = frame(buf, 0x21, 0x01, payload, 0);
+  size_t second = frame(buf + first, 0x45, 0xC1, payload, sizeof(payload));
+
+  // push stops at the end of the first frame and leaves the rest
+  TEST_ASSERT_EQUAL(first, framer.push(buf, first + second, 0));
+  TEST_ASSERT_TRUE(framer.ready());
+  TEST_ASSERT_EQUAL(first, framer.length());
+  TEST_ASSERT_EQUAL(0, framer.push(buf + first, second, 0));
+  framer.release();
+
+  TEST_ASSERT_EQUAL(second, framer.push(buf + first, second, 0));
+  TEST_ASSERT_TRUE(framer.ready());
+  TEST_ASSERT_EQUAL(ZnpFramer::UNIT_FRAME, framer.type());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(buf + first, framer.data(), second);
+  TEST_ASSERT_EQUAL(2, framer.stats().frames);
+}
+
+void test_bad_fcs()
+{
+  ZnpFramer framer;
+  uint8_t buf[ZNP_MAX_FRAME];
+  size_t len = frame(buf, 0x21, 0x02, payload, sizeof(payload));
+  buf[len - 1] ^= 0x5A;
+
+  // still one unit of the declared length, forwarded as it came
+  TEST_ASSERT_EQUAL(len, framer.push(buf, len, 0));
+  TEST_ASSERT_TRUE(framer.ready());
+  TEST_ASSERT_EQUAL(ZnpFramer::UNIT_BAD_FCS, framer.type());
+  TEST_ASSERT_EQUAL(len, framer.length());
+  TEST_ASSERT_EQUAL(1, framer.stats().fcsErrors);
+  TEST_ASSERT_EQUAL(0, framer.stats().frames);
+}
+
+void test_garbage_before_frame()
+{
+  ZnpFramer framer;
+  uint8_t buf[8 + ZNP_MAX_FRAME] = {0x00, 0x11, 0x22};
+  size_t len = 3 + frame(buf + 3, 0x41, 0x80, payload, 1);
+
+  // the raw run ends at the SOF, which starts the next unit
+  TEST_ASSERT_EQUAL(3, framer.push(buf, len, 0));
+  TEST_ASSERT_TRUE(framer.ready());
+  TEST_ASSERT_EQUAL(ZnpFramer::UNIT_RAW, framer.type());
+  TEST_ASSERT_EQUAL(3, framer.length());
+  framer.release();
+
+  TEST_ASSERT_EQUAL(len - 3, framer.push(buf + 3, len - 3, 0));
+  TEST_ASSERT_EQUAL(ZnpFramer::UNIT_FRAME, framer.type());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(buf + 3, framer.data(), len - 3);
+}
+
+void test_garbage_flushed_on_timeout()
+{
+  ZnpFramer framer;
+  framer.setTimeout(2000);
+  const uint8_t garbage[] = {0x10, 0x20, 0x30};
+
+  TEST_ASSERT_EQUAL(sizeof(garbage), framer.push(garbage, sizeof(garbage), 1000));
+  TEST_ASSERT_TRUE(framer.pending());
+  TEST_ASSERT_FALSE(framer.poll(2999));
+  TEST_ASSERT_TRUE(framer.poll(3000));
+  TEST_ASSERT_EQUAL(ZnpFramer::UNIT_RAW, framer.type());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(garbage, framer.data(), sizeof(garbage));
+  // not counted as a timeout, no frame was cut
+  TEST_ASSERT_EQUAL(0, framer.stats().timeouts);
+}
+
+void test_truncated_frame_times_out()
+{
+  ZnpFramer framer;
+  framer.setTimeout(2000);
+  uint8_t buf[ZNP_MAX_FRAME];
+  size_t len = frame(buf, 0x21, 0x02, payload, sizeof(payload));
+
+  // the clock wraps in between, the idle time still counts
+  framer.push(buf, len - 2, 0xFFFFFF00);
+  TEST_ASSERT_FALSE(framer.poll(0xFFFFFFFF));
+  TEST_ASSERT_TRUE(framer.poll(0x00000800));
+  TEST_ASSERT_EQUAL(ZnpFramer::UNIT_RAW, framer.type());
+  TEST_ASSERT_EQUAL(len - 2, framer.length());
+  TEST_ASSERT_EQUAL(1, framer.stats().timeouts);
+}
+
+void test_bad_length_is_raw()
+{
+  ZnpFramer framer;
+  const uint8_t buf[] = {ZNP_SOF, ZNP_MAX_DATA + 1, 0x21, 0x02};
+
+  // no frame can be that long, so the bytes don't wait for one
+  TEST_ASSERT_EQUAL(sizeof(buf), framer.push(buf, sizeof(buf), 0));
+  TEST_ASSERT_FALSE(framer.ready());
+  TEST_ASSERT_TRUE(framer.poll(framer.timeout()));
+  TEST_ASSERT_EQUAL(ZnpFramer::UNIT_RAW, framer.type());
+  TEST_ASSERT_EQUAL(0, framer.stats().timeouts);
+}
+
+void test_long_garbage_run()
+{
+  ZnpFramer framer;
+  uint8_t garbage[ZNP_MAX_FRAME + 10];
+  memset(garbage, 0x55, sizeof(garbage));
+
+  // a run fills the buffer at most, the rest is the next unit
+  TEST_ASSERT_EQUAL(ZNP_MAX_FRAME, framer.push(garbage, sizeof(garbage), 0));
+  TEST_ASSERT_TRUE(framer.ready());
+  TEST_ASSERT_EQUAL(ZnpFramer::UNIT_RAW, framer.type());
+  TEST_ASSERT_EQUAL(ZNP_MAX_FRAME, framer.length());
+  framer.release();
+  TEST_ASSERT_EQUAL(10, framer.push(garbage + ZNP_MAX_FRAME, 10, 0));
+  TEST_ASSERT_TRUE(framer.pending());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_whole_frame);
+  RUN_TEST(test_split_frame);
+  RUN_TEST(test_concatenated_frames);
+  RUN_TEST(test_bad_fcs);
+  RUN_TEST(test_garbage_before_frame);
+  RUN_TEST(test_garbage_flushed_on_timeout);
+  RUN_TEST(test_truncated_frame_times_out);
+  RUN_TEST(test_bad_length_is_raw);
+  RUN_TEST(test_long_garbage_run);
+  return UNITY_END();
+}
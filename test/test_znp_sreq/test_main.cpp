@@ -0,0 +1,141 @@
+// ZnpSreqTracker on the host: pio test -e native
+#include <string.h>
+#include <unity.h>
+#include "znp.h"
+
+// whole frame as ZnpFramer stores it, data after CMD1
+struct Frame
+{
+  uint8_t bytes[ZNP_MAX_FRAME];
+  size_t len;
+
+  Frame(uint8_t cmd0, uint8_t cmd1, const uint8_t *data = NULL, uint8_t count = 0)
+  {
+    bytes[0] = ZNP_SOF;
+    bytes[1] = count;
+    bytes[2] = cmd0;
+    bytes[3] = cmd1;
+    if (count)
+      memcpy(bytes + ZNP_HEADER_LEN, data, count);
+    len = count + ZNP_HEADER_LEN + 1;
+    bytes[len - 1] = znpFcs(bytes + 1, len - 2);
+  }
+};
+
+// SYS_PING and ZDO_MGMT_PERMIT_JOIN_REQ
+static const Frame ping(ZNP_SREQ | 0x01, 0x01);
+static const Frame pingRsp(ZNP_SRSP | 0x01, 0x01);
+static const Frame permit(ZNP_SREQ | 0x05, 0x36);
+static const Frame permitRsp(ZNP_SRSP | 0x05, 0x36);
+
+static ZnpSreqTracker tracker;
+
+void setUp()
+{
+  tracker = ZnpSreqTracker();
+  tracker.setTimeout(1000);
+}
+
+void tearDown()
+{
+}
+
+void test_same_command_from_several_clients()
+{
+  // the ZNP answers in order, so the SRSPs go out in request order
+  tracker.request(2, ping.bytes, ping.len, 0);
+  tracker.request(0, ping.bytes, ping.len, 1);
+  tracker.request(1, ping.bytes, ping.len, 2);
+  TEST_ASSERT_EQUAL(2, tracker.response(pingRsp.bytes, pingRsp.len, 10));
+  TEST_ASSERT_EQUAL(0, tracker.response(pingRsp.bytes, pingRsp.len, 11));
+  TEST_ASSERT_EQUAL(1, tracker.response(pingRsp.bytes, pingRsp.len, 12));
+  TEST_ASSERT_EQUAL(-1, tracker.response(pingRsp.bytes, pingRsp.len, 13));
+}
+
+void test_different_commands_interleaved()
+{
+  tracker.request(0, ping.bytes, ping.len, 0);
+  tracker.request(1, permit.bytes, permit.len, 0);
+  tracker.request(2, ping.bytes, ping.len, 0);
+  TEST_ASSERT_EQUAL(1, tracker.response(permitRsp.bytes, permitRsp.len, 5));
+  TEST_ASSERT_EQUAL(0, tracker.response(pingRsp.bytes, pingRsp.len, 5));
+  TEST_ASSERT_EQUAL(2, tracker.response(pingRsp.bytes, pingRsp.len, 5));
+}
+
+void test_rpc_error_names_request()
+{
+  const uint8_t error[] = {0x02, ZNP_SREQ | 0x05, 0x36};
+  const Frame errorRsp(ZNP_SRSP, ZNP_RPC_ERROR_CMD1, error, sizeof(error));
+  tracker.request(0, ping.bytes, ping.len, 0);
+  tracker.request(1, permit.bytes, permit.len, 0);
+  TEST_ASSERT_EQUAL(1, tracker.response(errorRsp.bytes, errorRsp.len, 5));
+  TEST_ASSERT_EQUAL(0, tracker.response(pingRsp.bytes, pingRsp.len, 5));
+}
+
+void test_timeout_expiry()
+{
+  tracker.request(0, ping.bytes, ping.len, 0);
+  tracker.request(1, ping.bytes, ping.len, 500);
+  // the first went unanswered, its late SRSP belongs to the second
+  TEST_ASSERT_EQUAL(1, tracker.response(pingRsp.bytes, pingRsp.len, 1000));
+  TEST_ASSERT_EQUAL(-1, tracker.response(pingRsp.bytes, pingRsp.len, 1001));
+
+  tracker.request(2, permit.bytes, permit.len, 2000);
+  TEST_ASSERT_EQUAL(-1, tracker.response(permitRsp.bytes, permitRsp.len, 3000));
+}
+
+void test_timeout_across_clock_wrap()
+{
+  tracker.request(0, ping.bytes, ping.len, 0xFFFFFF00);
+  TEST_ASSERT_EQUAL(0, tracker.response(pingRsp.bytes, pingRsp.len, 0x00000100));
+  tracker.request(1, ping.bytes, ping.len, 0xFFFFFF00);
+  TEST_ASSERT_EQUAL(-1, tracker.response(pingRsp.bytes, pingRsp.len, 0x00000400));
+}
+
+void test_full_table_drops_oldest()
+{
+  for (int i = 0; i <= ZnpSreqTracker::MAX_PENDING; i++)
+  {
+    tracker.request(i, ping.bytes, ping.len, 0);
+  }
+  // client 0's request was pushed out by the last one
+  for (int i = 1; i <= ZnpSreqTracker::MAX_PENDING; i++)
+  {
+    TEST_ASSERT_EQUAL(i, tracker.response(pingRsp.bytes, pingRsp.len, 1));
+  }
+  TEST_ASSERT_EQUAL(-1, tracker.response(pingRsp.bytes, pingRsp.len, 1));
+}
+
+void test_forget_client()
+{
+  tracker.request(0, ping.bytes, ping.len, 0);
+  tracker.request(1, ping.bytes, ping.len, 0);
+  tracker.request(0, permit.bytes, permit.len, 0);
+  tracker.forget(0);
+  TEST_ASSERT_EQUAL(1, tracker.response(pingRsp.bytes, pingRsp.len, 1));
+  TEST_ASSERT_EQUAL(-1, tracker.response(permitRsp.bytes, permitRsp.len, 1));
+}
+
+void test_only_sreq_and_srsp_tracked()
+{
+  const Frame areq(ZNP_AREQ | 0x01, 0x01);
+  tracker.request(0, areq.bytes, areq.len, 0);
+  TEST_ASSERT_EQUAL(-1, tracker.response(pingRsp.bytes, pingRsp.len, 1));
+  tracker.request(0, ping.bytes, ping.len, 0);
+  TEST_ASSERT_EQUAL(-1, tracker.response(areq.bytes, areq.len, 1));
+  TEST_ASSERT_EQUAL(0, tracker.response(pingRsp.bytes, pingRsp.len, 1));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_same_command_from_several_clients);
+  RUN_TEST(test_different_commands_interleaved);
+  RUN_TEST(test_rpc_error_names_request);
+  RUN_TEST(test_timeout_expiry);
+  RUN_TEST(test_timeout_across_clock_wrap);
+  RUN_TEST(test_full_table_drops_oldest);
+  RUN_TEST(test_forget_client);
+  RUN_TEST(test_only_sreq_and_srsp_tracked);
+  return UNITY_END();
+}
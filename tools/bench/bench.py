@@ -0,0 +1,378 @@
+#!/usr/bin/env python3
+""" Bridge benchmark: runs the native bridge (pio run -e native) against a
+simulated ZNP coprocessor on its pty and N TCP clients, across baud rates
+and client counts. Reports frames/s, bytes/s, latency percentiles and drops
+for both directions. """
+
+import argparse
+import json
+import os
+import select
+import socket
+import struct
+import subprocess
+import sys
+import termios
+import threading
+import time
+import tty
+
+SOF = 0xFE
+# SYS subsystem, SREQ/SRSP/AREQ
+SYS_PING = 0x01
+SYS_VERSION = 0x02
+# not used by Z-Stack, the simulator echoes it with its payload
+BENCH_ECHO = 0xF0
+# AF_INCOMING_MSG
+AF_AREQ = (0x44, 0x81)
+
+SREQ_TIMEOUT = 1.0
+
+BENCH_FMT = '<BIQ'  # client, seq, send time (ns)
+BENCH_LEN = struct.calcsize(BENCH_FMT)
+
+
+def now_ns():
+    return time.monotonic_ns()
+
+
+def fcs(data):
+    x = 0
+    for b in data:
+        x ^= b
+    return x
+
+
+def frame(cmd0, cmd1, data=b''):
+    body = bytes([len(data), cmd0, cmd1]) + data
+    return bytes([SOF]) + body + bytes([fcs(body)])
+
+
+class Parser:
+    """ Splits a byte stream into ZNP frames, skips anything else. """
+
+    def __init__(self):
+        self.buf = bytearray()
+
+    def feed(self, data):
+        self.buf += data
+        frames = []
+        while True:
+            start = self.buf.find(SOF)
+            if start < 0:
+                self.buf.clear()
+                break
+            del self.buf[:start]
+            if len(self.buf) < 2:
+                break
+            end = self.buf[1] + 5
+            if len(self.buf) < end:
+                break
+            f = bytes(self.buf[:end])
+            del self.buf[:end]
+            if fcs(f[1:-1]) == f[-1]:
+                frames.append(f)
+        return frames
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latency = []
+        self.frames = 0
+        self.bytes = 0
+        self.drops = 0
+
+    def add(self, latency_ns, size):
+        with self.lock:
+            self.latency.append(latency_ns)
+            self.frames += 1
+            self.bytes += size
+
+    def report(self, seconds):
+        lat = sorted(self.latency)
+
+        def pct(p):
+            if not lat:
+                return None
+            return lat[min(len(lat) - 1, int(len(lat) * p))] / 1000.0
+
+        return {
+            'frames': self.frames,
+            'frames_s': round(self.frames / seconds, 1),
+            'bytes_s': round(self.bytes / seconds, 1),
+            'p50_us': pct(0.50),
+            'p99_us': pct(0.99),
+            'p999_us': pct(0.999),
+            'drops': self.drops,
+        }
+
+
+class Coprocessor:
+    """ Plays the ZNP on the pty: answers SYS_PING, SYS_VERSION and bench
+    echoes, sends AREQ bursts. Like a real UART it reads and writes at the
+    same time, writes are paced to the baud rate. """
+
+    def __init__(self, path, baud, burst, interval, areq_size, to_uart):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(self.fd)
+        termios.tcflush(self.fd, termios.TCIOFLUSH)
+        self.byte_ns = 10 * 1e9 / baud
+        self.burst = burst
+        self.interval = interval / 1000.0
+        self.areq_size = max(areq_size, 4 + BENCH_LEN)
+        self.to_uart = to_uart
+        self.parser = Parser()
+        self.responses = []
+        self.cond = threading.Condition()
+        self.line_free = now_ns()
+        self.seq = 0
+        self.running = True
+        self.reader = threading.Thread(target=self.read_loop, daemon=True)
+        self.writer = threading.Thread(target=self.write_loop, daemon=True)
+
+    def start(self):
+        self.reader.start()
+        self.writer.start()
+
+    def send(self, data):
+        # the line is busy until the previous frame is out, AREQs are
+        # stamped when their last byte would leave the UART
+        self.line_free = max(now_ns(), self.line_free) + len(data) * self.byte_ns
+        delay = (self.line_free - now_ns()) / 1e9
+        if delay > 0:
+            time.sleep(delay)
+        if data[2:4] == bytes(AF_AREQ):
+            data = self.areq(now_ns())
+        os.write(self.fd, data)
+
+    def areq(self, stamp):
+        payload = struct.pack(BENCH_FMT, 0xFF, self.seq, stamp)
+        pad = bytes(self.areq_size - 4 - len(payload))
+        return frame(*AF_AREQ, payload + pad)
+
+    def respond(self, data):
+        with self.cond:
+            self.responses.append(data)
+            self.cond.notify()
+
+    def handle(self, f):
+        cmd0, cmd1, data = f[2], f[3], f[4:-1]
+        if cmd0 != 0x21:
+            return
+        if cmd1 == SYS_PING:
+            self.respond(frame(0x61, SYS_PING, b'\x79\x01'))
+        elif cmd1 == SYS_VERSION:
+            self.respond(frame(0x61, SYS_VERSION, b'\x02\x01\x02\x07\x01'))
+        elif cmd1 == BENCH_ECHO and len(data) >= BENCH_LEN:
+            client, seq, sent = struct.unpack_from(BENCH_FMT, data)
+            self.to_uart.add(now_ns() - sent, len(f))
+            self.respond(frame(0x61, BENCH_ECHO, data))
+
+    def read_loop(self):
+        while self.running:
+            r, _, _ = select.select([self.fd], [], [], 0.05)
+            if r:
+                for f in self.parser.feed(os.read(self.fd, 4096)):
+                    self.handle(f)
+
+    def write_loop(self):
+        next_burst = time.monotonic()
+        while self.running:
+            with self.cond:
+                wait = max(0.0, next_burst - time.monotonic()) if self.burst else 0.05
+                if not self.responses:
+                    self.cond.wait(min(wait, 0.05))
+                pending, self.responses = self.responses, []
+            for data in pending:
+                self.send(data)
+            if self.burst and time.monotonic() >= next_burst:
+                for _ in range(self.burst):
+                    self.send(self.areq(0))
+                    self.seq += 1
+                next_burst += self.interval
+
+    def stop(self):
+        self.running = False
+        self.reader.join()
+        self.writer.join()
+        os.close(self.fd)
+
+
+class Client(threading.Thread):
+    """ Sends bench echoes at a fixed rate and checks every frame it gets.
+    Like a real host it waits for the SRSP (or a timeout) before the next
+    SREQ. """
+
+    def __init__(self, cid, port, rate, from_uart, to_uart):
+        super().__init__(daemon=True)
+        self.cid = cid
+        self.sock = socket.create_connection(('127.0.0.1', port))
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.rate = rate
+        self.from_uart = from_uart
+        self.to_uart = to_uart
+        self.parser = Parser()
+        self.seq = 0
+        self.waiting = None
+        self.answered = set()
+        self.areq_seq = None
+        self.foreign = 0
+        self.running = True
+
+    def request(self):
+        payload = struct.pack(BENCH_FMT, self.cid, self.seq, now_ns())
+        self.waiting = self.seq
+        self.waiting_since = time.monotonic()
+        self.seq += 1
+        self.sock.sendall(frame(0x21, BENCH_ECHO, payload))
+
+    def receive(self, f):
+        cmd0, cmd1, data = f[2], f[3], f[4:-1]
+        if (cmd0, cmd1) == AF_AREQ and len(data) >= BENCH_LEN:
+            _, seq, sent = struct.unpack_from(BENCH_FMT, data)
+            self.from_uart.add(now_ns() - sent, len(f))
+            if self.areq_seq is not None and seq > self.areq_seq + 1:
+                with self.from_uart.lock:
+                    self.from_uart.drops += seq - self.areq_seq - 1
+            self.areq_seq = seq
+        elif (cmd0, cmd1) == (0x61, BENCH_ECHO) and len(data) >= BENCH_LEN:
+            client, seq, sent = struct.unpack_from(BENCH_FMT, data)
+            if client == self.cid:
+                self.answered.add(seq)
+                if seq == self.waiting:
+                    self.waiting = None
+            else:
+                # a response routed to the wrong client
+                self.foreign += 1
+
+    def run(self):
+        self.sock.sendall(frame(0x21, SYS_VERSION))
+        period = 1.0 / self.rate if self.rate else None
+        next_send = time.monotonic()
+        while self.running:
+            timeout = 0.05
+            if period:
+                timeout = max(0.0, min(timeout, next_send - time.monotonic()))
+            r, _, _ = select.select([self.sock], [], [], timeout)
+            if r:
+                data = self.sock.recv(65536)
+                if not data:
+                    break
+                for f in self.parser.feed(data):
+                    self.receive(f)
+            if self.waiting is not None and time.monotonic() - self.waiting_since > SREQ_TIMEOUT:
+                self.waiting = None
+            if period and self.waiting is None and time.monotonic() >= next_send:
+                self.request()
+                next_send = max(next_send + period, time.monotonic() - period)
+
+    def stop(self):
+        self.running = False
+        self.join()
+        self.sock.close()
+        # whatever was never echoed back got lost on the way
+        with self.to_uart.lock:
+            self.to_uart.drops += self.seq - len(self.answered)
+
+
+def run_case(args, baud, clients):
+    link = '/tmp/zigstar-bench-%d' % os.getpid()
+    cmd = [args.bridge, '-f', '-p', str(args.port), '-l', link]
+    bridge = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+    try:
+        bridge.stdout.readline()  # uart
+        bridge.stdout.readline()  # tcp
+
+        from_uart = Stats()
+        to_uart = Stats()
+        sim = Coprocessor(link, baud, args.burst, args.interval, args.areq_size, to_uart)
+        sim.start()
+        conns = [Client(i, args.port, args.rate, from_uart, to_uart) for i in range(clients)]
+        for c in conns:
+            c.start()
+
+        time.sleep(args.warmup)
+        for s in (from_uart, to_uart):
+            with s.lock:
+                s.latency, s.frames, s.bytes = [], 0, 0
+        start = time.monotonic()
+        time.sleep(args.duration)
+        seconds = time.monotonic() - start
+
+        for c in conns:
+            c.running = False
+        sim.burst = 0
+        time.sleep(0.5)  # let echoes in flight land
+        for c in conns:
+            c.stop()
+        sim.stop()
+
+        return {
+            'baud': baud,
+            'clients': clients,
+            'uart_to_tcp': from_uart.report(seconds),
+            'tcp_to_uart': to_uart.report(seconds),
+            'misrouted': sum(c.foreign for c in conns),
+        }
+    finally:
+        bridge.kill()
+        bridge.wait()
+        if os.path.islink(link):
+            os.unlink(link)
+
+
+def fmt(v):
+    return '-' if v is None else ('%.0f' % v)
+
+
+HEAD = '%7s %3s | %-42s | %-42s | %s'
+
+
+def print_header():
+    print(HEAD % ('baud', 'cl', 'UART->TCP fr/s B/s p50 p99 p999 us drop',
+                  'TCP->UART fr/s B/s p50 p99 p999 us drop', 'misrouted'))
+
+
+def print_row(r):
+    cols = []
+    for key in ('uart_to_tcp', 'tcp_to_uart'):
+        s = r[key]
+        cols.append('%7s %8s %5s %6s %6s %4d' % (s['frames_s'], s['bytes_s'], fmt(s['p50_us']),
+                                                fmt(s['p99_us']), fmt(s['p999_us']), s['drops']))
+    print(HEAD % (r['baud'], r['clients'], cols[0], cols[1], r['misrouted']))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--bridge', default='.pio/build/native/program', help='native bridge binary')
+    parser.add_argument('--port', type=int, default=16638)
+    parser.add_argument('--baud', default='115200,230400,460800', help='comma separated')
+    parser.add_argument('--clients', default='1,2,4', help='comma separated')
+    parser.add_argument('--rate', type=float, default=50, help='requests/s per client')
+    parser.add_argument('--burst', type=int, default=20, help='AREQs per burst, 0 for none')
+    parser.add_argument('--interval', type=float, default=100, help='ms between bursts')
+    parser.add_argument('--areq-size', type=int, default=40, help='AREQ data bytes')
+    parser.add_argument('--duration', type=float, default=10, help='seconds per case')
+    parser.add_argument('--warmup', type=float, default=1, help='seconds ignored per case')
+    parser.add_argument('--json', help='also write results to this file')
+    args = parser.parse_args()
+
+    if not os.path.exists(args.bridge):
+        sys.exit('%s not found, build it with: pio run -e native' % args.bridge)
+
+    results = []
+    print_header()
+    for baud in [int(b) for b in args.baud.split(',')]:
+        for clients in [int(c) for c in args.clients.split(',')]:
+            results.append(run_case(args, baud, clients))
+            print_row(results[-1])
+            sys.stdout.flush()
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump(results, f, indent=2)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,68 @@
+// Writes src/webh/assets.h: every gzipped asset of src/websrc/gzipped with
+// its URL, MIME type and the array, length and hash of its src/webh header,
+// sorted by URL so the firmware finds one by binary search. An asset added
+// to src/websrc needs no code.
+var fs = require('fs');
+var path = require('path');
+
+var source = path.join(__dirname, '../../src/websrc/gzipped');
+var destination = path.join(__dirname, '../../src/webh/assets.h');
+
+var types = {
+    '.css': 'text/css',
+    '.js': 'text/javascript',
+    '.woff': 'font/woff',
+    '.png': 'image/png',
+    '.gif': 'image/gif',
+    '.svg': 'image/svg+xml',
+    '.ico': 'image/x-icon',
+    '.json': 'application/json'
+};
+
+function assets(cb) {
+    var list = [];
+    fs.readdirSync(source).forEach(function (dir) {
+        fs.readdirSync(path.join(source, dir)).forEach(function (file) {
+            if (path.extname(file) != '.gz') {
+                return;
+            }
+            var name = path.basename(file, '.gz');
+            var type = types[path.extname(name)];
+            if (!type) {
+                throw new Error(file + ': unknown MIME type');
+            }
+            list.push({
+                url: '/' + dir + '/' + name,
+                type: type,
+                header: file + '.h',
+                ident: file.replace(/\.|-/g, '_')
+            });
+        });
+    });
+    // plain code unit order, the same as strcmp() for these ASCII URLs
+    list.sort(function (a, b) {
+        return a.url < b.url ? -1 : a.url > b.url ? 1 : 0;
+    });
+
+    var out = '// generated by tools/webfilesbuilder from src/websrc/gzipped, do not edit\n';
+    out += '#ifndef WEBH_ASSETS_H_\n#define WEBH_ASSETS_H_\n\n';
+    list.forEach(function (asset) {
+        out += '#include "' + asset.header + '"\n';
+    });
+    out += '\nstruct WebAsset\n{\n  const char *url;\n  const char *type;\n  const uint8_t *data;\n  uint32_t len;\n  const char *hash;\n};\n\n';
+    out += '// sorted by url\nconstexpr WebAsset WEB_ASSETS[] PROGMEM = {\n';
+    out += list.map(function (asset) {
+        return '    {"' + asset.url + '", "' + asset.type + '", ' + asset.ident + ', ' + asset.ident + '_len, ' + asset.ident + '_hash}';
+    }).join(',\n');
+    out += '};\n#define WEB_ASSET_COUNT ' + list.length + '\n\n#endif\n';
+
+    fs.writeFileSync(destination, out);
+    cb();
+}
+
+module.exports = assets;
+
+// node assets.js, without the rest of the asset build
+if (require.main === module) {
+    assets(function () {});
+}
@@ -4,9 +4,17 @@ var concat = require('gulp-concat');
 var gzip = require('gulp-gzip');
 var flatmap = require('gulp-flatmap');
 var path = require('path');
+var crypto = require('crypto');
 var htmlmin = require('gulp-htmlmin');
 var uglify = require('gulp-uglify');
 var pump = require('pump');
+var templates = require('./templates');
+var assets = require('./assets');
+
+// strong ETag of an embedded asset, changes with its gzip bytes
+function contentHash(data) {
+    return crypto.createHash('sha256').update(data).digest('hex').slice(0, 16);
+}
 
 function stylesConcat() {
     return gulp.src(['../../src/websrc/css/style.css', '../../src/websrc/css/glyphicons.css', '../../src/websrc/css/bootstrap.min.css', '../../src/websrc/css/toast.min.css'])
@@ -35,6 +43,7 @@ function styles(cb) {
     var data = fs.readFileSync(source);
  
     wstream.write('#define required_css_gz_len ' + data.length + '\n');
+    wstream.write('#define required_css_gz_hash "' + contentHash(data) + '"\n');
     wstream.write('const uint8_t required_css_gz[] PROGMEM = {')
  
     for (i=0; i<data.length; i++) {
@@ -68,6 +77,7 @@ function scripts() {
             });
 			var data = file.contents;
             wstream.write("#define " + filename.replace(/\.|-/g, "_") + "_len " + data.length + "\n");
+            wstream.write("#define " + filename.replace(/\.|-/g, "_") + "_hash \"" + contentHash(data) + "\"\n");
             wstream.write("const uint8_t " + filename.replace(/\.|-/g, "_") + "[] PROGMEM = {")
             
             for (i = 0; i < data.length; i++) {
@@ -102,6 +112,7 @@ function fonts() {
             });
 			var data = file.contents;
             wstream.write("#define " + filename.replace(/\.|-/g, "_") + "_len " + data.length + "\n");
+            wstream.write("#define " + filename.replace(/\.|-/g, "_") + "_hash \"" + contentHash(data) + "\"\n");
             wstream.write("const uint8_t " + filename.replace(/\.|-/g, "_") + "[] PROGMEM = {")
             
             for (i = 0; i < data.length; i++) {
@@ -136,6 +147,7 @@ function imgs() {
             });
 			var data = file.contents;
             wstream.write("#define " + filename.replace(/\.|-/g, "_") + "_len " + data.length + "\n");
+            wstream.write("#define " + filename.replace(/\.|-/g, "_") + "_hash \"" + contentHash(data) + "\"\n");
             wstream.write("const uint8_t " + filename.replace(/\.|-/g, "_") + "[] PROGMEM = {")
             
             for (i = 0; i < data.length; i++) {
@@ -156,4 +168,6 @@ const scriptTasks = gulp.series(scriptsgz, scripts);
 const fontTasks = gulp.series(fontgz, fonts);
 const imgTasks = gulp.series(imggz, imgs);
 
-exports.default = gulp.parallel(styleTasks, scriptTasks, fontTasks, imgTasks);
\ No newline at end of file
+exports.templates = templates;
+exports.assets = assets;
+exports.default = gulp.series(gulp.parallel(styleTasks, scriptTasks, fontTasks, imgTasks, templates), assets);
\ No newline at end of file
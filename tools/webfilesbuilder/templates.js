@@ -0,0 +1,146 @@
+// Compiles the page templates in src/websrc/html into src/webh/templates.h.
+// Every template becomes one string of literal text and a table of
+// segments: a span of that text followed by a {{field}}. Each template
+// gets an enum class of its fields, so a handler filling a field the
+// template lacks does not compile, and with -Wswitch one missing a field
+// does not either.
+//
+// Template files are written one piece per line: HTML comments, line
+// breaks and the indentation of a line are dropped, trailing spaces kept.
+var fs = require('fs');
+var path = require('path');
+
+var source = path.join(__dirname, '../../src/websrc/html');
+var destination = path.join(__dirname, '../../src/webh/templates.h');
+
+var NO_FIELD = 'PAGE_NO_FIELD';
+
+function cName(file) {
+    return 'HTML_' + path.basename(file, '.html').toUpperCase().replace(/\W/g, '_');
+}
+
+function enumName(file) {
+    return path.basename(file, '.html').split(/[^A-Za-z0-9]/).map(function (word) {
+        return word.charAt(0).toUpperCase() + word.slice(1);
+    }).join('') + 'Field';
+}
+
+function cString(text) {
+    var out = '';
+    var bytes = Buffer.from(text, 'utf8');
+    for (var i = 0; i < bytes.length; i++) {
+        var c = bytes[i];
+        if (c == 0x22 || c == 0x5c) {
+            out += '\\' + String.fromCharCode(c);
+        } else if (c < 0x20 || c > 0x7e) {
+            out += '\\' + ('00' + c.toString(8)).slice(-3);
+        } else {
+            out += String.fromCharCode(c);
+        }
+    }
+    return '"' + out + '"';
+}
+
+// the source keeps its line breaks to lay out the C string the same way
+function byteLength(text) {
+    return Buffer.byteLength(text.replace(/\n/g, ''), 'utf8');
+}
+
+function compile(file) {
+    var html = fs.readFileSync(file, 'utf8')
+        .replace(/<!--[\s\S]*?-->/g, '')
+        .split(/\r?\n/)
+        .map(function (line) { return line.replace(/^\s+/, ''); })
+        .join('\n');
+
+    var fields = [];
+    var segments = [];
+    var offset = 0;
+    var last = 0;
+    var placeholder = /\{\{(.*?)\}\}/g;
+    var match;
+    while ((match = placeholder.exec(html)) !== null) {
+        var name = match[1];
+        if (!/^[A-Za-z_]\w*$/.test(name)) {
+            throw new Error(file + ': bad field {{' + name + '}}');
+        }
+        if (fields.indexOf(name) < 0) {
+            fields.push(name);
+        }
+        var literal = html.slice(last, match.index);
+        segments.push({ offset: offset, text: literal, field: name });
+        offset += byteLength(literal);
+        last = placeholder.lastIndex;
+    }
+    var rest = html.slice(last);
+    if (/\{\{|\}\}/.test(rest)) {
+        throw new Error(file + ': unbalanced {{ }}');
+    }
+    if (rest.length > 0 || segments.length == 0) {
+        segments.push({ offset: offset, text: rest, field: null });
+        offset += byteLength(rest);
+    }
+    if (offset > 0xffff || fields.length >= 0xff) {
+        throw new Error(file + ': too large');
+    }
+    return { fields: fields, segments: segments };
+}
+
+function emit(file, page) {
+    var name = cName(file);
+    var type = page.fields.length ? enumName(file) : 'PageNoField';
+    var out = '// ' + path.basename(file) + '\n';
+
+    if (page.fields.length) {
+        out += 'enum class ' + type + ' : uint8_t\n{\n';
+        out += page.fields.map(function (field) { return '  ' + field; }).join(',\n');
+        out += '\n};\n';
+    }
+
+    out += 'const char ' + name + '_TEXT[] PROGMEM =';
+    var lines = [];
+    page.segments.forEach(function (segment) {
+        lines = lines.concat(segment.text.split('\n').filter(function (line) { return line.length > 0; }));
+    });
+    if (lines.length == 0) {
+        out += ' ""';
+    }
+    lines.forEach(function (line) {
+        out += '\n    ' + cString(line);
+    });
+    out += ';\n';
+
+    out += 'constexpr PageSegment ' + name + '_SEGMENTS[] PROGMEM = {\n';
+    out += page.segments.map(function (segment) {
+        var field = segment.field === null ? NO_FIELD : '(uint8_t)' + type + '::' + segment.field;
+        return '    {' + segment.offset + ', ' + byteLength(segment.text) + ', ' + field + '}';
+    }).join(',\n');
+    out += '};\n';
+
+    out += 'constexpr PageTemplate<' + type + '> ' + name + ' = {' + name + '_TEXT, ' + name + '_SEGMENTS, ' + page.segments.length + '};\n';
+    return out;
+}
+
+function templates(cb) {
+    var files = fs.readdirSync(source).filter(function (file) {
+        return path.extname(file) == '.html';
+    }).sort();
+
+    var out = '// generated by tools/webfilesbuilder from src/websrc/html, do not edit\n';
+    out += '#ifndef WEBH_TEMPLATES_H_\n#define WEBH_TEMPLATES_H_\n\n#include "../page.h"\n';
+    files.forEach(function (file) {
+        var full = path.join(source, file);
+        out += '\n' + emit(full, compile(full));
+    });
+    out += '\n#endif\n';
+
+    fs.writeFileSync(destination, out);
+    cb();
+}
+
+module.exports = templates;
+
+// node templates.js, without the rest of the asset build
+if (require.main === module) {
+    templates(function () {});
+}